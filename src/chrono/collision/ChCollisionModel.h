@@ -24,6 +24,7 @@
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChCoordsys.h"
 #include "chrono/core/ChMatrix33.h"
+#include "chrono/geometry/ChHeightField.h"
 #include "chrono/geometry/ChLinePath.h"
 #include "chrono/geometry/ChTriangleMesh.h"
 #include "chrono/physics/ChContactable.h"
@@ -183,6 +184,21 @@ class ChApi ChCollisionModel {
         double sphereswept_thickness = 0.0                  ///< outward sphere-swept layer (when supported)
         ) = 0;
 
+    /// Add a height-field surface to this collision model.
+    /// Unlike a triangle mesh, no bounding volume hierarchy is built for a height field: the grid cells overlapping a
+    /// given region are found directly from the regular grid. Prefer this over AddTriangleMesh for (static) terrain
+    /// surfaces defined on a regular grid.
+    /// The return value is false if the height field is not supported by the collision system.
+    virtual bool AddHeightField(                          //
+        std::shared_ptr<ChMaterialSurface> material,      ///< surface contact material
+        std::shared_ptr<geometry::ChHeightField> hfield,  ///< the height field
+        const ChVector<>& pos = ChVector<>(),             ///< origin position in model coordinates
+        const ChMatrix33<>& rot = ChMatrix33<>(1),        ///< rotation in model coordinates
+        double sphereswept_thickness = 0.0                ///< outward sphere-swept layer
+    ) {
+        return false;
+    }
+
     /// Add a barrel-like shape to this collision model (main axis on Y direction).
     /// The barrel shape is made by lathing an arc of an ellipse around the vertical Y axis.
     /// The center of the ellipse is on Y=0 level, and it is offsetted by R_offset from
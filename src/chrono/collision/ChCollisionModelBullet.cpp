@@ -12,8 +12,10 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
-#include <memory>
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <memory>
 
 #include "chrono/collision/ChCollisionSystemBullet.h"
 #include "chrono/collision/ChCollisionUtilsBullet.h"
@@ -22,6 +24,7 @@
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/bt2DShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/btBarrelShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/btCEtriangleShape.h"
+#include "chrono/collision/bullet/BulletCollision/CollisionShapes/btHeightfieldTerrainShape.h"
 #include "chrono/collision/bullet/btBulletCollisionCommon.h"
 #include "chrono/collision/gimpact/GIMPACT/Bullet/btGImpactCollisionAlgorithm.h"
 #include "chrono/collision/gimpact/GIMPACTUtils/btGImpactConvexDecompositionShape.h"
@@ -170,6 +173,7 @@ bool ChCollisionModelBullet::AddSphere(std::shared_ptr<ChMaterialSurface> materi
     SetSafeMargin(radius);
 
     auto shape = new ChCollisionShapeBullet(ChCollisionShape::Type::SPHERE, material);
+    shape->m_dims = {radius};
 
     shape->m_bt_shape = new btSphereShape((btScalar)(radius + GetEnvelope()));
     shape->m_bt_shape->setMargin((btScalar)GetSuggestedFullMargin());
@@ -185,6 +189,7 @@ bool ChCollisionModelBullet::AddEllipsoid(std::shared_ptr<ChMaterialSurface> mat
                                           const ChVector<>& pos,
                                           const ChMatrix33<>& rot) {
     auto shape = new ChCollisionShapeBullet(ChCollisionShape::Type::ELLIPSOID, material);
+    shape->m_dims = {rx, ry, rz};
 
     btScalar rad = 1.0;
     btVector3 spos(0, 0, 0);
@@ -209,6 +214,7 @@ bool ChCollisionModelBullet::AddBox(std::shared_ptr<ChMaterialSurface> material,
     SetSafeMargin(ChMin(GetSafeMargin(), 0.2 * ChMin(ChMin(hx, hy), hz)));
 
     auto shape = new ChCollisionShapeBullet(ChCollisionShape::Type::BOX, material);
+    shape->m_dims = {hx, hy, hz};
 
     btScalar ahx = (btScalar)(hx + GetEnvelope());
     btScalar ahy = (btScalar)(hy + GetEnvelope());
@@ -230,6 +236,7 @@ bool ChCollisionModelBullet::AddCylinder(std::shared_ptr<ChMaterialSurface> mate
     SetSafeMargin(ChMin(GetSafeMargin(), 0.2 * ChMin(ChMin(rx, rz), 0.5 * hy)));
 
     auto shape = new ChCollisionShapeBullet(ChCollisionShape::Type::CYLINDER, material);
+    shape->m_dims = {rx, rz, hy};
 
     btScalar arx = (btScalar)(rx + GetEnvelope());
     btScalar arz = (btScalar)(rz + GetEnvelope());
@@ -250,6 +257,7 @@ bool ChCollisionModelBullet::AddCapsule(std::shared_ptr<ChMaterialSurface> mater
     SetSafeMargin(ChMin(GetSafeMargin(), 0.2 * ChMin(radius, hlen)));
 
     auto shape = new ChCollisionShapeBullet(ChCollisionShape::Type::CAPSULE, material);
+    shape->m_dims = {radius, hlen};
 
     btScalar ar = (btScalar)(radius + GetEnvelope());
     btScalar ah = (btScalar)(hlen + GetEnvelope());
@@ -269,6 +277,7 @@ bool ChCollisionModelBullet::AddCylindricalShell(std::shared_ptr<ChMaterialSurfa
     SetSafeMargin(ChMin(GetSafeMargin(), 0.2 * ChMin(radius, 0.5 * hlen)));
 
     auto shape = new ChCollisionShapeBullet(ChCollisionShape::Type::CYLSHELL, material);
+    shape->m_dims = {radius, hlen};
     shape->m_bt_shape =
         new btCylindricalShellShape((btScalar)(radius + GetEnvelope()), (btScalar)(hlen + GetEnvelope()));
     shape->m_bt_shape->setMargin((btScalar)GetSuggestedFullMargin());
@@ -700,6 +709,51 @@ bool ChCollisionModelBullet::AddTriangleMesh(std::shared_ptr<ChMaterialSurface>
     return true;
 }
 
+// Bullet heightfield shape which reads the heights from a Chrono height field.
+// The shape is created with a height range symmetric about 0 so that its local origin coincides with the origin of the
+// height field (i.e., no offset is needed to place it in the collision model).
+class btHeightfieldTerrainShape_handlefield : public btHeightfieldTerrainShape {
+    std::shared_ptr<geometry::ChHeightField> m_hfield;
+
+  public:
+    btHeightfieldTerrainShape_handlefield(std::shared_ptr<geometry::ChHeightField> hfield, btScalar max_abs_height)
+        : btHeightfieldTerrainShape(hfield->GetNumVerticesX(),
+                                    hfield->GetNumVerticesY(),
+                                    hfield->GetHeights().data(),
+                                    1,
+                                    -max_abs_height,
+                                    max_abs_height,
+                                    2,
+                                    PHY_DOUBLE,
+                                    true),
+          m_hfield(hfield) {
+        // diagonal from (i,j) to (i+1,j+1) in each grid cell, as in ChHeightField
+        setLocalScaling(btVector3((btScalar)hfield->GetSpacingX(), (btScalar)hfield->GetSpacingY(), 1));
+    }
+
+    virtual btScalar getRawHeightFieldValue(int x, int y) const override {
+        return (btScalar)m_hfield->GetVertexHeight(x, y);
+    }
+};
+
+bool ChCollisionModelBullet::AddHeightField(std::shared_ptr<ChMaterialSurface> material,
+                                            std::shared_ptr<geometry::ChHeightField> hfield,
+                                            const ChVector<>& pos,
+                                            const ChMatrix33<>& rot,
+                                            double sphereswept_thickness) {
+    if (hfield->GetNumVerticesX() < 2 || hfield->GetNumVerticesY() < 2)
+        return false;
+
+    double max_abs_height = std::max(std::abs(hfield->GetMinHeight()), std::abs(hfield->GetMaxHeight()));
+
+    auto shape = new ChCollisionShapeBullet(ChCollisionShape::Type::HEIGHTFIELD, material);
+    shape->m_bt_shape = new btHeightfieldTerrainShape_handlefield(hfield, (btScalar)max_abs_height);
+    shape->m_bt_shape->setMargin((btScalar)(GetEnvelope() + sphereswept_thickness));
+
+    injectShape(pos, rot, shape);
+    return true;
+}
+
 bool ChCollisionModelBullet::AddTriangleMeshConcave(std::shared_ptr<ChMaterialSurface> material,
                                                     std::shared_ptr<geometry::ChTriangleMesh> trimesh,
                                                     const ChVector<>& pos,
@@ -195,6 +195,20 @@ class ChApi ChCollisionModelBullet : public ChCollisionModel {
         double sphereswept_thickness = 0.0                  ///< outward sphere-swept layer (when supported)
         ) override;
 
+    /// Add a height-field surface to this collision model.
+    /// The height field is represented with a Bullet heightfield terrain shape which reads the heights directly from
+    /// the given ChHeightField (no copy is made, the height field is kept alive by the shape); the grid cells
+    /// overlapping a contact or ray query are found in constant time. For best performance, add the height field
+    /// without offset (pos and rot set to default), in which case no compound shape is created if this is the only
+    /// shape in the model.
+    virtual bool AddHeightField(                          //
+        std::shared_ptr<ChMaterialSurface> material,      ///< surface contact material
+        std::shared_ptr<geometry::ChHeightField> hfield,  ///< the height field
+        const ChVector<>& pos = ChVector<>(),             ///< origin position in model coordinates
+        const ChMatrix33<>& rot = ChMatrix33<>(1),        ///< rotation in model coordinates
+        double sphereswept_thickness = 0.0                ///< outward sphere-swept layer
+        ) override;
+
     /// CUSTOM for this class only: add a concave triangle mesh that will be managed
     /// by GImpact mesh-mesh algorithm. Note that, despite this can work with
     /// arbitrary meshes, there could be issues of robustness and precision, so
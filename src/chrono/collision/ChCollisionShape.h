@@ -15,6 +15,8 @@
 #ifndef CH_COLLISION_SHAPE
 #define CH_COLLISION_SHAPE
 
+#include <vector>
+
 #include "chrono/core/ChApiCE.h"
 #include "chrono/physics/ChMaterialSurface.h"
 
@@ -44,6 +46,7 @@ class ChApi ChCollisionShape {
         CONVEX,       // Currently implemented in parallel only
         TETRAHEDRON,  // Currently implemented in parallel only
         PATH2D,
+        HEIGHTFIELD,
         UNKNOWN_SHAPE
     };
 
@@ -57,9 +60,16 @@ class ChApi ChCollisionShape {
     std::shared_ptr<ChMaterialSurface> GetMaterial() const { return m_material; }
     ChContactMethod GetContactMethod() const { return m_material->GetContactMethod(); }
 
+    /// Return the shape dimensions, as specified when the shape was added to the collision model.
+    /// Unlike ChCollisionModel::GetShapeDimensions, these never include the collision envelope or margin. The values
+    /// are listed in the same order as for ChCollisionModel::GetShapeDimensions (with CYLSHELL: radius halflength).
+    /// Empty for shape types without a fixed set of dimensions (e.g., meshes and convex hulls).
+    const std::vector<double>& GetDimensions() const { return m_dims; }
+
   protected:
     Type m_type;                                    ///< type of collision shape
     std::shared_ptr<ChMaterialSurface> m_material;  ///< surface contact material
+    std::vector<double> m_dims;                     ///< dimensions specified when the shape was added
 
     friend class ChCollisionModel;
 };
@@ -19,6 +19,7 @@
 #include "chrono/collision/ChCollisionAlgorithmsBullet.h"
 #include "chrono/collision/gimpact/GIMPACT/Bullet/btGImpactCollisionAlgorithm.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 extern btScalar gContactBreakingThreshold;
 
@@ -145,6 +146,7 @@ void ChCollisionSystemBullet::Remove(ChCollisionModel* model) {
 }
 
 void ChCollisionSystemBullet::Run() {
+    CH_TRACE_ZONE("ChCollisionSystemBullet::Run");
     if (bt_collision_world) {
         bt_collision_world->performDiscreteCollisionDetection();
     }
@@ -37,6 +37,7 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <sstream>
 
 #include "chrono/core/ChBezierCurve.h"
@@ -69,6 +70,7 @@ ChBezierCurve::ChBezierCurve(const std::vector<ChVector<> >& points,
     assert(points.size() > 1);
     assert(points.size() == inCV.size());
     assert(points.size() == outCV.size());
+    buildBVH();
 }
 
 ChBezierCurve::ChBezierCurve(const std::vector<ChVector<> >& points) : m_points(points) {
@@ -86,6 +88,7 @@ ChBezierCurve::ChBezierCurve(const std::vector<ChVector<> >& points) : m_points(
     if (numPoints == 2) {
         m_outCV[0] = (2.0 * points[0] + points[1]) / 3.0;
         m_inCV[1] = (points[0] + 2.0 * points[1]) / 3.0;
+        buildBVH();
         return;
     }
 
@@ -131,6 +134,8 @@ ChBezierCurve::ChBezierCurve(const std::vector<ChVector<> >& points) : m_points(
     delete[] x;
     delete[] y;
     delete[] z;
+
+    buildBVH();
 }
 
 void ChBezierCurve::setPoints(const std::vector<ChVector<> >& points,
@@ -142,6 +147,7 @@ void ChBezierCurve::setPoints(const std::vector<ChVector<> >& points,
     m_points = points;
     m_inCV = inCV;
     m_outCV = outCV;
+    buildBVH();
 }
 
 // Utility function for solving the tridiagonal system for one of the
@@ -402,6 +408,203 @@ ChVector<> ChBezierCurve::calcClosestPoint(const ChVector<>& loc, size_t i, doub
     return Q;
 }
 
+// -----------------------------------------------------------------------------
+// ChBezierCurve::buildBVH()
+//
+// This function builds a bounding volume hierarchy over the curve intervals.
+// Each interval is bounded by the box of its control polygon (convex hull
+// property of Bezier curves). Nodes are split at the median interval along
+// the longest axis, until at most 4 intervals are left in a leaf.
+// -----------------------------------------------------------------------------
+void ChBezierCurve::buildBVH() {
+    m_bvhNodes.clear();
+    m_bvhIntervals.clear();
+    if (m_points.size() < 2)
+        return;
+
+    size_t n = m_points.size() - 1;
+
+    // Bounding boxes and centers of the curve intervals
+    std::vector<ChVector<> > boxMin(n);
+    std::vector<ChVector<> > boxMax(n);
+    std::vector<ChVector<> > centers(n);
+    for (size_t i = 0; i < n; i++) {
+        const ChVector<>* cv[4] = {&m_points[i], &m_outCV[i], &m_inCV[i + 1], &m_points[i + 1]};
+        boxMin[i] = *cv[0];
+        boxMax[i] = *cv[0];
+        for (int k = 1; k < 4; k++) {
+            for (int j = 0; j < 3; j++) {
+                boxMin[i][j] = std::min(boxMin[i][j], (*cv[k])[j]);
+                boxMax[i][j] = std::max(boxMax[i][j], (*cv[k])[j]);
+            }
+        }
+        centers[i] = 0.5 * (boxMin[i] + boxMax[i]);
+    }
+
+    m_bvhIntervals.resize(n);
+    for (size_t i = 0; i < n; i++)
+        m_bvhIntervals[i] = i;
+
+    struct Range {
+        size_t node;
+        size_t first;
+        size_t count;
+    };
+    std::vector<Range> stack(1, Range{0, 0, n});
+    m_bvhNodes.reserve(2 * (n / 2 + 1));
+    m_bvhNodes.resize(1);
+
+    while (!stack.empty()) {
+        Range r = stack.back();
+        stack.pop_back();
+
+        // Bounding box of all intervals in range
+        ChVector<> nodeMin = boxMin[m_bvhIntervals[r.first]];
+        ChVector<> nodeMax = boxMax[m_bvhIntervals[r.first]];
+        for (size_t k = r.first + 1; k < r.first + r.count; k++) {
+            size_t i = m_bvhIntervals[k];
+            for (int j = 0; j < 3; j++) {
+                nodeMin[j] = std::min(nodeMin[j], boxMin[i][j]);
+                nodeMax[j] = std::max(nodeMax[j], boxMax[i][j]);
+            }
+        }
+        m_bvhNodes[r.node].m_min = nodeMin;
+        m_bvhNodes[r.node].m_max = nodeMax;
+
+        if (r.count <= 4) {
+            m_bvhNodes[r.node].m_first = r.first;
+            m_bvhNodes[r.node].m_count = r.count;
+            continue;
+        }
+
+        // Split at the median interval along the longest axis of the node box
+        ChVector<> size = nodeMax - nodeMin;
+        int axis = (size.x() >= size.y() && size.x() >= size.z()) ? 0 : (size.y() >= size.z() ? 1 : 2);
+        size_t mid = r.first + r.count / 2;
+        std::nth_element(m_bvhIntervals.begin() + r.first, m_bvhIntervals.begin() + mid,
+                         m_bvhIntervals.begin() + r.first + r.count,
+                         [&](size_t a, size_t b) { return centers[a][axis] < centers[b][axis]; });
+
+        size_t child = m_bvhNodes.size();
+        m_bvhNodes[r.node].m_first = child;
+        m_bvhNodes[r.node].m_count = 0;
+        m_bvhNodes.resize(child + 2);
+        stack.push_back(Range{child, r.first, mid - r.first});
+        stack.push_back(Range{child + 1, mid, r.first + r.count - mid});
+    }
+}
+
+// -----------------------------------------------------------------------------
+// ChBezierCurve::findClosestPoint()
+//
+// This function returns the closest point on the entire curve to the specified
+// location. The BVH is traversed depth-first, visiting the nearer child first
+// and skipping all nodes whose bounding box is farther than the current best.
+// -----------------------------------------------------------------------------
+static double BoxDist2(const ChVector<>& loc, const ChVector<>& boxMin, const ChVector<>& boxMax) {
+    double d2 = 0;
+    for (int j = 0; j < 3; j++) {
+        double d = std::max(std::max(boxMin[j] - loc[j], loc[j] - boxMax[j]), 0.0);
+        d2 += d * d;
+    }
+    return d2;
+}
+
+double ChBezierCurve::calcClosestPointGlobal(const ChVector<>& loc, size_t i, double& t, ChVector<>& point) const {
+    // Initial guess from uniformly spaced samples
+    const int numSamples = 8;
+    double tBest = 0;
+    double d2Best = (eval(i, 0) - loc).Length2();
+    for (int k = 1; k <= numSamples; k++) {
+        double tk = (double)k / numSamples;
+        double d2 = (eval(i, tk) - loc).Length2();
+        if (d2 < d2Best) {
+            tBest = tk;
+            d2Best = d2;
+        }
+    }
+
+    // Refine with Newton iterations (keep the sample if these do not improve it)
+    t = tBest;
+    point = calcClosestPoint(loc, i, t);
+    double d2 = (point - loc).Length2();
+    if (d2 > d2Best) {
+        t = tBest;
+        point = eval(i, t);
+        d2 = d2Best;
+    }
+
+    return d2;
+}
+
+bool ChBezierCurve::findClosestPoint(const ChVector<>& loc,
+                                     size_t& i,
+                                     double& t,
+                                     ChVector<>& point,
+                                     double max_dist) const {
+    if (m_bvhNodes.empty())
+        return false;
+
+    double d2Best = (max_dist > 0) ? max_dist * max_dist : std::numeric_limits<double>::infinity();
+    bool found = false;
+
+    // The BVH depth is logarithmic in the number of intervals for a median split, but the traversal stack is not
+    // bounded by a fixed size
+    std::vector<size_t> stack;
+    stack.reserve(64);
+    stack.push_back(0);
+
+    while (!stack.empty()) {
+        const BVHNode& node = m_bvhNodes[stack.back()];
+        stack.pop_back();
+        if (BoxDist2(loc, node.m_min, node.m_max) >= d2Best)
+            continue;
+
+        if (node.m_count > 0) {
+            for (size_t k = node.m_first; k < node.m_first + node.m_count; k++) {
+                double tk;
+                ChVector<> pk;
+                double d2 = calcClosestPointGlobal(loc, m_bvhIntervals[k], tk, pk);
+                if (d2 < d2Best) {
+                    d2Best = d2;
+                    i = m_bvhIntervals[k];
+                    t = tk;
+                    point = pk;
+                    found = true;
+                }
+            }
+            continue;
+        }
+
+        // Push the farther child first, so that the nearer one is visited next
+        size_t c0 = node.m_first;
+        size_t c1 = node.m_first + 1;
+        if (BoxDist2(loc, m_bvhNodes[c0].m_min, m_bvhNodes[c0].m_max) <
+            BoxDist2(loc, m_bvhNodes[c1].m_min, m_bvhNodes[c1].m_max))
+            std::swap(c0, c1);
+        stack.push_back(c0);
+        stack.push_back(c1);
+    }
+
+    return found;
+}
+
+void ChBezierCurve::findClosestPoints(const std::vector<ChVector<> >& locs,
+                                      std::vector<size_t>& intervals,
+                                      std::vector<double>& params,
+                                      std::vector<ChVector<> >& points,
+                                      int nthreads) const {
+    int n = static_cast<int>(locs.size());
+    intervals.resize(n);
+    params.resize(n);
+    points.resize(n);
+
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic, 16)
+    for (int k = 0; k < n; k++) {
+        findClosestPoint(locs[k], intervals[k], params[k], points[k]);
+    }
+}
+
 // -----------------------------------------------------------------------------
 
 void ChBezierCurve::ArchiveOUT(ChArchiveOut& marchive)
@@ -432,56 +635,26 @@ void ChBezierCurve::ArchiveIN(ChArchiveIn& marchive)
     marchive >> CHNVP(m_sqrDistTol);
     marchive >> CHNVP(m_cosAngleTol);
     marchive >> CHNVP(m_paramTol);
+    buildBVH();
 }
 
 // -----------------------------------------------------------------------------
 // ChBezierCurveTracker::reset()
 //
 // This function reinitializes the pathTracker at the specified location. It
-// calculates an appropriate initial guess for the curve segment and sets the
-// curve parameter to 0.5.
+// sets the current interval and curve parameter to those of the closest point
+// on the entire path.
 // -----------------------------------------------------------------------------
-class PointSpec {
-  public:
-    PointSpec() {}
-    PointSpec(size_t index, double dist2) : m_index(index), m_dist2(dist2) {}
-
-    size_t m_index;
-    double m_dist2;
-};
-
-static bool comparePoints(const PointSpec& p1, const PointSpec& p2) {
-    return p1.m_dist2 < p2.m_dist2;
-}
-
 void ChBezierCurveTracker::reset(const ChVector<>& loc) {
-    // Walk all curve points and calculate the distance to the specified reset
-    // location, then sort them in increasing order.
-    std::vector<PointSpec> points;
-
-    for (size_t i = 0; i < m_path->getNumPoints(); i++)
-        points.push_back(PointSpec(i, (loc - m_path->m_points[i]).Length2()));
-
-    std::sort(points.begin(), points.end(), comparePoints);
-
-    // Set the initial guess to be at t=0.5 in either the interval starting at
-    // the point with minimum distance or in the previous interval.
-    m_curParam = 0.5f;
-    m_curInterval = points[0].m_index;
-
-    if (m_curInterval == 0)
-        return;
-
-    if (m_curInterval == m_path->getNumPoints() - 1) {
-        m_curInterval--;
+    // A path with less than two points has no intervals (and an empty BVH); track its first point
+    if (m_path->getNumPoints() < 2) {
+        m_curInterval = 0;
+        m_curParam = 0;
         return;
     }
 
-    ChVector<> loc2cur = m_path->m_points[m_curInterval] - loc;
-    ChVector<> loc2prev = m_path->m_points[m_curInterval - 1] - loc;
-
-    if (Vdot(loc2cur, loc2prev) < 0)
-        m_curInterval--;
+    ChVector<> point;
+    m_path->findClosestPoint(loc, m_curInterval, m_curParam, point);
 }
 
 // -----------------------------------------------------------------------------
@@ -494,8 +667,11 @@ void ChBezierCurveTracker::reset(const ChVector<>& loc) {
 // for the Newton iteration, we use time coherence (by keeping track of the path
 // interval and curve parameter within that interval from the last query). As
 // such, this function should be called with a continuous sequence of locations.
+// If re-acquisition is enabled, a global search (restricted to points closer
+// than the tracked one by more than the re-acquisition tolerance) is used to
+// detect whether tracking was lost.
 //
-// The algorithm is as follows:
+// The algorithm for the time-coherent search is as follows:
 //  - find the closest point in the current interval of the Bezier curve to the
 //    specified location;
 //  - stop if the curve parameter is in (0, 1);
@@ -505,6 +681,24 @@ void ChBezierCurveTracker::reset(const ChVector<>& loc) {
 //    the previous iteration the parameter was close to 0.
 // -----------------------------------------------------------------------------
 int ChBezierCurveTracker::calcClosestPoint(const ChVector<>& loc, ChVector<>& point) {
+    int flag = trackClosestPoint(loc, point);
+
+    if (m_reacquireTol > 0) {
+        double dist = (point - loc).Length();
+        size_t i;
+        double t;
+        ChVector<> p;
+        if (dist > m_reacquireTol && m_path->findClosestPoint(loc, i, t, p, dist - m_reacquireTol)) {
+            m_curInterval = i;
+            m_curParam = t;
+            flag = trackClosestPoint(loc, point);
+        }
+    }
+
+    return flag;
+}
+
+int ChBezierCurveTracker::trackClosestPoint(const ChVector<>& loc, ChVector<>& point) {
     bool lastAtMin = false;
     bool lastAtMax = false;
 
@@ -25,7 +25,8 @@
 //    piece-wise 3D curve (using the Bernstein polynomial representation of
 //    Bezier curves). In addition, it provides a method for calculating the
 //    closest point on a specified interval of the curve to a specified
-//    location.
+//    location, and a global closest-point search accelerated by a bounding
+//    volume hierarchy over the curve intervals.
 //
 // ChBezierCurveTracker
 //    This utility class implements a tracker for a given path. It uses time
@@ -60,7 +61,11 @@ namespace chrono {
 /// piece-wise 3D curve (using the Bernstein polynomial representation of
 /// Bezier curves). In addition, it provides a method for calculating the
 /// closest point on a specified interval of the curve to a specified
-/// location.
+/// location, as well as a global closest-point search. The latter uses a
+/// bounding volume hierarchy over the curve intervals (each cubic Bezier
+/// segment lies inside the bounding box of its control polygon), built when
+/// the curve is defined, so that its cost grows only logarithmically with
+/// the number of knots.
 // -----------------------------------------------------------------------------
 class ChApi ChBezierCurve {
   public:
@@ -128,6 +133,22 @@ class ChApi ChBezierCurve {
     /// to the closest point.
     ChVector<> calcClosestPoint(const ChVector<>& loc, size_t i, double& t) const;
 
+    /// Find the closest point on the entire curve to the given location.
+    /// This function performs a global search over all curve intervals, visiting only those whose bounding box is
+    /// closer than the best point found so far. On return, 'i' and 't' contain the interval and the curve parameter
+    /// corresponding to the closest point. If 'max_dist' is positive, only points closer than this distance are
+    /// considered and the function returns false if there is no such point.
+    bool findClosestPoint(const ChVector<>& loc, size_t& i, double& t, ChVector<>& point, double max_dist = -1) const;
+
+    /// Find the closest points on the entire curve to each of the given locations.
+    /// This is a batched version of findClosestPoint (e.g., for multiple vehicles following the same path); the
+    /// queries are processed in parallel, using the specified number of threads.
+    void findClosestPoints(const std::vector<ChVector<> >& locs,
+                           std::vector<size_t>& intervals,
+                           std::vector<double>& params,
+                           std::vector<ChVector<> >& points,
+                           int nthreads = 1) const;
+
     /// Write the knots and control points to the specified file.
     void write(const std::string& filename);
 
@@ -161,10 +182,28 @@ class ChApi ChBezierCurve {
     /// resulting Bezier curve is a spline interpolant of the knots.
     static void solveTriDiag(size_t n, double* rhs, double* x);
 
+    /// Node in the bounding volume hierarchy over the curve intervals.
+    struct BVHNode {
+        ChVector<> m_min;  ///< lower corner of the bounding box
+        ChVector<> m_max;  ///< upper corner of the bounding box
+        size_t m_first;    ///< leaf: first entry in m_bvhIntervals; internal: index of the first child node
+        size_t m_count;    ///< leaf: number of intervals; internal: 0
+    };
+
+    /// Build the bounding volume hierarchy over the curve intervals.
+    void buildBVH();
+
+    /// Calculate the closest point to the given location on the specified interval, using a few samples to provide
+    /// the initial guess for the Newton iteration. Return the squared distance to the closest point.
+    double calcClosestPointGlobal(const ChVector<>& loc, size_t i, double& t, ChVector<>& point) const;
+
     std::vector<ChVector<> > m_points;  ///< set of knot points
     std::vector<ChVector<> > m_inCV;    ///< set on "incident" control points
     std::vector<ChVector<> > m_outCV;   ///< set of "outgoing" control points
 
+    std::vector<BVHNode> m_bvhNodes;     ///< bounding volume hierarchy (root node first)
+    std::vector<size_t> m_bvhIntervals;  ///< curve intervals, ordered by BVH leaf
+
     static const size_t m_maxNumIters;  ///< maximum number of Newton iterations
     static const double m_sqrDistTol;   ///< tolerance on squared distance
     static const double m_cosAngleTol;  ///< tolerance for orthogonality test
@@ -178,21 +217,22 @@ class ChApi ChBezierCurve {
 ///
 /// This utility class implements a tracker for a given path. It uses time
 /// coherence in order to provide an appropriate initial guess for the
-/// iterative (Newton) root finder.
+/// iterative (Newton) root finder. Multiple trackers can share the same path.
 // -----------------------------------------------------------------------------
 class ChApi ChBezierCurveTracker {
   public:
     /// Create a tracker associated with the specified Bezier curve.
-      ChBezierCurveTracker(std::shared_ptr<ChBezierCurve> path, bool isClosedPath = false)
-          : m_path(path), m_curInterval(0), m_curParam(0), m_isClosedPath(isClosedPath) {}
+    ChBezierCurveTracker(std::shared_ptr<ChBezierCurve> path, bool isClosedPath = false)
+        : m_path(path), m_curInterval(0), m_curParam(0), m_isClosedPath(isClosedPath), m_reacquireTol(0) {}
 
     /// Destructor for ChBezierCurveTracker.
     ~ChBezierCurveTracker() {}
 
     /// Reset the tracker at the specified location.
     /// This function reinitializes the pathTracker at the specified location. It
-    /// calculates an appropriate initial guess for the curve segment and sets the
-    /// curve parameter to 0.5.
+    /// sets the current curve interval and parameter to those of the closest point
+    /// on the entire path (see ChBezierCurve::findClosestPoint). For a path without
+    /// intervals (e.g., a default-constructed curve), these are set to 0.
     void reset(const ChVector<>& loc);
 
     /// Calculate the closest point on the underlying curve to the specified location.
@@ -216,11 +256,22 @@ class ChApi ChBezierCurveTracker {
     /// Set if the path is treated as an open loop or a closed loop for tracking
     void setIsClosedPath(bool isClosedPath);
 
+    /// Set the tolerance for re-acquiring the path (default: 0, no re-acquisition).
+    /// If positive, after each time-coherent search, the tracker checks (using a global search restricted to the
+    /// current distance) whether a different part of the path is closer to the specified location by more than this
+    /// tolerance and, if so, jumps to it. This allows recovering tracking after large jumps in location, while the
+    /// tolerance prevents switching between path branches at self-intersections.
+    void setReacquireTolerance(double tol) { m_reacquireTol = tol; }
+
   private:
+    /// Time-coherent search for the closest point, starting from the current interval and parameter.
+    int trackClosestPoint(const ChVector<>& loc, ChVector<>& point);
+
     std::shared_ptr<ChBezierCurve> m_path;  ///< associated Bezier curve
     size_t m_curInterval;                   ///< current search interval
     double m_curParam;                      ///< parameter for current closest point
     bool m_isClosedPath;                    ///< treat the path as a closed loop curve
+    double m_reacquireTol;                  ///< tolerance for re-acquiring the path (0: disabled)
 };
 
 CH_CLASS_VERSION(ChBezierCurve,0)
@@ -19,6 +19,7 @@
 #include "chrono/core/ChMath.h"
 #include "chrono/solver/ChSystemDescriptor.h"
 #include "chrono/fea/ChContinuumMaterial.h"
+#include "chrono/fea/ChElementBatch.h"
 #include "chrono/fea/ChNodeFEAbase.h"
 
 namespace chrono {
@@ -100,8 +101,16 @@ class ChApi ChElementBase {
     /// Adds the internal forces (pasted at global nodes offsets) into
     /// a global vector R, multiplied by a scaling factor c, as
     ///   R += forces * c
+    /// This function is called concurrently for elements that do not share nodes (see ChMesh element coloring), so
+    /// implementations can update R without synchronization but must not modify data shared with other elements.
     virtual void EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c) {}
 
+    /// Create an object for the batched evaluation of the internal forces of elements of this type.
+    /// If supported (i.e., a non-null batch is returned), ChMesh groups the elements of this type with the same color
+    /// in batches and loads their internal forces through ChElementBatch::IntLoadResidual_F, instead of calling
+    /// EleIntLoadResidual_F for each element.
+    virtual std::shared_ptr<ChElementBatch> CreateBatch() const { return nullptr; }
+
     /// Adds the product of element mass M by a vector w (pasted at global nodes offsets) into
     /// a global vector R, multiplied by a scaling factor c, as
     ///   R += M * w * c
@@ -113,6 +122,7 @@ class ChApi ChElementBase {
     /// contains G_acc values in the proper stride (ex. tetahedrons have 4x copies of G_acc in g). 
     /// Note that elements can provide fast implementations that do not need to build any internal M matrix,
     /// and not even the g vector, for instance if using lumped masses. 
+    /// As EleIntLoadResidual_F, this function is called concurrently for elements that do not share nodes.
     virtual void EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const ChVector<>& G_acc, const double c) = 0;
 
 
@@ -0,0 +1,62 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+
+#ifndef CHELEMENTBATCH_H
+#define CHELEMENTBATCH_H
+
+#include <memory>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup fea_elements
+/// @{
+
+class ChElementBase;
+
+/// Base class for the batched evaluation of internal forces of finite elements of the same type.
+/// A batch is created by an element (see ChElementBase::CreateBatch) and populated by ChMesh with elements of the
+/// same type and of the same color (i.e., elements that do not share nodes). The elements in a batch are split in
+/// blocks which are evaluated together (e.g., with SIMD instructions, one element per vector lane). Different blocks
+/// can be processed concurrently.
+class ChApi ChElementBatch {
+  public:
+    virtual ~ChElementBatch() {}
+
+    /// Add the specified element to this batch.
+    /// The element must be of the same type as the element which created this batch.
+    virtual void AddElement(std::shared_ptr<ChElementBase> element) = 0;
+
+    /// Get the number of elements in this batch.
+    virtual unsigned int GetNumElements() const = 0;
+
+    /// Get the number of blocks in this batch.
+    virtual int GetNumBlocks() const = 0;
+
+    /// Add the internal forces of all elements in the specified block (pasted at global nodes offsets) into a global
+    /// vector R, multiplied by a scaling factor c, as
+    ///   R += forces * c
+    /// The result must be the same as calling ChElementBase::EleIntLoadResidual_F for each element in the block.
+    virtual void IntLoadResidual_F(int block, ChVectorDynamic<>& R, const double c) = 0;
+};
+
+/// @} fea_elements
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
@@ -12,6 +12,8 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <map>
+
 #include "chrono/fea/ChElementGeneric.h"
 #include "chrono/physics/ChLoadable.h"
 #include "chrono/physics/ChLoad.h"
@@ -19,39 +21,60 @@
 namespace chrono {
 namespace fea {
 
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// Per-thread scratch storage for the default element residual calculations, keyed by the number of element DOFs.
+// Buffers are reused across calls, so that repeated evaluations do not allocate (also for meshes with mixed element
+// types).
+struct ScratchBuffers {
+    ChVectorDynamic<> F;
+    ChVectorDynamic<> q;
+    ChMatrixDynamic<> M;
+};
+
+ScratchBuffers& GetScratch(int ndofs) {
+    static thread_local std::map<int, ScratchBuffers> scratch;
+    auto& buffers = scratch[ndofs];
+    if (buffers.F.size() != ndofs) {
+        buffers.F.resize(ndofs);
+        buffers.q.resize(ndofs);
+    }
+    return buffers;
+}
+
+}  // end namespace
+
+// -----------------------------------------------------------------------------
+
+// Note: the functions loading into the global vector R are called concurrently from ChMesh for all elements of a
+// given color. Since elements of the same color do not share nodes, R is updated without synchronization.
+
 void ChElementGeneric::EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c) {
-    ChVectorDynamic<> mFi(this->GetNdofs());
+    auto& mFi = GetScratch(this->GetNdofs()).F;
     this->ComputeInternalForces(mFi);
-    // GetLog() << "EleIntLoadResidual_F , mFi=" << mFi << "  c=" << c << "\n";
-    mFi *= c;
-
-    //// RADU
-    //// Attention: this is called from within a parallel OMP for loop.
-    //// Must use atomic increment when updating the global vector R.
 
     int stride = 0;
     for (int in = 0; in < this->GetNnodes(); in++) {
         int nodedofs = GetNodeNdofs(in);
-        // GetLog() << "  in=" << in << "  stride=" << stride << "  nodedofs=" << nodedofs << " offset=" <<
-        // GetNodeN(in)->NodeGetOffset_w() << "\n";
-        if (!GetNodeN(in)->GetFixed()) {
-            for (int j = 0; j < nodedofs; j++)
-#pragma omp atomic
-                R(GetNodeN(in)->NodeGetOffset_w() + j) += mFi(stride + j);
-        }
+        if (!GetNodeN(in)->GetFixed())
+            R.segment(GetNodeN(in)->NodeGetOffset_w(), nodedofs) += c * mFi.segment(stride, nodedofs);
         stride += nodedofs;
     }
-    // GetLog() << "EleIntLoadResidual_F , R=" << R << "\n";
 }
 
 void ChElementGeneric::EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVectorDynamic<>& w, const double c) {
     // This is a default (VERY UNOPTIMAL) book keeping so that in children classes you can avoid
     // implementing this EleIntLoadResidual_Mv function, unless you need faster code)
 
-    ChMatrixDynamic<> mMi(this->GetNdofs(), this->GetNdofs());
+    auto& scratch = GetScratch(this->GetNdofs());
+    auto& mMi = scratch.M;
+    auto& mqi = scratch.q;
+    auto& mFi = scratch.F;
+    mMi.resize(this->GetNdofs(), this->GetNdofs());
     this->ComputeMmatrixGlobal(mMi);
 
-    ChVectorDynamic<> mqi(this->GetNdofs());
     int stride = 0;
     for (int in = 0; in < this->GetNnodes(); in++) {
         int nodedofs = GetNodeNdofs(in);
@@ -64,7 +87,7 @@ void ChElementGeneric::EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVecto
         stride += nodedofs;
     }
 
-    ChVectorDynamic<> mFi = c * mMi * mqi;
+    mFi.noalias() = c * mMi * mqi;
 
     stride = 0;
     for (int in = 0; in < this->GetNnodes(); in++) {
@@ -77,24 +100,16 @@ void ChElementGeneric::EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVecto
 
 
 void ChElementGeneric::EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const ChVector<>& G_acc, const double c) {
-    
-    ChVectorDynamic<> mFg(this->GetNdofs());
+    auto& mFg = GetScratch(this->GetNdofs()).F;
     this->ComputeGravityForces(mFg, G_acc);
-    mFg *= c;
-
 
     int stride = 0;
     for (int in = 0; in < this->GetNnodes(); in++) {
         int nodedofs = GetNodeNdofs(in);
-        if (!GetNodeN(in)->GetFixed()) {
-            for (int j = 0; j < nodedofs; j++)
-                //// ATOMIC as called from an OMP parallel loop: this is here to avoid race conditions when writing to R
-                #pragma omp atomic  
-                R(GetNodeN(in)->NodeGetOffset_w() + j) += mFg(stride + j);
-        }
+        if (!GetNodeN(in)->GetFixed())
+            R.segment(GetNodeN(in)->NodeGetOffset_w(), nodedofs) += c * mFg.segment(stride, nodedofs);
         stride += nodedofs;
     }
-
 }
 
 /*
@@ -20,6 +20,7 @@
 //// - more use of Eigen expressions
 //// - remove unecessary initializations to zero
 
+#include <algorithm>
 #include <cmath>
 
 #include "chrono/fea/ChElementShellANCF.h"
@@ -280,54 +281,14 @@ void ChElementShellANCF::ComputeGravityForce(const ChVector<>& g_acc) {
 // Elastic force calculation
 // -----------------------------------------------------------------------------
 
-// The class ShellANCF_Force provides the integrand for the calculation of the internal forces
-// for one layer of an ANCF shell element.
-// The first 24 entries in the integrand represent the internal force.
-// The next 5 entries represent the residual of the EAS nonlinear system.
-// The last 25 entries represent the 5x5 Jacobian of the EAS nonlinear system.
-// Capabilities of this class include: application of enhanced assumed strain (EAS) and
-// assumed natural strain (ANS) formulations to avoid thickness and (transverse and in-plane)
-// shear locking. This implementation also features a composite material implementation
-// that allows for selecting a number of layers over the element thickness; each of which
-// has an independent, user-selected fiber angle (direction for orthotropic constitutive behavior)
-class ShellANCF_Force : public ChIntegrable3D<ChVectorN<double, 54>> {
-  public:
-    ShellANCF_Force(ChElementShellANCF* element,     // Containing element
-                    size_t kl,                       // Current layer index
-                    ChVectorN<double, 5>* alpha_eas  // Vector of internal parameters for EAS formulation
-                    )
-        : m_element(element), m_kl(kl), m_alpha_eas(alpha_eas) {}
-    ~ShellANCF_Force() {}
-
-  private:
-    ChElementShellANCF* m_element;
-    size_t m_kl;
-    ChVectorN<double, 5>* m_alpha_eas;
-
-    /// Evaluate (strainD'*strain)  at point x, include ANS and EAS.
-    virtual void Evaluate(ChVectorN<double, 54>& result, const double x, const double y, const double z) override;
-};
-
-void ShellANCF_Force::Evaluate(ChVectorN<double, 54>& result, const double x, const double y, const double z) {
-    // Element shape function
-    ChElementShellANCF::ShapeVector N;
-    m_element->ShapeFunctions(N, x, y, z);
-
-    // Determinant of position vector gradient matrix: Initial configuration
-    ChElementShellANCF::ShapeVector Nx;
-    ChElementShellANCF::ShapeVector Ny;
-    ChElementShellANCF::ShapeVector Nz;
-    ChMatrixNM<double, 1, 3> Nx_d0;
-    ChMatrixNM<double, 1, 3> Ny_d0;
-    ChMatrixNM<double, 1, 3> Nz_d0;
-    double detJ0 = m_element->Calc_detJ0(x, y, z, Nx, Ny, Nz, Nx_d0, Ny_d0, Nz_d0);
-
-    // ANS shape function
-    ChMatrixNM<double, 1, 4> S_ANS;  // Shape function vector for Assumed Natural Strain
-    ChMatrixNM<double, 6, 5> M;      // Shape function vector for Enhanced Assumed Strain
-    m_element->ShapeFunctionANSbilinearShell(S_ANS, x, y);
-    m_element->Basis_M(M, x, y, z);
-
+// Calculate the coefficients of the contravariant transformation at a point with the given initial position vector
+// gradient (shape function derivatives times initial nodal coordinates), for a layer with fiber angle theta.
+static void CalcContravariantCoefficients(double theta,
+                                          const ChMatrixNM<double, 1, 3>& Nx_d0,
+                                          const ChMatrixNM<double, 1, 3>& Ny_d0,
+                                          const ChMatrixNM<double, 1, 3>& Nz_d0,
+                                          double detJ0,
+                                          ChVectorN<double, 9>& beta) {
     // Transformation : Orthogonal transformation (A and J)
     ChVector<double> G1xG2;  // Cross product of first and second column of
     double G1dotG1;          // Dot product of first column of position vector gradient
@@ -349,7 +310,6 @@ void ShellANCF_Force::Evaluate(ChVectorN<double, 54>& result, const double x, co
     A2.Cross(A3, A1);
 
     // Direction for orthotropic material
-    double theta = m_element->GetLayer(m_kl).Get_theta();  // Fiber angle
     ChVector<double> AA1;
     ChVector<double> AA2;
     ChVector<double> AA3;
@@ -357,12 +317,10 @@ void ShellANCF_Force::Evaluate(ChVectorN<double, 54>& result, const double x, co
     AA2 = -A1 * sin(theta) + A2 * cos(theta);
     AA3 = A3;
 
-    /// Beta
     ChMatrixNM<double, 3, 3> j0;
     ChVector<double> j01;
     ChVector<double> j02;
     ChVector<double> j03;
-    ChVectorN<double, 9> beta;
     // Calculates inverse of rd0 (j0) (position vector gradient: Initial Configuration)
     j0(0, 0) = Ny_d0(1) * Nz_d0(2) - Nz_d0(1) * Ny_d0(2);
     j0(0, 1) = Ny_d0(2) * Nz_d0(0) - Ny_d0(0) * Nz_d0(2);
@@ -395,6 +353,59 @@ void ShellANCF_Force::Evaluate(ChVectorN<double, 54>& result, const double x, co
     beta(6) = Vdot(AA1, j03);
     beta(7) = Vdot(AA2, j03);
     beta(8) = Vdot(AA3, j03);
+}
+
+// The class ShellANCF_Force provides the integrand for the calculation of the internal forces
+// for one layer of an ANCF shell element.
+// The first 24 entries in the integrand represent the internal force.
+// The next 5 entries represent the residual of the EAS nonlinear system.
+// The last 25 entries represent the 5x5 Jacobian of the EAS nonlinear system.
+// Capabilities of this class include: application of enhanced assumed strain (EAS) and
+// assumed natural strain (ANS) formulations to avoid thickness and (transverse and in-plane)
+// shear locking. This implementation also features a composite material implementation
+// that allows for selecting a number of layers over the element thickness; each of which
+// has an independent, user-selected fiber angle (direction for orthotropic constitutive behavior)
+class ShellANCF_Force : public ChIntegrable3D<ChVectorN<double, 54>> {
+  public:
+    ShellANCF_Force(ChElementShellANCF* element,     // Containing element
+                    size_t kl,                       // Current layer index
+                    ChVectorN<double, 5>* alpha_eas  // Vector of internal parameters for EAS formulation
+                    )
+        : m_element(element), m_kl(kl), m_alpha_eas(alpha_eas) {}
+    ~ShellANCF_Force() {}
+
+  private:
+    ChElementShellANCF* m_element;
+    size_t m_kl;
+    ChVectorN<double, 5>* m_alpha_eas;
+
+    /// Evaluate (strainD'*strain)  at point x, include ANS and EAS.
+    virtual void Evaluate(ChVectorN<double, 54>& result, const double x, const double y, const double z) override;
+};
+
+void ShellANCF_Force::Evaluate(ChVectorN<double, 54>& result, const double x, const double y, const double z) {
+    // Element shape function
+    ChElementShellANCF::ShapeVector N;
+    m_element->ShapeFunctions(N, x, y, z);
+
+    // Determinant of position vector gradient matrix: Initial configuration
+    ChElementShellANCF::ShapeVector Nx;
+    ChElementShellANCF::ShapeVector Ny;
+    ChElementShellANCF::ShapeVector Nz;
+    ChMatrixNM<double, 1, 3> Nx_d0;
+    ChMatrixNM<double, 1, 3> Ny_d0;
+    ChMatrixNM<double, 1, 3> Nz_d0;
+    double detJ0 = m_element->Calc_detJ0(x, y, z, Nx, Ny, Nz, Nx_d0, Ny_d0, Nz_d0);
+
+    // ANS shape function
+    ChMatrixNM<double, 1, 4> S_ANS;  // Shape function vector for Assumed Natural Strain
+    ChMatrixNM<double, 6, 5> M;      // Shape function vector for Enhanced Assumed Strain
+    m_element->ShapeFunctionANSbilinearShell(S_ANS, x, y);
+    m_element->Basis_M(M, x, y, z);
+
+    // Coefficients of contravariant transformation
+    ChVectorN<double, 9> beta;
+    CalcContravariantCoefficients(m_element->GetLayer(m_kl).Get_theta(), Nx_d0, Ny_d0, Nz_d0, detJ0, beta);
 
     // Transformation matrix, function of fiber angle
     const ChMatrixNM<double, 6, 6>& T0 = m_element->GetLayer(m_kl).Get_T0();
@@ -623,6 +634,511 @@ void ChElementShellANCF::ComputeInternalForces(ChVectorDynamic<>& Fi) {
     }
 }
 
+// -----------------------------------------------------------------------------
+// Batched elastic force calculation
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// Number of elements evaluated together in a block of a batch (one AVX-512 or two AVX2 registers of doubles).
+const int BATCH_WIDTH = 8;
+
+// Values of a scalar quantity for all elements in a block, one per lane.
+// Operations are lane-wise and implemented as simple loops over the lanes, which the compiler vectorizes.
+// Lanes are zero-initialized, so that the unused lanes of an incomplete block always hold valid values.
+struct Lanes {
+    double v[BATCH_WIDTH];
+
+    Lanes() {
+        for (int l = 0; l < BATCH_WIDTH; l++)
+            v[l] = 0;
+    }
+    explicit Lanes(double a) {
+        for (int l = 0; l < BATCH_WIDTH; l++)
+            v[l] = a;
+    }
+
+    Lanes& operator*=(const Lanes& a) {
+        for (int l = 0; l < BATCH_WIDTH; l++)
+            v[l] *= a.v[l];
+        return *this;
+    }
+};
+
+inline Lanes operator+(Lanes a, const Lanes& b) {
+    for (int l = 0; l < BATCH_WIDTH; l++)
+        a.v[l] += b.v[l];
+    return a;
+}
+
+inline Lanes operator-(Lanes a, const Lanes& b) {
+    for (int l = 0; l < BATCH_WIDTH; l++)
+        a.v[l] -= b.v[l];
+    return a;
+}
+
+inline Lanes operator*(Lanes a, const Lanes& b) {
+    for (int l = 0; l < BATCH_WIDTH; l++)
+        a.v[l] *= b.v[l];
+    return a;
+}
+
+inline Lanes operator*(double s, Lanes a) {
+    for (int l = 0; l < BATCH_WIDTH; l++)
+        a.v[l] *= s;
+    return a;
+}
+
+// a += b * c
+inline void MulAdd(Lanes& a, const Lanes& b, const Lanes& c) {
+    for (int l = 0; l < BATCH_WIDTH; l++)
+        a.v[l] += b.v[l] * c.v[l];
+}
+
+}  // end namespace
+
+// The class ShellANCF_Batch evaluates the internal forces of ANCF shell elements in blocks of BATCH_WIDTH elements,
+// with one element per SIMD lane. The Gauss point loops are explicit, with no virtual calls per integration point.
+// All quantities which depend only on the initial configuration (shape functions and derivatives, coefficients of
+// the contravariant transformation, EAS matrices) are computed once, the first time a block is evaluated, and cached
+// in structure-of-arrays form. The layer material properties are gathered at each evaluation, so that changes to the
+// materials take effect as in the scalar path.
+// For given element states, both the internal force and the EAS residual are linear in the EAS parameters:
+//     Fint = F0 + B * alpha
+//     HE = H0 + KALPHA * alpha
+// A single pass over the Gauss points of a layer provides F0, B, H0, and KALPHA, after which the Newton iterations
+// for the EAS parameters are carried out per element, as in ChElementShellANCF::ComputeInternalForces.
+// The results match those of ComputeInternalForces up to round-off.
+class ShellANCF_Batch : public ChElementBatch {
+  public:
+    ShellANCF_Batch() {}
+
+    virtual void AddElement(std::shared_ptr<ChElementBase> element) override;
+    virtual unsigned int GetNumElements() const override { return (unsigned int)m_elements.size(); }
+    virtual int GetNumBlocks() const override { return (int)m_blocks.size(); }
+    virtual void IntLoadResidual_F(int block, ChVectorDynamic<>& R, const double c) override;
+
+  private:
+    // Initial configuration data at one Gauss point.
+    struct GaussPoint {
+        Lanes N[4];      // shape functions for the nodal positions (N(0), N(2), N(4), N(6))
+        Lanes Nx[8];     // shape function derivatives w.r.t. x
+        Lanes Ny[8];     // shape function derivatives w.r.t. y
+        Lanes S_ANS[4];  // ANS shape functions
+        Lanes beta[9];   // coefficients of the contravariant transformation
+        Lanes G[30];     // EAS matrix T0 * M * (detJ0C / detJ0) (6x5, row-major)
+        Lanes d0d0[3];   // initial configuration terms in the in-plane strains
+        Lanes scale;     // detJ0 * GaussScaling * quadrature weight
+    };
+
+    // Initial configuration data for one layer.
+    struct LayerData {
+        GaussPoint gp[8];
+        Lanes E[36];   // matrix of elastic coefficients (6x6, row-major), refreshed at each evaluation
+        Lanes zscale;  // scaling due to the change of integration interval over the layer
+    };
+
+    // Block of elements evaluated together.
+    struct Block {
+        std::vector<ChElementShellANCF*> elements;  // elements in this block
+        std::vector<LayerData> layers;              // initial configuration data (maximum number of layers)
+        bool initialized;                           // true if the initial configuration data was computed
+
+        Lanes d[24];             // current nodal coordinates (8x3, row-major)
+        Lanes ddT[64];           // d * d^T (8x8, row-major)
+        Lanes d_dt[24];          // current nodal velocities
+        Lanes strainANS[8];      // ANS strain
+        Lanes strainANS_D[192];  // ANS strain derivatives (8x24, row-major)
+        Lanes alpha_damp;        // structural damping coefficient
+    };
+
+    /// Compute and cache the initial configuration data for the elements in the given block.
+    void Initialize(Block& block);
+
+    /// Integrate the terms F0 (24), B (24x5, row-major), H0 (5), and KALPHA (5x5, row-major) over the specified layer.
+    void IntegrateLayer(const Block& block, const LayerData& layer, Lanes* F0, Lanes* B, Lanes* H0, Lanes* K);
+
+    std::vector<std::shared_ptr<ChElementShellANCF>> m_elements;
+    std::vector<std::unique_ptr<Block>> m_blocks;
+};
+
+void ShellANCF_Batch::AddElement(std::shared_ptr<ChElementBase> element) {
+    if (m_elements.size() % BATCH_WIDTH == 0) {
+        m_blocks.push_back(std::unique_ptr<Block>(new Block()));
+        m_blocks.back()->initialized = false;
+    }
+    m_elements.push_back(std::static_pointer_cast<ChElementShellANCF>(element));
+    m_blocks.back()->elements.push_back(m_elements.back().get());
+}
+
+void ShellANCF_Batch::Initialize(Block& block) {
+    size_t num_layers = 0;
+    for (auto element : block.elements)
+        num_layers = std::max(num_layers, element->m_numLayers);
+    block.layers.assign(num_layers, LayerData());
+
+    // Gauss points and weights for quadrature of order 2 (as used in ComputeInternalForces)
+    const auto& roots = ChQuadrature::GetStaticTables()->Lroots[1];
+    const auto& weights = ChQuadrature::GetStaticTables()->Weight[1];
+
+    for (int l = 0; l < (int)block.elements.size(); l++) {
+        auto element = block.elements[l];
+        for (size_t kl = 0; kl < element->m_numLayers; kl++) {
+            const auto& elayer = element->m_layers[kl];
+            auto& layer = block.layers[kl];
+
+            double Zc1 = (element->m_GaussZ[kl + 1] - element->m_GaussZ[kl]) / 2;
+            double Zc2 = (element->m_GaussZ[kl + 1] + element->m_GaussZ[kl]) / 2;
+            layer.zscale.v[l] = Zc1;
+
+            int ig = 0;
+            for (int ix = 0; ix < 2; ix++) {
+                for (int iy = 0; iy < 2; iy++) {
+                    for (int iz = 0; iz < 2; iz++) {
+                        double x = roots[ix];
+                        double y = roots[iy];
+                        double z = Zc1 * roots[iz] + Zc2;
+                        double w = weights[ix] * weights[iy] * weights[iz];
+
+                        ChElementShellANCF::ShapeVector N;
+                        element->ShapeFunctions(N, x, y, z);
+
+                        ChElementShellANCF::ShapeVector Nx;
+                        ChElementShellANCF::ShapeVector Ny;
+                        ChElementShellANCF::ShapeVector Nz;
+                        ChMatrixNM<double, 1, 3> Nx_d0;
+                        ChMatrixNM<double, 1, 3> Ny_d0;
+                        ChMatrixNM<double, 1, 3> Nz_d0;
+                        double detJ0 = element->Calc_detJ0(x, y, z, Nx, Ny, Nz, Nx_d0, Ny_d0, Nz_d0);
+
+                        ChMatrixNM<double, 1, 4> S_ANS;
+                        ChMatrixNM<double, 6, 5> M;
+                        element->ShapeFunctionANSbilinearShell(S_ANS, x, y);
+                        element->Basis_M(M, x, y, z);
+
+                        ChVectorN<double, 9> beta;
+                        CalcContravariantCoefficients(elayer.Get_theta(), Nx_d0, Ny_d0, Nz_d0, detJ0, beta);
+
+                        ChMatrixNM<double, 6, 5> G = elayer.Get_T0() * M * (elayer.Get_detJ0C() / detJ0);
+
+                        ChVectorN<double, 8> d0d0Nx = element->m_d0d0T * Nx.transpose();
+                        ChVectorN<double, 8> d0d0Ny = element->m_d0d0T * Ny.transpose();
+
+                        auto& gp = layer.gp[ig++];
+                        for (int i = 0; i < 4; i++) {
+                            gp.N[i].v[l] = N(2 * i);
+                            gp.S_ANS[i].v[l] = S_ANS(i);
+                        }
+                        for (int i = 0; i < 8; i++) {
+                            gp.Nx[i].v[l] = Nx(i);
+                            gp.Ny[i].v[l] = Ny(i);
+                        }
+                        for (int i = 0; i < 9; i++)
+                            gp.beta[i].v[l] = beta(i);
+                        for (int i = 0; i < 30; i++)
+                            gp.G[i].v[l] = G.data()[i];
+                        gp.d0d0[0].v[l] = (Nx * d0d0Nx)(0, 0);
+                        gp.d0d0[1].v[l] = (Ny * d0d0Ny)(0, 0);
+                        gp.d0d0[2].v[l] = (Nx * d0d0Ny)(0, 0);
+                        gp.scale.v[l] = detJ0 * element->m_GaussScaling * w;
+                    }
+                }
+            }
+        }
+    }
+
+    block.initialized = true;
+}
+
+void ShellANCF_Batch::IntegrateLayer(const Block& block,
+                                     const LayerData& layer,
+                                     Lanes* F0,
+                                     Lanes* B,
+                                     Lanes* H0,
+                                     Lanes* K) {
+    for (int k = 0; k < 24; k++)
+        F0[k] = Lanes(0.0);
+    for (int k = 0; k < 120; k++)
+        B[k] = Lanes(0.0);
+    for (int m = 0; m < 5; m++)
+        H0[m] = Lanes(0.0);
+    for (int m = 0; m < 25; m++)
+        K[m] = Lanes(0.0);
+
+    for (const auto& gp : layer.gp) {
+        const Lanes* beta = gp.beta;
+
+        // Transformation matrix for orthotropic material (6x6, row-major)
+        Lanes T[36] = {beta[0] * beta[0],
+                       beta[3] * beta[3],
+                       beta[0] * beta[3],
+                       beta[6] * beta[6],
+                       beta[0] * beta[6],
+                       beta[3] * beta[6],
+                       beta[1] * beta[1],
+                       beta[4] * beta[4],
+                       beta[1] * beta[4],
+                       beta[7] * beta[7],
+                       beta[1] * beta[7],
+                       beta[4] * beta[7],
+                       2.0 * (beta[0] * beta[1]),
+                       2.0 * (beta[3] * beta[4]),
+                       beta[1] * beta[3] + beta[0] * beta[4],
+                       2.0 * (beta[6] * beta[7]),
+                       beta[1] * beta[6] + beta[0] * beta[7],
+                       beta[4] * beta[6] + beta[3] * beta[7],
+                       beta[2] * beta[2],
+                       beta[5] * beta[5],
+                       beta[2] * beta[5],
+                       beta[8] * beta[8],
+                       beta[2] * beta[8],
+                       beta[5] * beta[8],
+                       2.0 * (beta[0] * beta[2]),
+                       2.0 * (beta[3] * beta[5]),
+                       beta[2] * beta[3] + beta[0] * beta[5],
+                       2.0 * (beta[6] * beta[8]),
+                       beta[2] * beta[6] + beta[0] * beta[8],
+                       beta[5] * beta[6] + beta[3] * beta[8],
+                       2.0 * (beta[1] * beta[2]),
+                       2.0 * (beta[4] * beta[5]),
+                       beta[2] * beta[4] + beta[1] * beta[5],
+                       2.0 * (beta[7] * beta[8]),
+                       beta[2] * beta[7] + beta[1] * beta[8],
+                       beta[5] * beta[7] + beta[4] * beta[8]};
+
+        // Strain components (before transformation)
+        Lanes ddNx[8];
+        Lanes ddNy[8];
+        for (int i = 0; i < 8; i++) {
+            ddNx[i] = Lanes(0.0);
+            ddNy[i] = Lanes(0.0);
+            for (int j = 0; j < 8; j++) {
+                MulAdd(ddNx[i], block.ddT[8 * i + j], gp.Nx[j]);
+                MulAdd(ddNy[i], block.ddT[8 * i + j], gp.Ny[j]);
+            }
+        }
+        Lanes NxddNx(0.0);
+        Lanes NyddNy(0.0);
+        Lanes NxddNy(0.0);
+        for (int i = 0; i < 8; i++) {
+            MulAdd(NxddNx, gp.Nx[i], ddNx[i]);
+            MulAdd(NyddNy, gp.Ny[i], ddNy[i]);
+            MulAdd(NxddNy, gp.Nx[i], ddNy[i]);
+        }
+
+        const Lanes* sANS = block.strainANS;
+        Lanes strain_til[6];
+        strain_til[0] = 0.5 * (NxddNx - gp.d0d0[0]);
+        strain_til[1] = 0.5 * (NyddNy - gp.d0d0[1]);
+        strain_til[2] = NxddNy - gp.d0d0[2];
+        strain_til[3] = gp.N[0] * sANS[0] + gp.N[1] * sANS[1] + gp.N[2] * sANS[2] + gp.N[3] * sANS[3];
+        strain_til[4] = gp.S_ANS[2] * sANS[6] + gp.S_ANS[3] * sANS[7];
+        strain_til[5] = gp.S_ANS[0] * sANS[4] + gp.S_ANS[1] * sANS[5];
+
+        // Strain derivatives (6x24, row-major).
+        // Note that, as in ShellANCF_Force, the contribution of the yz component to the zz strain derivative uses
+        // strainD_til(0, 5) for all columns.
+        Lanes Nxd[3];
+        Lanes Nyd[3];
+        for (int j = 0; j < 3; j++) {
+            Nxd[j] = Lanes(0.0);
+            Nyd[j] = Lanes(0.0);
+            for (int i = 0; i < 8; i++) {
+                MulAdd(Nxd[j], gp.Nx[i], block.d[3 * i + j]);
+                MulAdd(Nyd[j], gp.Ny[i], block.d[3 * i + j]);
+            }
+        }
+        Lanes T35 = T[23];
+        Lanes strainD_til05 = T35 * Nxd[2] * gp.Nx[1];
+
+        const Lanes* sANS_D = block.strainANS_D;
+        Lanes strainD[144];
+        for (int i = 0; i < 8; i++) {
+            for (int j = 0; j < 3; j++) {
+                int k = 3 * i + j;
+                Lanes til[6];
+                til[0] = Nxd[j] * gp.Nx[i];
+                til[1] = Nyd[j] * gp.Ny[i];
+                til[2] = Nyd[j] * gp.Nx[i] + Nxd[j] * gp.Ny[i];
+                til[3] = gp.N[0] * sANS_D[k] + gp.N[1] * sANS_D[24 + k] + gp.N[2] * sANS_D[48 + k] +
+                         gp.N[3] * sANS_D[72 + k];
+                til[4] = gp.S_ANS[2] * sANS_D[144 + k] + gp.S_ANS[3] * sANS_D[168 + k];
+                til[5] = gp.S_ANS[0] * sANS_D[96 + k] + gp.S_ANS[1] * sANS_D[120 + k];
+                for (int r = 0; r < 6; r++) {
+                    Lanes val(0.0);
+                    for (int q = 0; q < 6; q++) {
+                        if (r != 3 || q != 5)
+                            MulAdd(val, T[6 * r + q], til[q]);
+                    }
+                    strainD[24 * r + k] = val;
+                }
+                strainD[72 + k] = strainD[72 + k] + strainD_til05;
+            }
+        }
+
+        // Transformed strain, including structural damping (EAS contribution excluded)
+        Lanes strain[6];
+        for (int r = 0; r < 6; r++) {
+            strain[r] = Lanes(0.0);
+            for (int q = 0; q < 6; q++)
+                MulAdd(strain[r], T[6 * r + q], strain_til[q]);
+            Lanes DEPS(0.0);
+            for (int k = 0; k < 24; k++)
+                MulAdd(DEPS, strainD[24 * r + k], block.d_dt[k]);
+            MulAdd(strain[r], DEPS, block.alpha_damp);
+        }
+
+        // Stress (scaled), E * strain * scale, and scaled E * G
+        Lanes Es[6];
+        Lanes EG[30];
+        for (int r = 0; r < 6; r++) {
+            Es[r] = Lanes(0.0);
+            for (int q = 0; q < 6; q++)
+                MulAdd(Es[r], layer.E[6 * r + q], strain[q]);
+            Es[r] *= gp.scale;
+            for (int m = 0; m < 5; m++) {
+                EG[5 * r + m] = Lanes(0.0);
+                for (int q = 0; q < 6; q++)
+                    MulAdd(EG[5 * r + m], layer.E[6 * r + q], gp.G[5 * q + m]);
+                EG[5 * r + m] *= gp.scale;
+            }
+        }
+
+        // Accumulate F0 = strainD^T * E * strain, B = strainD^T * E * G, H0 = G^T * E * strain, and K = G^T * E * G
+        for (int k = 0; k < 24; k++) {
+            for (int r = 0; r < 6; r++) {
+                MulAdd(F0[k], strainD[24 * r + k], Es[r]);
+                for (int m = 0; m < 5; m++)
+                    MulAdd(B[5 * k + m], strainD[24 * r + k], EG[5 * r + m]);
+            }
+        }
+        for (int m = 0; m < 5; m++) {
+            for (int r = 0; r < 6; r++) {
+                MulAdd(H0[m], gp.G[5 * r + m], Es[r]);
+                for (int n = 0; n < 5; n++)
+                    MulAdd(K[5 * m + n], gp.G[5 * r + m], EG[5 * r + n]);
+            }
+        }
+    }
+
+    for (int k = 0; k < 24; k++)
+        F0[k] *= layer.zscale;
+    for (int k = 0; k < 120; k++)
+        B[k] *= layer.zscale;
+    for (int m = 0; m < 5; m++)
+        H0[m] *= layer.zscale;
+    for (int m = 0; m < 25; m++)
+        K[m] *= layer.zscale;
+}
+
+void ShellANCF_Batch::IntLoadResidual_F(int iblock, ChVectorDynamic<>& R, const double c) {
+    Block& block = *m_blocks[iblock];
+    if (!block.initialized)
+        Initialize(block);
+
+    int num_elements = (int)block.elements.size();
+
+    // Update the current configuration of each element (also cached in the element, for use in the Jacobian
+    // calculation) and gather it in the block
+    for (int l = 0; l < num_elements; l++) {
+        auto element = block.elements[l];
+        element->CalcCoordMatrix(element->m_d);
+        element->CalcCoordDerivMatrix(element->m_d_dt);
+        element->m_ddT = element->m_d * element->m_d.transpose();
+        element->CalcStrainANSbilinearShell();
+
+        for (int k = 0; k < 24; k++) {
+            block.d[k].v[l] = element->m_d.data()[k];
+            block.d_dt[k].v[l] = element->m_d_dt(k);
+        }
+        for (int k = 0; k < 64; k++)
+            block.ddT[k].v[l] = element->m_ddT.data()[k];
+        for (int k = 0; k < 8; k++)
+            block.strainANS[k].v[l] = element->m_strainANS(k);
+        for (int k = 0; k < 192; k++)
+            block.strainANS_D[k].v[l] = element->m_strainANS_D.data()[k];
+        block.alpha_damp.v[l] = element->m_Alpha;
+
+        for (size_t kl = 0; kl < element->m_numLayers; kl++) {
+            const auto& E_eps = element->m_layers[kl].GetMaterial()->Get_E_eps();
+            for (int i = 0; i < 36; i++)
+                block.layers[kl].E[i].v[l] = E_eps.data()[i];
+        }
+    }
+
+    ChVectorN<double, 24> Fi[BATCH_WIDTH];
+    for (int l = 0; l < num_elements; l++)
+        Fi[l].setZero();
+
+    Lanes F0[24];
+    Lanes B[120];
+    Lanes H0[5];
+    Lanes K[25];
+
+    for (size_t kl = 0; kl < block.layers.size(); kl++) {
+        const auto& layer = block.layers[kl];
+        IntegrateLayer(block, layer, F0, B, H0, K);
+
+        // Newton iterations for the EAS parameters of each element
+        for (int l = 0; l < num_elements; l++) {
+            auto element = block.elements[l];
+            if (kl >= element->m_numLayers)
+                continue;
+
+            ChMatrixNM<double, 5, 5> KALPHA;
+            for (int m = 0; m < 25; m++)
+                KALPHA.data()[m] = K[m].v[l];
+            ChVectorN<double, 5> H0_l;
+            for (int m = 0; m < 5; m++)
+                H0_l(m) = H0[m].v[l];
+
+            ChVectorN<double, 5> alphaEAS = element->m_alphaEAS[kl];
+            ChVectorN<double, 5> alpha_eval = alphaEAS;
+            for (int count = 0; count < ChElementShellANCF::m_maxIterationsEAS; count++) {
+                // Residual of the EAS nonlinear system at the current EAS parameters
+                alpha_eval = alphaEAS;
+                ChVectorN<double, 5> HE = H0_l + KALPHA * alphaEAS;
+
+                // Check convergence (residual check)
+                double norm_HE = HE.norm();
+                if (norm_HE < ChElementShellANCF::m_toleranceEAS)
+                    break;
+
+                // Calculate increment and update EAS parameters
+                ChVectorN<double, 5> sol = KALPHA.colPivHouseholderQr().solve(HE);
+                alphaEAS -= sol;
+            }
+
+            // Accumulate internal force, evaluated at the EAS parameters of the last residual evaluation
+            for (int k = 0; k < 24; k++) {
+                double Fk = F0[k].v[l];
+                for (int m = 0; m < 5; m++)
+                    Fk += B[5 * k + m].v[l] * alpha_eval(m);
+                Fi[l](k) -= Fk;
+            }
+
+            // Cache alphaEAS and KALPHA for use in Jacobian calculation
+            element->m_alphaEAS[kl] = alphaEAS;
+            element->m_KalphaEAS[kl] = KALPHA;
+        }
+    }
+
+    // Add gravity forces and load into the global vector
+    for (int l = 0; l < num_elements; l++) {
+        auto element = block.elements[l];
+        if (element->m_gravity_on)
+            Fi[l] += element->m_GravForce;
+        for (int in = 0; in < 4; in++) {
+            if (!element->m_nodes[in]->GetFixed())
+                R.segment(element->m_nodes[in]->NodeGetOffset_w(), 6) += c * Fi[l].segment(6 * in, 6);
+        }
+    }
+}
+
+std::shared_ptr<ChElementBatch> ChElementShellANCF::CreateBatch() const {
+    return chrono_types::make_shared<ShellANCF_Batch>();
+}
+
 // -----------------------------------------------------------------------------
 // Jacobians of internal forces
 // -----------------------------------------------------------------------------
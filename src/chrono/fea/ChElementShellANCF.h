@@ -90,6 +90,7 @@ class ChApi ChElementShellANCF : public ChElementShell, public ChLoadableUV, pub
         friend class ChElementShellANCF;
         friend class ShellANCF_Force;
         friend class ShellANCF_Jacobian;
+        friend class ShellANCF_Batch;
     };
 
     /// Get the number of nodes used by this element.
@@ -210,6 +211,10 @@ class ChApi ChElementShellANCF : public ChElementShell, public ChLoadableUV, pub
     /// (E.g. the actual position of nodes is not in relaxed reference position) and set values in the Fi vector.
     virtual void ComputeInternalForces(ChVectorDynamic<>& Fi) override;
 
+    /// Create an object for the batched evaluation of the internal forces of ANCF shell elements.
+    /// Elements in a batch are evaluated in blocks, one element per SIMD lane.
+    virtual std::shared_ptr<ChElementBatch> CreateBatch() const override;
+
     /// Update the state of this element.
     virtual void Update() override;
 
@@ -389,6 +394,7 @@ class ChApi ChElementShellANCF : public ChElementShell, public ChLoadableUV, pub
     friend class ShellANCF_Gravity;
     friend class ShellANCF_Force;
     friend class ShellANCF_Jacobian;
+    friend class ShellANCF_Batch;
 };
 
 /// @} fea_elements
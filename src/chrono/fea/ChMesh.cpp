@@ -18,6 +18,9 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <map>
+#include <typeindex>
+#include <unordered_map>
 
 #include "chrono/core/ChMath.h"
 #include "chrono/physics/ChLoad.h"
@@ -28,6 +31,7 @@
 #include "chrono/fea/ChMesh.h"
 #include "chrono/fea/ChNodeFEAxyz.h"
 #include "chrono/fea/ChNodeFEAxyzrot.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 namespace fea {
@@ -47,6 +51,9 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
 
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
+
+    coloring_valid = false;
+    use_batches = other.use_batches;
 }
 
 void ChMesh::SetupInitial() {
@@ -65,6 +72,9 @@ void ChMesh::SetupInitial() {
         //    - precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
     }
+
+    // Element batches cache data for the initial configuration; force their re-creation
+    coloring_valid = false;
 }
 
 void ChMesh::Relax() {
@@ -94,6 +104,7 @@ void ChMesh::AddNode(std::shared_ptr<ChNodeFEAbase> m_node) {
 
 void ChMesh::AddElement(std::shared_ptr<ChElementBase> m_elem) {
     velements.push_back(m_elem);
+    coloring_valid = false;
 
     // If the mesh is already added to a system, mark the system uninitialized and out-of-date
     if (system) {
@@ -105,6 +116,7 @@ void ChMesh::AddElement(std::shared_ptr<ChElementBase> m_elem) {
 void ChMesh::ClearElements() {
     velements.clear();
     vcontactsurfaces.clear();
+    coloring_valid = false;
 
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
@@ -116,6 +128,7 @@ void ChMesh::ClearNodes() {
     velements.clear();
     vnodes.clear();
     vcontactsurfaces.clear();
+    coloring_valid = false;
 
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
@@ -152,11 +165,92 @@ void ChMesh::Setup() {
             n_dofs_w += vnodes[i]->Get_ndof_w();
         }
     }
+
+    // Recompute the element coloring only after a change in the mesh topology
+    ColorElements();
+}
+
+// Greedy coloring of the element graph (two elements are adjacent if they share a node). Fixed nodes are also
+// considered, so that the coloring remains valid if nodes are later fixed or released.
+void ChMesh::ColorElements() {
+    if (coloring_valid && color_elements.size() == velements.size())
+        return;
+
+    std::unordered_map<ChNodeFEAbase*, std::vector<unsigned int>> node_colors;  // colors of elements at each node
+    std::vector<unsigned int> element_color(velements.size());
+    std::vector<unsigned int> color_count;  // number of elements of each color
+    std::vector<bool> used;
+
+    for (size_t ie = 0; ie < velements.size(); ie++) {
+        auto& element = velements[ie];
+        int nnodes = element->GetNnodes();
+
+        // Flag the colors of all elements already colored which share a node with this element
+        used.assign(color_count.size() + 1, false);
+        for (int in = 0; in < nnodes; in++) {
+            for (auto c : node_colors[element->GetNodeN(in).get()])
+                used[c] = true;
+        }
+
+        // Pick the first available color
+        unsigned int color = 0;
+        while (used[color])
+            color++;
+        if (color == color_count.size())
+            color_count.push_back(0);
+        color_count[color]++;
+        element_color[ie] = color;
+
+        for (int in = 0; in < nnodes; in++)
+            node_colors[element->GetNodeN(in).get()].push_back(color);
+    }
+
+    // Group the element indices by color. Within each color group, elements evaluated in batches (grouped by element
+    // type) are listed first, followed by the elements evaluated individually.
+    size_t num_colors = color_count.size();
+    std::vector<std::map<std::type_index, std::shared_ptr<ChElementBatch>>> batches(num_colors);
+    std::vector<std::vector<unsigned int>> batched(num_colors);
+    std::vector<std::vector<unsigned int>> unbatched(num_colors);
+    for (size_t ie = 0; ie < velements.size(); ie++) {
+        auto color = element_color[ie];
+        std::shared_ptr<ChElementBatch> batch;
+        if (use_batches) {
+            auto& element = *velements[ie];
+            auto& type_batch = batches[color][std::type_index(typeid(element))];
+            if (!type_batch)
+                type_batch = element.CreateBatch();
+            batch = type_batch;
+        }
+        if (batch) {
+            batch->AddElement(velements[ie]);
+            batched[color].push_back(static_cast<unsigned int>(ie));
+        } else {
+            unbatched[color].push_back(static_cast<unsigned int>(ie));
+        }
+    }
+
+    color_elements.clear();
+    color_offsets.assign(num_colors + 1, 0);
+    color_unbatched.assign(num_colors, 0);
+    color_batches.assign(num_colors, {});
+    for (size_t c = 0; c < num_colors; c++) {
+        color_elements.insert(color_elements.end(), batched[c].begin(), batched[c].end());
+        color_unbatched[c] = static_cast<unsigned int>(color_elements.size());
+        color_elements.insert(color_elements.end(), unbatched[c].begin(), unbatched[c].end());
+        color_offsets[c + 1] = static_cast<unsigned int>(color_elements.size());
+        for (auto& type_batch : batches[c]) {
+            if (type_batch.second)
+                color_batches[c].push_back(type_batch.second);
+        }
+    }
+
+    coloring_valid = true;
 }
 
 // Updates all time-dependant variables, if any...
 // Ex: maybe the elasticity can increase in time, etc.
 void ChMesh::Update(double m_time, bool update_assets) {
+    CH_TRACE_ZONE("ChMesh::Update");
     // Parent class update
     ChIndexedNodes::Update(m_time, update_assets);
 
@@ -268,6 +362,7 @@ void ChMesh::IntStateIncrement(const unsigned int off_x,
 }
 
 void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
+    CH_TRACE_ZONE("ChMesh::IntLoadResidual_F");
     // nodes applied forces
     unsigned int local_off_v = 0;
     for (unsigned int j = 0; j < vnodes.size(); j++) {
@@ -277,24 +372,39 @@ void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, con
         }
     }
 
+    ColorElements();
     int nthreads = GetSystem()->nthreads_chrono;
+    int ncolors = (int)color_offsets.size() - 1;
 
     // elements internal forces
+    // Elements of the same color do not share nodes, so they can write to R concurrently without synchronization.
+    // Blocks of elements in batches are evaluated first, followed by the elements processed individually.
     timer_internal_forces.start();
-    //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
-#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+#pragma omp parallel num_threads(nthreads)
+    for (int color = 0; color < ncolors; color++) {
+        for (auto& batch : color_batches[color]) {
+#pragma omp for schedule(dynamic, 1) nowait
+            for (int ib = 0; ib < batch->GetNumBlocks(); ib++) {
+                batch->IntLoadResidual_F(ib, R, c);
+            }
+        }
+#pragma omp for schedule(dynamic, 4)
+        for (int i = (int)color_unbatched[color]; i < (int)color_offsets[color + 1]; i++) {
+            velements[color_elements[i]]->EleIntLoadResidual_F(R, c);
+        }
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
 
     // elements gravity forces
     if (automatic_gravity_load) {
-        //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
-#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        for (int ie = 0; ie < velements.size(); ie++) {
-            velements[ie]->EleIntLoadResidual_F_gravity(R, GetSystem()->Get_G_acc(), c);
+        ChVector<> G_acc = GetSystem()->Get_G_acc();
+#pragma omp parallel num_threads(nthreads)
+        for (int color = 0; color < ncolors; color++) {
+#pragma omp for schedule(dynamic, 4)
+            for (int i = (int)color_offsets[color]; i < (int)color_offsets[color + 1]; i++) {
+                velements[color_elements[i]]->EleIntLoadResidual_F_gravity(R, G_acc, c);
+            }
         }
     }
 
@@ -348,6 +458,7 @@ void ChMesh::IntLoadResidual_Mv(const unsigned int off,      ///< offset in R re
                                 const ChVectorDynamic<>& w,  ///< the w vector
                                 const double c               ///< a scaling factor
                                 ) {
+    CH_TRACE_ZONE("ChMesh::IntLoadResidual_Mv");
     // nodal masses
     unsigned int local_off_v = 0;
     for (unsigned int j = 0; j < vnodes.size(); j++) {
@@ -358,6 +469,8 @@ void ChMesh::IntLoadResidual_Mv(const unsigned int off,      ///< offset in R re
     }
 
     // internal masses
+    // Processed serially: element mass matrix evaluations (ComputeMmatrixGlobal, often implemented through
+    // ComputeKRMmatricesGlobal) are not required to be safe for concurrent calls.
     for (unsigned int ie = 0; ie < velements.size(); ie++) {
         velements[ie]->EleIntLoadResidual_Mv(R, w, c);
     }
@@ -399,6 +512,7 @@ void ChMesh::InjectKRMmatrices(ChSystemDescriptor& mdescriptor) {
 }
 
 void ChMesh::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
+    CH_TRACE_ZONE("ChMesh::KRMmatricesLoad");
     int nthreads = GetSystem()->nthreads_chrono;
 
     timer_KRMload.start();
@@ -57,6 +57,13 @@ class ChApi ChMesh : public ChIndexedNodes {
     int ncalls_internal_forces;
     int ncalls_KRMload;
 
+    std::vector<unsigned int> color_elements;   ///< element indices, grouped by color
+    std::vector<unsigned int> color_offsets;    ///< start of each color group in color_elements
+    std::vector<unsigned int> color_unbatched;  ///< start of the elements not in a batch, in each color group
+    std::vector<std::vector<std::shared_ptr<ChElementBatch>>> color_batches;  ///< element batches of each color
+    bool coloring_valid;                        ///< false if the element coloring must be recomputed
+    bool use_batches;                           ///< if true, use batched evaluation of internal forces
+
   public:
     ChMesh()
         : n_dofs(0),
@@ -64,7 +71,9 @@ class ChApi ChMesh : public ChIndexedNodes {
           automatic_gravity_load(true),
           num_points_gravity(1),
           ncalls_internal_forces(0),
-          ncalls_KRMload(0) {}
+          ncalls_KRMload(0),
+          coloring_valid(false),
+          use_batches(true) {}
     ChMesh(const ChMesh& other);
     ~ChMesh() {}
 
@@ -94,6 +103,27 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Get the number of elements in the mesh.
     unsigned int GetNelements() { return (unsigned int)velements.size(); }
 
+    /// Get the number of element colors.
+    /// Elements are partitioned in color groups such that elements of the same color do not share any node. Elements
+    /// in a color group are processed in parallel, without synchronization, when loading internal and gravity forces
+    /// in the global residual. The coloring is recomputed during Setup after any change in the mesh topology (adding
+    /// or removing nodes or elements).
+    unsigned int GetNumElementColors() const { return coloring_valid ? (unsigned int)color_offsets.size() - 1 : 0; }
+
+    /// Get the indices (in the array of elements) of the elements with the specified color.
+    std::vector<unsigned int> GetElementColorGroup(unsigned int color) const {
+        return std::vector<unsigned int>(color_elements.begin() + color_offsets[color],
+                                         color_elements.begin() + color_offsets[color + 1]);
+    }
+
+    /// Enable/disable the batched evaluation of element internal forces (default: true).
+    /// If enabled, elements which support it (see ChElementBase::CreateBatch) are grouped in batches of elements of
+    /// the same type and color, and their internal forces are evaluated together (e.g., with SIMD instructions).
+    void SetElementBatching(bool val) {
+        use_batches = val;
+        coloring_valid = false;
+    }
+
     virtual int GetDOF() override { return n_dofs; }
     virtual int GetDOF_w() override { return n_dofs_w; }
 
@@ -271,6 +301,10 @@ class ChApi ChMesh : public ChIndexedNodes {
     virtual void InjectVariables(ChSystemDescriptor& mdescriptor) override;
 
   private:
+    /// Partition the mesh elements in groups of elements that do not share nodes (greedy graph coloring).
+    /// The coloring is recomputed only if it was invalidated by a change in the mesh topology.
+    void ColorElements();
+
     /// Initial setup (before analysis).
     /// This function is called from ChSystem::SetupInitial, marking a point where system
     /// construction is completed.
@@ -52,7 +52,8 @@ class ChApi ChGeometry {
         ROUNDED_CONE,
         TRIANGLEMESH,
         TRIANGLEMESH_CONNECTED,
-        TRIANGLEMESH_SOUP
+        TRIANGLEMESH_SOUP,
+        HEIGHTFIELD
     };
 
   public:
@@ -0,0 +1,317 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+#include "chrono/geometry/ChHeightField.h"
+
+namespace chrono {
+namespace geometry {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChHeightField)
+
+ChHeightField::ChHeightField()
+    : m_nx(0), m_ny(0), m_size_x(0), m_size_y(0), m_dx(0), m_dy(0), m_hmin(0), m_hmax(0) {}
+
+ChHeightField::ChHeightField(int nx, int ny, double size_x, double size_y, const std::vector<double>& heights) {
+    SetData(nx, ny, size_x, size_y, heights);
+}
+
+ChHeightField::ChHeightField(const ChHeightField& source) : ChGeometry(source) {
+    m_nx = source.m_nx;
+    m_ny = source.m_ny;
+    m_size_x = source.m_size_x;
+    m_size_y = source.m_size_y;
+    m_heights = source.m_heights;
+    Setup();
+}
+
+void ChHeightField::SetData(int nx, int ny, double size_x, double size_y, const std::vector<double>& heights) {
+    assert(nx > 1 && ny > 1);
+    assert(heights.size() == (size_t)nx * ny);
+    m_nx = nx;
+    m_ny = ny;
+    m_size_x = size_x;
+    m_size_y = size_y;
+    m_heights = heights;
+    Setup();
+}
+
+void ChHeightField::Setup() {
+    m_dx = (m_nx > 1) ? m_size_x / (m_nx - 1) : 0;
+    m_dy = (m_ny > 1) ? m_size_y / (m_ny - 1) : 0;
+    if (m_heights.empty()) {
+        m_hmin = 0;
+        m_hmax = 0;
+        return;
+    }
+    auto range = std::minmax_element(m_heights.begin(), m_heights.end());
+    m_hmin = *range.first;
+    m_hmax = *range.second;
+}
+
+ChVector<> ChHeightField::GetVertex(int i, int j) const {
+    return ChVector<>(i * m_dx - 0.5 * m_size_x, j * m_dy - 0.5 * m_size_y, m_heights[i + m_nx * j]);
+}
+
+bool ChHeightField::FindCell(double x, double y, int& i, int& j) const {
+    x += 0.5 * m_size_x;
+    y += 0.5 * m_size_y;
+    if (m_heights.empty() || x < 0 || x > m_size_x || y < 0 || y > m_size_y)
+        return false;
+
+    // Points on the last grid line belong to the last cell
+    i = std::min((int)(x / m_dx), m_nx - 2);
+    j = std::min((int)(y / m_dy), m_ny - 2);
+    return true;
+}
+
+bool ChHeightField::GetHeight(double x, double y, double& height, ChVector<>& normal) const {
+    int i, j;
+    if (!FindCell(x, y, i, j))
+        return false;
+
+    double u = (x + 0.5 * m_size_x) / m_dx - i;
+    double v = (y + 0.5 * m_size_y) / m_dy - j;
+
+    double h00 = m_heights[i + m_nx * j];
+    double h10 = m_heights[i + 1 + m_nx * j];
+    double h01 = m_heights[i + m_nx * (j + 1)];
+    double h11 = m_heights[i + 1 + m_nx * (j + 1)];
+
+    if (u >= v) {
+        // triangle (i,j), (i+1,j), (i+1,j+1)
+        height = h00 + u * (h10 - h00) + v * (h11 - h10);
+        normal = ChVector<>(-(h10 - h00) * m_dy, -(h11 - h10) * m_dx, m_dx * m_dy);
+    } else {
+        // triangle (i,j), (i+1,j+1), (i,j+1)
+        height = h00 + v * (h01 - h00) + u * (h11 - h01);
+        normal = ChVector<>(-(h11 - h01) * m_dy, -(h01 - h00) * m_dx, m_dx * m_dy);
+    }
+    normal.Normalize();
+
+    return true;
+}
+
+// Intersect a segment with a triangle (Moller-Trumbore algorithm, triangle seen from both sides).
+static bool RayHitTriangle(const ChVector<>& from,
+                           const ChVector<>& dir,
+                           const ChVector<>& v0,
+                           const ChVector<>& v1,
+                           const ChVector<>& v2,
+                           double& t) {
+    // Tolerance on the barycentric coordinates (so that rays through a triangle edge are not missed)
+    const double eps = 1e-10;
+
+    ChVector<> e1 = v1 - v0;
+    ChVector<> e2 = v2 - v0;
+    ChVector<> p = Vcross(dir, e2);
+    double det = Vdot(e1, p);
+    if (std::abs(det) < std::numeric_limits<double>::min())
+        return false;
+    double inv_det = 1 / det;
+
+    ChVector<> s = from - v0;
+    double u = Vdot(s, p) * inv_det;
+    if (u < -eps || u > 1 + eps)
+        return false;
+    ChVector<> q = Vcross(s, e1);
+    double v = Vdot(dir, q) * inv_det;
+    if (v < -eps || u + v > 1 + eps)
+        return false;
+
+    t = Vdot(e2, q) * inv_det;
+    return t >= 0 && t <= 1;
+}
+
+bool ChHeightField::RayHitCell(int i,
+                               int j,
+                               const ChVector<>& from,
+                               const ChVector<>& dir,
+                               ChVector<>& normal,
+                               double& fraction) const {
+    ChVector<> v00 = GetVertex(i, j);
+    ChVector<> v10 = GetVertex(i + 1, j);
+    ChVector<> v01 = GetVertex(i, j + 1);
+    ChVector<> v11 = GetVertex(i + 1, j + 1);
+
+    bool hit = false;
+    double t;
+    if (RayHitTriangle(from, dir, v00, v10, v11, t)) {
+        fraction = t;
+        normal = Vcross(v10 - v00, v11 - v00);
+        hit = true;
+    }
+    if (RayHitTriangle(from, dir, v00, v11, v01, t) && (!hit || t < fraction)) {
+        fraction = t;
+        normal = Vcross(v11 - v00, v01 - v00);
+        hit = true;
+    }
+
+    if (hit)
+        normal.Normalize();
+    return hit;
+}
+
+bool ChHeightField::RayHit(const ChVector<>& from,
+                           const ChVector<>& to,
+                           ChVector<>& point,
+                           ChVector<>& normal,
+                           double& fraction) const {
+    if (m_heights.empty())
+        return false;
+
+    ChVector<> dir = to - from;
+
+    // Clip the segment to the grid extent (in the XY plane)
+    double t0 = 0;
+    double t1 = 1;
+    double half[2] = {0.5 * m_size_x, 0.5 * m_size_y};
+    for (int k = 0; k < 2; k++) {
+        if (dir[k] == 0) {
+            if (from[k] < -half[k] || from[k] > half[k])
+                return false;
+            continue;
+        }
+        double ta = (-half[k] - from[k]) / dir[k];
+        double tb = (+half[k] - from[k]) / dir[k];
+        if (ta > tb)
+            std::swap(ta, tb);
+        t0 = std::max(t0, ta);
+        t1 = std::min(t1, tb);
+    }
+    if (t0 > t1)
+        return false;
+
+    // Cell of the first point
+    ChVector<> start = from + t0 * dir;
+    int i = std::max(0, std::min((int)((start.x() + half[0]) / m_dx), m_nx - 2));
+    int j = std::max(0, std::min((int)((start.y() + half[1]) / m_dy), m_ny - 2));
+
+    // Traverse the cells crossed by the segment, in order (2D DDA)
+    const double inf = std::numeric_limits<double>::infinity();
+    int step_i = (dir.x() > 0) ? 1 : -1;
+    int step_j = (dir.y() > 0) ? 1 : -1;
+    double tmax_i = inf;
+    double tmax_j = inf;
+    double tdelta_i = inf;
+    double tdelta_j = inf;
+    if (dir.x() != 0) {
+        double x = (dir.x() > 0 ? i + 1 : i) * m_dx - half[0];
+        tmax_i = (x - from.x()) / dir.x();
+        tdelta_i = m_dx / std::abs(dir.x());
+    }
+    if (dir.y() != 0) {
+        double y = (dir.y() > 0 ? j + 1 : j) * m_dy - half[1];
+        tmax_j = (y - from.y()) / dir.y();
+        tdelta_j = m_dy / std::abs(dir.y());
+    }
+
+    while (true) {
+        // The triangles of a cell only intersect the segment within the portion crossing that cell.
+        // As such, the first cell with an intersection provides the closest intersection.
+        if (RayHitCell(i, j, from, dir, normal, fraction)) {
+            point = from + fraction * dir;
+            if (normal.z() < 0)
+                normal = -normal;
+            return true;
+        }
+
+        if (tmax_i < tmax_j) {
+            if (tmax_i > t1)
+                break;
+            i += step_i;
+            if (i < 0 || i > m_nx - 2)
+                break;
+            tmax_i += tdelta_i;
+        } else {
+            if (tmax_j > t1)
+                break;
+            j += step_j;
+            if (j < 0 || j > m_ny - 2)
+                break;
+            tmax_j += tdelta_j;
+        }
+    }
+
+    return false;
+}
+
+void ChHeightField::GetBoundingBox(double& xmin,
+                                   double& xmax,
+                                   double& ymin,
+                                   double& ymax,
+                                   double& zmin,
+                                   double& zmax,
+                                   ChMatrix33<>* Rot) const {
+    if (!Rot) {
+        xmin = -0.5 * m_size_x;
+        xmax = +0.5 * m_size_x;
+        ymin = -0.5 * m_size_y;
+        ymax = +0.5 * m_size_y;
+        zmin = m_hmin;
+        zmax = m_hmax;
+        return;
+    }
+
+    // Bounding box of the corners of the box enclosing the grid, in the rotated frame
+    xmin = ymin = zmin = +std::numeric_limits<double>::max();
+    xmax = ymax = zmax = -std::numeric_limits<double>::max();
+    for (int k = 0; k < 8; k++) {
+        ChVector<> p((k & 1) ? 0.5 * m_size_x : -0.5 * m_size_x,  //
+                     (k & 2) ? 0.5 * m_size_y : -0.5 * m_size_y,  //
+                     (k & 4) ? m_hmax : m_hmin);
+        ChVector<> q = Rot->transpose() * p;
+        xmin = std::min(xmin, q.x());
+        xmax = std::max(xmax, q.x());
+        ymin = std::min(ymin, q.y());
+        ymax = std::max(ymax, q.y());
+        zmin = std::min(zmin, q.z());
+        zmax = std::max(zmax, q.z());
+    }
+}
+
+void ChHeightField::ArchiveOUT(ChArchiveOut& marchive) {
+    // version number
+    marchive.VersionWrite<ChHeightField>();
+    // serialize parent class
+    ChGeometry::ArchiveOUT(marchive);
+    // serialize all member data:
+    marchive << CHNVP(m_nx);
+    marchive << CHNVP(m_ny);
+    marchive << CHNVP(m_size_x);
+    marchive << CHNVP(m_size_y);
+    marchive << CHNVP(m_heights);
+}
+
+void ChHeightField::ArchiveIN(ChArchiveIn& marchive) {
+    // version number
+    /*int version =*/ marchive.VersionRead<ChHeightField>();
+    // deserialize parent class
+    ChGeometry::ArchiveIN(marchive);
+    // stream in all member data:
+    marchive >> CHNVP(m_nx);
+    marchive >> CHNVP(m_ny);
+    marchive >> CHNVP(m_size_x);
+    marchive >> CHNVP(m_size_y);
+    marchive >> CHNVP(m_heights);
+    Setup();
+}
+
+}  // end namespace geometry
+}  // end namespace chrono
@@ -0,0 +1,147 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+
+#ifndef CHC_HEIGHTFIELD_H
+#define CHC_HEIGHTFIELD_H
+
+#include <vector>
+
+#include "chrono/geometry/ChGeometry.h"
+
+namespace chrono {
+namespace geometry {
+
+/// @addtogroup chrono_geometry
+/// @{
+
+/// A height-field surface, defined by the heights (along Z) at the nodes of a regular grid in the XY plane.
+/// The grid has nx x ny nodes, covers a rectangle of size_x x size_y, and is centered at the origin. Heights are
+/// stored row after row (node (i,j) at index i + nx * j), with the first row at y = -size_y/2.
+/// Each grid cell is split in two triangles along the diagonal from node (i,j) to node (i+1,j+1).
+/// Since the grid is regular, the cell below any point is found in constant time.
+class ChApi ChHeightField : public ChGeometry {
+  public:
+    ChHeightField();
+    ChHeightField(int nx, int ny, double size_x, double size_y, const std::vector<double>& heights);
+    ChHeightField(const ChHeightField& source);
+    ~ChHeightField() {}
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChHeightField* Clone() const override { return new ChHeightField(*this); }
+
+    virtual GeometryType GetClassType() const override { return HEIGHTFIELD; }
+
+    /// Set the grid and the node heights (nx * ny values, row after row).
+    void SetData(int nx, int ny, double size_x, double size_y, const std::vector<double>& heights);
+
+    /// Get the number of grid nodes in the X direction.
+    int GetNumVerticesX() const { return m_nx; }
+
+    /// Get the number of grid nodes in the Y direction.
+    int GetNumVerticesY() const { return m_ny; }
+
+    /// Get the grid length in the X direction.
+    double GetSizeX() const { return m_size_x; }
+
+    /// Get the grid length in the Y direction.
+    double GetSizeY() const { return m_size_y; }
+
+    /// Get the grid spacing in the X direction.
+    double GetSpacingX() const { return m_dx; }
+
+    /// Get the grid spacing in the Y direction.
+    double GetSpacingY() const { return m_dy; }
+
+    /// Get the minimum node height.
+    double GetMinHeight() const { return m_hmin; }
+
+    /// Get the maximum node height.
+    double GetMaxHeight() const { return m_hmax; }
+
+    /// Get the height at the grid node (i,j).
+    double GetVertexHeight(int i, int j) const { return m_heights[i + m_nx * j]; }
+
+    /// Get the location of the grid node (i,j).
+    ChVector<> GetVertex(int i, int j) const;
+
+    /// Get the node heights.
+    const std::vector<double>& GetHeights() const { return m_heights; }
+
+    /// Find the grid cell containing the point (x,y).
+    /// Return false if the point is outside the grid.
+    bool FindCell(double x, double y, int& i, int& j) const;
+
+    /// Calculate the surface height and (upward) normal below the point (x,y).
+    /// Return false if the point is outside the grid.
+    bool GetHeight(double x, double y, double& height, ChVector<>& normal) const;
+
+    /// Intersect the segment from 'from' to 'to' with the surface.
+    /// Only the cells crossed by the projection of the segment on the XY plane are tested, in order along the segment.
+    /// Return true if an intersection was found, in which case the closest intersection point, the (upward) surface
+    /// normal at that point, and the fraction of the segment length are returned.
+    bool RayHit(const ChVector<>& from,
+                const ChVector<>& to,
+                ChVector<>& point,
+                ChVector<>& normal,
+                double& fraction) const;
+
+    virtual void GetBoundingBox(double& xmin,
+                                double& xmax,
+                                double& ymin,
+                                double& ymax,
+                                double& zmin,
+                                double& zmax,
+                                ChMatrix33<>* Rot = nullptr) const override;
+
+    /// This is a surface
+    virtual int GetManifoldDimension() const override { return 2; }
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOUT(ChArchiveOut& marchive) override;
+
+    /// Method to allow de-serialization of transient data from archives.
+    virtual void ArchiveIN(ChArchiveIn& marchive) override;
+
+  private:
+    /// Intersect the segment with the two triangles of the cell (i,j).
+    bool RayHitCell(int i,
+                    int j,
+                    const ChVector<>& from,
+                    const ChVector<>& dir,
+                    ChVector<>& normal,
+                    double& fraction) const;
+
+    /// Update the grid spacing and the height range.
+    void Setup();
+
+    int m_nx;                       ///< number of nodes in X direction
+    int m_ny;                       ///< number of nodes in Y direction
+    double m_size_x;                ///< grid length in X direction
+    double m_size_y;                ///< grid length in Y direction
+    double m_dx;                    ///< grid spacing in X direction
+    double m_dy;                    ///< grid spacing in Y direction
+    double m_hmin;                  ///< minimum node height
+    double m_hmax;                  ///< maximum node height
+    std::vector<double> m_heights;  ///< node heights (row after row)
+};
+
+/// @} chrono_geometry
+
+}  // end namespace geometry
+
+CH_CLASS_VERSION(geometry::ChHeightField, 0)
+
+}  // end namespace chrono
+
+#endif
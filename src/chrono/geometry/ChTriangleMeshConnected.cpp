@@ -40,6 +40,7 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <map>
 #include <unordered_map>
@@ -943,6 +944,171 @@ bool ChTriangleMeshConnected::LoadWavefrontMesh(std::string filename, bool load_
     return true;
 }
 
+// -----------------------------------------------------------------------------
+// Binary mesh files
+
+// Header of a binary mesh file.
+// The header is followed by the mesh arrays, in the order of the 'sizes' field, each starting at an 8-byte aligned
+// offset. Files written on a host with different endianness or by a different version are rejected (not converted).
+struct BinaryMeshHeader {
+    char magic[8];        // "CHMESH" (zero padded)
+    uint32_t version;     // file format version
+    uint32_t byte_order;  // 0x01020304, as stored by the writing host
+    uint64_t key;         // user-provided key (e.g., hash of the source file)
+    uint64_t sizes[8];    // numbers of vertices, normals, UVs, colors, and of vertex, normal, UV, color index triplets
+};
+
+static const char* binary_mesh_magic = "CHMESH";
+static const uint32_t binary_mesh_version = 1;
+static const uint32_t binary_mesh_byte_order = 0x01020304;
+
+static_assert(sizeof(ChVector<double>) == 3 * sizeof(double), "unexpected ChVector<double> layout");
+static_assert(sizeof(ChVector<float>) == 3 * sizeof(float), "unexpected ChVector<float> layout");
+static_assert(sizeof(ChVector<int>) == 3 * sizeof(int), "unexpected ChVector<int> layout");
+
+static size_t BinaryMeshPadding(size_t num_bytes) {
+    return (8 - num_bytes % 8) % 8;
+}
+
+template <typename T>
+static void WriteBinaryMeshArray(std::ofstream& ofile, const std::vector<T>& v) {
+    static const char padding[8] = {0};
+    size_t num_bytes = v.size() * sizeof(T);
+    ofile.write(reinterpret_cast<const char*>(v.data()), num_bytes);
+    ofile.write(padding, BinaryMeshPadding(num_bytes));
+}
+
+template <typename T>
+static bool ReadBinaryMeshArray(std::ifstream& ifile, uint64_t size, std::vector<T>& v) {
+    char padding[8];
+    size_t num_bytes = size * sizeof(T);
+    v.resize(size);
+    ifile.read(reinterpret_cast<char*>(v.data()), num_bytes);
+    ifile.read(padding, BinaryMeshPadding(num_bytes));
+    return ifile.good();
+}
+
+// FNV-1a hash of the contents of the specified file.
+static bool HashFile(const std::string& filename, uint64_t& hash) {
+    std::ifstream ifile(filename, std::ios::binary);
+    if (!ifile.good())
+        return false;
+
+    hash = 14695981039346656037ULL;
+    std::vector<char> buffer(1 << 20);
+    while (ifile) {
+        ifile.read(buffer.data(), buffer.size());
+        std::streamsize n = ifile.gcount();
+        for (std::streamsize i = 0; i < n; i++) {
+            hash ^= static_cast<unsigned char>(buffer[i]);
+            hash *= 1099511628211ULL;
+        }
+    }
+
+    return true;
+}
+
+bool ChTriangleMeshConnected::WriteBinaryMesh(const std::string& filename, uint64_t key) const {
+    std::ofstream ofile(filename, std::ios::binary);
+    if (!ofile.good())
+        return false;
+
+    BinaryMeshHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::strncpy(header.magic, binary_mesh_magic, sizeof(header.magic));
+    header.version = binary_mesh_version;
+    header.byte_order = binary_mesh_byte_order;
+    header.key = key;
+    header.sizes[0] = m_vertices.size();
+    header.sizes[1] = m_normals.size();
+    header.sizes[2] = m_UV.size();
+    header.sizes[3] = m_colors.size();
+    header.sizes[4] = m_face_v_indices.size();
+    header.sizes[5] = m_face_n_indices.size();
+    header.sizes[6] = m_face_uv_indices.size();
+    header.sizes[7] = m_face_col_indices.size();
+    ofile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    WriteBinaryMeshArray(ofile, m_vertices);
+    WriteBinaryMeshArray(ofile, m_normals);
+    WriteBinaryMeshArray(ofile, m_UV);
+    WriteBinaryMeshArray(ofile, m_colors);
+    WriteBinaryMeshArray(ofile, m_face_v_indices);
+    WriteBinaryMeshArray(ofile, m_face_n_indices);
+    WriteBinaryMeshArray(ofile, m_face_uv_indices);
+    WriteBinaryMeshArray(ofile, m_face_col_indices);
+
+    return ofile.good();
+}
+
+bool ChTriangleMeshConnected::LoadBinaryMesh(const std::string& filename, uint64_t key) {
+    std::ifstream ifile(filename, std::ios::binary | std::ios::ate);
+    if (!ifile.good())
+        return false;
+    uint64_t file_size = (uint64_t)ifile.tellg();
+    ifile.seekg(0);
+
+    BinaryMeshHeader header;
+    if (file_size < sizeof(header) || !ifile.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        return false;
+    if (std::strncmp(header.magic, binary_mesh_magic, sizeof(header.magic)) != 0 ||
+        header.version != binary_mesh_version || header.byte_order != binary_mesh_byte_order || header.key != key)
+        return false;
+
+    // Check the array sizes against the file size (truncated or corrupted file)
+    const size_t elem_size[8] = {sizeof(ChVector<double>), sizeof(ChVector<double>), sizeof(ChVector<double>),
+                                 sizeof(ChVector<float>),  sizeof(ChVector<int>),    sizeof(ChVector<int>),
+                                 sizeof(ChVector<int>),    sizeof(ChVector<int>)};
+    uint64_t expected_size = sizeof(header);
+    for (int i = 0; i < 8; i++) {
+        if (header.sizes[i] > file_size / elem_size[i])
+            return false;
+        expected_size += header.sizes[i] * elem_size[i] + BinaryMeshPadding(header.sizes[i] * elem_size[i]);
+    }
+    if (expected_size != file_size)
+        return false;
+
+    bool ok = ReadBinaryMeshArray(ifile, header.sizes[0], m_vertices) &&
+              ReadBinaryMeshArray(ifile, header.sizes[1], m_normals) &&
+              ReadBinaryMeshArray(ifile, header.sizes[2], m_UV) &&
+              ReadBinaryMeshArray(ifile, header.sizes[3], m_colors) &&
+              ReadBinaryMeshArray(ifile, header.sizes[4], m_face_v_indices) &&
+              ReadBinaryMeshArray(ifile, header.sizes[5], m_face_n_indices) &&
+              ReadBinaryMeshArray(ifile, header.sizes[6], m_face_uv_indices) &&
+              ReadBinaryMeshArray(ifile, header.sizes[7], m_face_col_indices);
+    if (!ok) {
+        Clear();
+        return false;
+    }
+
+    return true;
+}
+
+bool ChTriangleMeshConnected::LoadWavefrontMeshCached(const std::string& filename,
+                                                      bool load_normals,
+                                                      bool load_uv,
+                                                      const std::string& cache_filename) {
+    // The cache key combines the contents of the OBJ file and the load options
+    uint64_t key;
+    if (!HashFile(filename, key)) {
+        std::cerr << "Error loading OBJ file " << filename << std::endl;
+        return false;
+    }
+    key = (key ^ ((load_normals ? 1 : 0) | (load_uv ? 2 : 0))) * 1099511628211ULL;
+
+    std::string cache = cache_filename.empty() ? filename + ".chmesh" : cache_filename;
+    if (LoadBinaryMesh(cache, key)) {
+        m_filename = filename;
+        return true;
+    }
+
+    if (!LoadWavefrontMesh(filename, load_normals, load_uv))
+        return false;
+    WriteBinaryMesh(cache, key);
+
+    return true;
+}
+
 // Write the specified meshes in a Wavefront .obj file
 void ChTriangleMeshConnected::WriteWavefront(const std::string& filename,
                                              std::vector<ChTriangleMeshConnected>& meshes) {
@@ -1085,152 +1251,159 @@ void ChTriangleMeshConnected::Transform(const ChVector<> displ, const ChMatrix33
     }
 }
 
-bool ChTriangleMeshConnected::ComputeNeighbouringTriangleMap(std::vector<std::array<int, 4>>& tri_map) const {
-    bool pathological_edges = false;
+// Collect the edges of all triangles as pairs {edge, triangle}, with the edge vertex indexes in increasing order (to
+// avoid ambiguous duplicated edges), and sort them. Entries for the same edge are contiguous and ordered by triangle.
+typedef std::pair<std::pair<int, int>, int> MeshEdge;
+
+static std::pair<int, int> TriangleEdge(const ChVector<int>& face, int nedge) {
+    int a = face[nedge];
+    int b = face[(nedge + 1) % 3];
+    return a < b ? std::make_pair(a, b) : std::make_pair(b, a);
+}
+
+static void SortedEdgeList(const std::vector<ChVector<int>>& faces, std::vector<MeshEdge>& edges) {
+    int num_faces = (int)faces.size();
+    edges.resize(3 * faces.size());
 
-    std::multimap<std::pair<int, int>, int> edge_map;
-
-    for (int it = 0; it < this->m_face_v_indices.size(); ++it) {
-        // edges = pairs of vertexes indexes
-        std::pair<int, int> medgeA(this->m_face_v_indices[it].x(), this->m_face_v_indices[it].y());
-        std::pair<int, int> medgeB(this->m_face_v_indices[it].y(), this->m_face_v_indices[it].z());
-        std::pair<int, int> medgeC(this->m_face_v_indices[it].z(), this->m_face_v_indices[it].x());
-        // vertex indexes in edges: always in increasing order to avoid ambiguous duplicated edges
-        if (medgeA.first > medgeA.second)
-            medgeA = std::pair<int, int>(medgeA.second, medgeA.first);
-        if (medgeB.first > medgeB.second)
-            medgeB = std::pair<int, int>(medgeB.second, medgeB.first);
-        if (medgeC.first > medgeC.second)
-            medgeC = std::pair<int, int>(medgeC.second, medgeC.first);
-        edge_map.insert({medgeA, it});
-        edge_map.insert({medgeB, it});
-        edge_map.insert({medgeC, it});
+#pragma omp parallel for schedule(static)
+    for (int it = 0; it < num_faces; ++it) {
+        for (int ie = 0; ie < 3; ++ie)
+            edges[3 * it + ie] = MeshEdge(TriangleEdge(faces[it], ie), it);
     }
 
+    std::sort(edges.begin(), edges.end());
+}
+
+bool ChTriangleMeshConnected::ComputeNeighbouringTriangleMap(std::vector<std::array<int, 4>>& tri_map) const {
+    std::vector<MeshEdge> edges;
+    SortedEdgeList(m_face_v_indices, edges);
+
+    auto edge_less = [](const MeshEdge& a, const MeshEdge& b) { return a.first < b.first; };
+
     // Create a map of neighboring triangles, vector of:
     // [Ti TieA TieB TieC]
-    tri_map.resize(this->m_face_v_indices.size());
-    for (int it = 0; it < this->m_face_v_indices.size(); ++it) {
+    int num_faces = (int)m_face_v_indices.size();
+    int num_pathological = 0;
+    tri_map.resize(num_faces);
+
+#pragma omp parallel for schedule(static) reduction(+ : num_pathological)
+    for (int it = 0; it < num_faces; ++it) {
         tri_map[it][0] = it;
-        tri_map[it][1] = -1;  // default no neighbour
-        tri_map[it][2] = -1;  // default no neighbour
-        tri_map[it][3] = -1;  // default no neighbour
-        // edges = pairs of vertexes indexes
-        std::pair<int, int> medgeA(this->m_face_v_indices[it].x(), this->m_face_v_indices[it].y());
-        std::pair<int, int> medgeB(this->m_face_v_indices[it].y(), this->m_face_v_indices[it].z());
-        std::pair<int, int> medgeC(this->m_face_v_indices[it].z(), this->m_face_v_indices[it].x());
-        // vertex indexes in edges: always in increasing order to avoid ambiguous duplicated edges
-        if (medgeA.first > medgeA.second)
-            medgeA = std::pair<int, int>(medgeA.second, medgeA.first);
-        if (medgeB.first > medgeB.second)
-            medgeB = std::pair<int, int>(medgeB.second, medgeB.first);
-        if (medgeC.first > medgeC.second)
-            medgeC = std::pair<int, int>(medgeC.second, medgeC.first);
-        if (edge_map.count(medgeA) > 2 || edge_map.count(medgeB) > 2 || edge_map.count(medgeC) > 2) {
-            pathological_edges = true;
-            // GetLog() << "Warning, edge shared with more than two triangles! \n";
-        }
-        auto retA = edge_map.equal_range(medgeA);
-        for (auto fedge = retA.first; fedge != retA.second; ++fedge) {
-            if (fedge->second != it) {
-                tri_map[it][1] = fedge->second;
-                break;
-            }
-        }
-        auto retB = edge_map.equal_range(medgeB);
-        for (auto fedge = retB.first; fedge != retB.second; ++fedge) {
-            if (fedge->second != it) {
-                tri_map[it][2] = fedge->second;
-                break;
-            }
-        }
-        auto retC = edge_map.equal_range(medgeC);
-        for (auto fedge = retC.first; fedge != retC.second; ++fedge) {
-            if (fedge->second != it) {
-                tri_map[it][3] = fedge->second;
-                break;
+        for (int ie = 0; ie < 3; ++ie) {
+            tri_map[it][ie + 1] = -1;  // default no neighbour
+            MeshEdge edge(TriangleEdge(m_face_v_indices[it], ie), 0);
+            auto range = std::equal_range(edges.begin(), edges.end(), edge, edge_less);
+            if (range.second - range.first > 2)
+                num_pathological++;
+            for (auto fedge = range.first; fedge != range.second; ++fedge) {
+                if (fedge->second != it) {
+                    tri_map[it][ie + 1] = fedge->second;
+                    break;
+                }
             }
         }
     }
-    return pathological_edges;
+
+    return num_pathological > 0;
 }
 
 bool ChTriangleMeshConnected::ComputeWingedEdges(std::map<std::pair<int, int>, std::pair<int, int>>& winged_edges,
                                                  bool allow_single_wing) const {
     bool pathological_edges = false;
 
-    std::multimap<std::pair<int, int>, int> edge_map;
-
-    for (int it = 0; it < this->m_face_v_indices.size(); ++it) {
-        // edges = pairs of vertexes indexes
-        std::pair<int, int> medgeA(this->m_face_v_indices[it].x(), this->m_face_v_indices[it].y());
-        std::pair<int, int> medgeB(this->m_face_v_indices[it].y(), this->m_face_v_indices[it].z());
-        std::pair<int, int> medgeC(this->m_face_v_indices[it].z(), this->m_face_v_indices[it].x());
-        // vertex indexes in edges: always in increasing order to avoid ambiguous duplicated edges
-        if (medgeA.first > medgeA.second)
-            medgeA = std::pair<int, int>(medgeA.second, medgeA.first);
-        if (medgeB.first > medgeB.second)
-            medgeB = std::pair<int, int>(medgeB.second, medgeB.first);
-        if (medgeC.first > medgeC.second)
-            medgeC = std::pair<int, int>(medgeC.second, medgeC.first);
-        edge_map.insert({medgeA, it});
-        edge_map.insert({medgeB, it});
-        edge_map.insert({medgeC, it});
-    }
-
-    for (auto aedge = edge_map.begin(); aedge != edge_map.end(); ++aedge) {
-        auto ret = edge_map.equal_range(aedge->first);
-        int nt = 0;
-        std::pair<int, int> wingedge;
-        std::pair<int, int> wingtri;
-        wingtri.first = -1;
-        wingtri.second = -1;
-        for (auto fedge = ret.first; fedge != ret.second; ++fedge) {
-            if (fedge->second == -1)
-                break;
-            wingedge.first = fedge->first.first;
-            wingedge.second = fedge->first.second;
-            if (nt == 0)
-                wingtri.first = fedge->second;
-            if (nt == 1)
-                wingtri.second = fedge->second;
-            ++nt;
-            if (nt == 2)
-                break;
-        }
-        if ((nt == 2) || ((nt == 1) && allow_single_wing)) {
-            winged_edges.insert(
-                std::pair<std::pair<int, int>, std::pair<int, int>>(wingedge, wingtri));  // ok found winged edge!
-            aedge->second = -1;  // deactivate this way otherwise found again by sister
-        }
-        if (nt == 3) {
+    std::vector<MeshEdge> edges;
+    SortedEdgeList(m_face_v_indices, edges);
+
+    // Process groups of entries with the same edge (edges are visited in increasing order)
+    size_t i = 0;
+    while (i < edges.size()) {
+        size_t j = i + 1;
+        while (j < edges.size() && edges[j].first == edges[i].first)
+            ++j;
+        size_t nt = j - i;
+        if (nt > 2)
             pathological_edges = true;
-            // GetLog() << "Warning: winged edge between "<< wing[0] << " and " << wing[1]  << " shared with more than
-            // two triangles.\n";
-        }
+        if (nt >= 2)
+            winged_edges.emplace_hint(winged_edges.end(), edges[i].first,
+                                      std::make_pair(edges[i].second, edges[i + 1].second));
+        else if (allow_single_wing)
+            winged_edges.emplace_hint(winged_edges.end(), edges[i].first, std::make_pair(edges[i].second, -1));
+        i = j;
     }
+
     return pathological_edges;
 }
 
+// Hash for the integer coordinates of a grid cell
+struct ChGridCellHash {
+    size_t operator()(const std::array<int64_t, 3>& c) const {
+        // multiply as unsigned integers (wrap-around is well defined, unlike signed overflow)
+        return (size_t)((uint64_t)c[0] * 73856093u) ^ (size_t)((uint64_t)c[1] * 19349663u) ^
+               (size_t)((uint64_t)c[2] * 83492791u);
+    }
+};
+
 int ChTriangleMeshConnected::RepairDuplicateVertexes(const double tolerance) {
     int nmerged = 0;
+    int num_verts = (int)m_vertices.size();
+    if (num_verts == 0)
+        return 0;
+
     std::vector<ChVector<>> processed_verts;
-    std::vector<int> new_indexes(m_vertices.size());
+    std::vector<int> new_indexes(num_verts);
+
+    // Bin the processed vertexes in a grid with cells no smaller than the merge distance. A vertex can then only be
+    // merged with a processed vertex in its own or one of the 26 neighboring cells. The cell size is bounded below
+    // (relative to the mesh size) to keep the integer cell coordinates in range.
+    ChVector<> pmin = m_vertices[0];
+    ChVector<> pmax = m_vertices[0];
+    for (const auto& v : m_vertices) {
+        for (int k = 0; k < 3; k++) {
+            pmin[k] = std::min(pmin[k], v[k]);
+            pmax[k] = std::max(pmax[k], v[k]);
+        }
+    }
+    double cell_size = std::max(std::sqrt(std::max(tolerance, 0.0)), 1e-12 * (pmax - pmin).Length());
+    if (cell_size == 0)
+        cell_size = 1;
+
+    std::unordered_map<std::array<int64_t, 3>, std::vector<int>, ChGridCellHash> grid;
+    grid.reserve(num_verts);
 
     // merge vertexes
-    for (int i = 0; i < this->m_vertices.size(); ++i) {
-        bool tomerge = false;
-        for (int j = 0; j < processed_verts.size(); ++j) {
-            if ((m_vertices[i] - processed_verts[j]).Length2() < tolerance) {
-                tomerge = true;
-                ++nmerged;
-                new_indexes[i] = j;
-                break;
+    for (int i = 0; i < num_verts; ++i) {
+        std::array<int64_t, 3> cell;
+        for (int k = 0; k < 3; k++)
+            cell[k] = (int64_t)std::floor((m_vertices[i][k] - pmin[k]) / cell_size);
+
+        // find the first processed vertex within the merge distance (as if all processed vertexes were searched
+        // in order); the vertexes in each cell are stored in increasing order
+        int match = -1;
+        for (int dx = -1; dx <= 1; dx++) {
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dz = -1; dz <= 1; dz++) {
+                    auto found = grid.find({{cell[0] + dx, cell[1] + dy, cell[2] + dz}});
+                    if (found == grid.end())
+                        continue;
+                    for (int j : found->second) {
+                        if (match >= 0 && j >= match)
+                            break;
+                        if ((m_vertices[i] - processed_verts[j]).Length2() < tolerance) {
+                            match = j;
+                            break;
+                        }
+                    }
+                }
             }
         }
-        if (!tomerge) {
+
+        if (match >= 0) {
+            ++nmerged;
+            new_indexes[i] = match;
+        } else {
             processed_verts.push_back(m_vertices[i]);
             new_indexes[i] = (int)processed_verts.size() - 1;
+            grid[cell].push_back(new_indexes[i]);
         }
     }
 
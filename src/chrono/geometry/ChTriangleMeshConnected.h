@@ -17,6 +17,7 @@
 
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <map>
 
 #include "chrono/geometry/ChTriangleMesh.h"
@@ -62,6 +63,26 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
     /// Load a triangle mesh saved as a Wavefront .obj file
     bool LoadWavefrontMesh(std::string filename, bool load_normals = true, bool load_uv = false);
 
+    /// Load a triangle mesh saved as a Wavefront .obj file, using a binary cache file.
+    /// If the cache file exists and was generated from the current contents of the .obj file (with the same load
+    /// options), the mesh is read from the cache and the .obj parsing is skipped. Otherwise, the .obj file is parsed
+    /// and the cache file is (re)generated. If no cache file name is provided, 'filename.chmesh' is used.
+    /// A failure to write the cache file is not an error.
+    bool LoadWavefrontMeshCached(const std::string& filename,
+                                 bool load_normals = true,
+                                 bool load_uv = false,
+                                 const std::string& cache_filename = "");
+
+    /// Write the mesh data to a binary file.
+    /// The file consists of a fixed-size header followed by the raw vertex, normal, UV, color, and index arrays (each
+    /// starting at an 8-byte aligned offset), so that it can be read with bulk reads or memory-mapped directly.
+    /// The specified key (e.g., a hash of the source mesh file) is stored in the header.
+    bool WriteBinaryMesh(const std::string& filename, uint64_t key = 0) const;
+
+    /// Load the mesh data from a binary file written with WriteBinaryMesh.
+    /// Return false if the file cannot be read, was written by an incompatible version, or stores a different key.
+    bool LoadBinaryMesh(const std::string& filename, uint64_t key = 0);
+
     /// Write the specified meshes in a Wavefront .obj file
     static void WriteWavefront(const std::string& filename, std::vector<ChTriangleMeshConnected>& meshes);
 
@@ -120,14 +141,14 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
     /// Create a map of neighboring triangles, vector of:
     /// [Ti TieA TieB TieC]
     /// (the free sides have triangle id = -1).
-    /// Return false if some edge has more than 2 neighboring triangles
+    /// Return true if some edge has more than 2 neighboring triangles.
     bool ComputeNeighbouringTriangleMap(std::vector<std::array<int, 4>>& tri_map) const;
 
     /// Create a winged edge structure, map of {key, value} as
     /// {{edgevertexA, edgevertexB}, {triangleA, triangleB}}
     /// If allow_single_wing = false, only edges with at least 2 triangles are returned.
     ///  Else, also boundary edges with 1 triangle (the free side has triangle id = -1).
-    /// Return false if some edge has more than 2 neighboring triangles.
+    /// Return true if some edge has more than 2 neighboring triangles (only the first two are stored).
 
     bool ComputeWingedEdges(std::map<std::pair<int, int>, std::pair<int, int>>& winged_edges,
                             bool allow_single_wing = true) const;
@@ -137,10 +158,12 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
     /// Say, if a cube is modeled with 6 faces with 4 distinct vertexes each, it might display properly, but for
     /// some algorithms, ex. collision detection, topological information might be needed, hence adjacent faces must
     /// be connected.
+    /// Vertexes are binned in a uniform grid with cells no smaller than the merge distance, so that each vertex is
+    /// only compared with the already processed vertexes in its own and the neighboring cells.
     /// Return the number of merged vertexes.
 
     int RepairDuplicateVertexes(
-        const double tolerance = 1e-18  ///< when vertexes are closer than this value, they are merged
+        const double tolerance = 1e-18  ///< vertexes with squared distance below this value are merged
     );
 
     /// Offset the mesh, by a specified value, orthogonally to the faces.
@@ -12,6 +12,7 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -22,9 +23,24 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChFunction_Recorder)
 
-ChFunction_Recorder::ChFunction_Recorder(const ChFunction_Recorder& other) {
+ChFunction_Recorder::ChFunction_Recorder(const ChFunction_Recorder& other)
+    : ChFunction(other),
+      m_points(other.m_points),
+      m_last(0),
+      m_use_grid(other.m_use_grid),
+      m_grid_size(other.m_grid_size),
+      m_grid_valid(false) {}
+
+ChFunction_Recorder& ChFunction_Recorder::operator=(const ChFunction_Recorder& other) {
+    if (this == &other)
+        return *this;
+    ChFunction::operator=(other);
     m_points = other.m_points;
-    m_last = m_points.end();
+    m_last = 0;
+    m_use_grid = other.m_use_grid;
+    m_grid_size = other.m_grid_size;
+    m_grid_valid = false;
+    return *this;
 }
 
 void ChFunction_Recorder::Estimate_x_range(double& xmin, double& xmax) const {
@@ -41,27 +57,91 @@ void ChFunction_Recorder::Estimate_x_range(double& xmin, double& xmax) const {
 }
 
 void ChFunction_Recorder::AddPoint(double mx, double my, double mw) {
-    for (auto iter = m_points.rbegin(); iter != m_points.rend(); ++iter) {
-        double dist = mx - iter->x;
-        if (std::abs(dist) < std::numeric_limits<double>::epsilon()) {
-            // Overwrite current iterator
-            iter->x = mx;
-            iter->y = my;
-            iter->w = mw;
-            return;
-        } else if (dist > 0) {
-            // Insert before current iterator
-            ChRecPoint rec(mx, my, mw);
-            m_points.insert(iter.base(), rec);
-            return;
-        }
+    // Any modification invalidates the grid index
+    m_grid_valid = false;
+
+    // Most common case: points added in increasing order of x
+    if (m_points.empty() || mx - m_points.back().x >= std::numeric_limits<double>::epsilon()) {
+        m_points.push_back(ChRecPoint(mx, my, mw));
+        return;
+    }
+
+    // Find the first point with x >= mx - eps and overwrite it if it is within eps, otherwise insert before it
+    auto iter = std::lower_bound(m_points.begin(), m_points.end(), mx - std::numeric_limits<double>::epsilon(),
+                                 [](const ChRecPoint& p, double val) { return p.x < val; });
+    if (iter != m_points.end() && std::abs(mx - iter->x) < std::numeric_limits<double>::epsilon()) {
+        // Overwrite existing point
+        iter->x = mx;
+        iter->y = my;
+        iter->w = mw;
+        return;
+    }
+
+    m_points.insert(iter, ChRecPoint(mx, my, mw));
+}
+
+void ChFunction_Recorder::EnableGridIndex(bool val, int num_cells) {
+    m_use_grid = val;
+    m_grid_size = num_cells;
+    m_grid_valid = false;
+}
+
+void ChFunction_Recorder::UpdateGrid() const {
+    // Double-checked lazy construction: only the first thread evaluating the function after a modification builds
+    // the grid, other threads wait for it to be complete
+    if (m_grid_valid.load(std::memory_order_acquire))
+        return;
+    std::lock_guard<std::mutex> lock(m_grid_mutex);
+    if (m_grid_valid.load(std::memory_order_relaxed))
+        return;
+
+    size_t n = m_grid_size > 0 ? (size_t)m_grid_size : m_points.size();
+    m_grid_x0 = m_points.front().x;
+    m_grid_inv_dx = n / (m_points.back().x - m_grid_x0);
+    m_grid.resize(n);
+
+    // Walk the intervals and the grid cells together
+    size_t i = 0;
+    for (size_t k = 0; k < n; k++) {
+        double x = m_grid_x0 + k / m_grid_inv_dx;
+        while (i + 2 < m_points.size() && m_points[i + 1].x <= x)
+            i++;
+        m_grid[k] = i;
+    }
+
+    m_grid_valid.store(true, std::memory_order_release);
+}
+
+size_t ChFunction_Recorder::FindInterval(double x, size_t hint) const {
+    size_t n = m_points.size();
+
+    // Check the hint interval and the following one (sequential access)
+    if (hint + 1 < n && m_points[hint].x <= x) {
+        if (x <= m_points[hint + 1].x)
+            return hint;
+        if (hint + 2 < n && x <= m_points[hint + 2].x)
+            return hint + 1;
+    }
+
+    // Use the grid index, then scan forward over the intervals overlapping the grid cell
+    if (m_use_grid) {
+        UpdateGrid();
+        size_t k = std::min((size_t)((x - m_grid_x0) * m_grid_inv_dx), m_grid.size() - 1);
+        size_t i = m_grid[k];
+        while (i + 2 < n && m_points[i + 1].x < x)
+            i++;
+        while (i > 0 && m_points[i].x > x)
+            i--;
+        return i;
     }
 
-    // Insert in front of list
-    m_points.push_front(ChRecPoint(mx, my, mw));
+    // Binary search for the first point with x_i >= x (guaranteed to be in [1, n-1])
+    auto iter = std::lower_bound(m_points.begin() + 1, m_points.end() - 1, x,
+                                 [](const ChRecPoint& p, double val) { return p.x < val; });
+    return (size_t)(iter - m_points.begin()) - 1;
 }
 
-double Interpolate_y(double x, const ChRecPoint& p1, const ChRecPoint& p2) {
+static double Interpolate_y(double x, const ChRecPoint& p1, const ChRecPoint& p2) {
     return ((x - p1.x) * p2.y + (p2.x - x) * p1.y) / (p2.x - p1.x);
 }
 
@@ -80,30 +160,33 @@ double ChFunction_Recorder::Get_y(double x) const {
 
     // At this point we are guaranteed that there are at least two records.
 
-    if (m_last == m_points.end()) {
-        m_last = m_points.begin();
+    // The hint is shared by all callers; any (possibly stale) value is a valid hint
+    size_t i = FindInterval(x, m_last.load(std::memory_order_relaxed));
+    m_last.store(i, std::memory_order_relaxed);
+    return Interpolate_y(x, m_points[i], m_points[i + 1]);
+}
+
+void ChFunction_Recorder::Get_y(const ChVectorDynamic<>& x, ChVectorDynamic<>& y) const {
+    y.resize(x.size());
+    if (m_points.empty()) {
+        y.setZero();
+        return;
     }
 
-    if (x > m_last->x) {
-        // Search to the right
-        for (auto iter = m_last; iter != m_points.end(); ++iter) {
-            if (x <= iter->x) {
-                return Interpolate_y(x, *m_last, *iter);
-            }
-            m_last = iter;
-        }
-    } else {
-        // Search to the left
-        for (auto iter = m_last; iter != m_points.begin();) {
-            --iter;
-            if (x >= iter->x) {
-                return Interpolate_y(x, *iter, *m_last);
-            }
-            m_last = iter;
+    const double xmin = m_points.front().x;
+    const double xmax = m_points.back().x;
+    size_t hint = m_last.load(std::memory_order_relaxed);
+    for (Eigen::Index k = 0; k < x.size(); k++) {
+        if (x(k) <= xmin) {
+            y(k) = m_points.front().y;
+        } else if (x(k) >= xmax) {
+            y(k) = m_points.back().y;
+        } else {
+            hint = FindInterval(x(k), hint);
+            y(k) = Interpolate_y(x(k), m_points[hint], m_points[hint + 1]);
         }
     }
-
-    return 0;
+    m_last.store(hint, std::memory_order_relaxed);
 }
 
 double ChFunction_Recorder::Get_y_dx(double x) const {
@@ -121,8 +204,8 @@ void ChFunction_Recorder::ArchiveOUT(ChArchiveOut& marchive) {
     marchive.VersionWrite<ChFunction_Recorder>();
     // serialize parent class
     ChFunction::ArchiveOUT(marchive);
-    // serialize all member data: copy to vector and store
-    std::vector<ChRecPoint> tmpvect{std::begin(m_points), std::end(m_points)};
+    // serialize all member data
+    std::vector<ChRecPoint> tmpvect = m_points;
     marchive << CHNVP(tmpvect);
 }
 
@@ -131,11 +214,12 @@ void ChFunction_Recorder::ArchiveIN(ChArchiveIn& marchive) {
     /*int version =*/ marchive.VersionRead<ChFunction_Recorder>();
     // deserialize parent class
     ChFunction::ArchiveIN(marchive);
-    // stream in all member data: load vector of points and copy to list
+    // stream in all member data
     std::vector<ChRecPoint> tmpvect;
     marchive >> CHNVP(tmpvect);
-    m_points.clear();
-    std::copy(tmpvect.begin(), tmpvect.end(), std::back_inserter(m_points));
+    m_points = tmpvect;
+    m_last = 0;
+    m_grid_valid = false;
 }
 
 }  // end namespace chrono
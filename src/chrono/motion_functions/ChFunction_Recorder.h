@@ -15,8 +15,9 @@
 #ifndef CHFUNCT_RECORDER_H
 #define CHFUNCT_RECORDER_H
 
-#include <iterator>
-#include <list>
+#include <atomic>
+#include <mutex>
+#include <vector>
 
 #include "chrono/motion_functions/ChFunction_Base.h"
 
@@ -51,14 +52,29 @@ class ChApi ChRecPoint {
 ///
 /// y = interpolation of array of (x,y) data,
 ///     where (x,y) points can be inserted randomly.
+///
+/// Points are kept in a contiguous array sorted by x. Evaluation first checks the interval used by the previous call
+/// (constant time for sequential access) and otherwise locates the interval with a binary search. Optionally, a
+/// uniform grid index over the x range can be used for constant-time lookup at arbitrary x values (see
+/// EnableGridIndex). This internal lookup state is thread-safe, so that a recorder can be evaluated concurrently from
+/// multiple threads (e.g., when shared by several motors in an assembly updated in parallel). Adding points or
+/// changing the grid index must not be done concurrently with evaluations.
 class ChApi ChFunction_Recorder : public ChFunction {
   private:
-    std::list<ChRecPoint> m_points;  ///< the list of points
-    mutable std::list<ChRecPoint>::const_iterator m_last;
+    std::vector<ChRecPoint> m_points;    ///< the points, sorted by x
+    mutable std::atomic<size_t> m_last;  ///< index of the left end of the last interval used (lookup hint)
+    bool m_use_grid;                     ///< use a uniform grid index for lookup
+    int m_grid_size;                     ///< requested number of grid cells (0: number of points)
+    mutable std::vector<size_t> m_grid;  ///< for each grid cell, the interval containing its left end
+    mutable double m_grid_x0;            ///< left end of the grid
+    mutable double m_grid_inv_dx;        ///< inverse of the grid cell size
+    mutable std::atomic<bool> m_grid_valid;  ///< true if the grid index is up to date
+    mutable std::mutex m_grid_mutex;         ///< protects the (lazy) construction of the grid index
 
   public:
-    ChFunction_Recorder() : m_last(m_points.end()) {}
+    ChFunction_Recorder() : m_last(0), m_use_grid(false), m_grid_size(0), m_grid_valid(false) {}
     ChFunction_Recorder(const ChFunction_Recorder& other);
+    ChFunction_Recorder& operator=(const ChFunction_Recorder& other);
     ~ChFunction_Recorder() {}
 
     /// "Virtual" copy constructor (covariant return type).
@@ -70,14 +86,32 @@ class ChApi ChFunction_Recorder : public ChFunction {
     virtual double Get_y_dx(double x) const override;
     virtual double Get_y_dxdx(double x) const override;
 
+    /// Evaluate the function at all values in x and load the results in y.
+    /// Consecutive values are located starting from the interval of the previous one, so that evaluation for a
+    /// sorted (or nearly sorted) array of x values costs constant time per value.
+    void Get_y(const ChVectorDynamic<>& x, ChVectorDynamic<>& y) const;
+
+    /// Add a point. If a point with the same x already exists, it is overwritten.
+    /// Appending points in increasing order of x takes constant time.
     void AddPoint(double mx, double my, double mw = 1);
 
+    /// Reserve storage for the given number of points.
+    void Reserve(size_t num_points) { m_points.reserve(num_points); }
+
     void Reset() {
         m_points.clear();
-        m_last = m_points.end();
+        m_last = 0;
+        m_grid_valid = false;
     }
 
-    const std::list<ChRecPoint>& GetPoints() { return m_points; }
+    const std::vector<ChRecPoint>& GetPoints() const { return m_points; }
+
+    /// Enable/disable the use of a uniform grid index over the x range of the points (default: false).
+    /// The index stores, for each of the 'num_cells' grid cells, the interval containing its left end, so that a
+    /// lookup at any x only scans the intervals overlapping one cell. If 'num_cells' is 0, the number of grid cells
+    /// is set to the number of points. The index is rebuilt at the first evaluation after points are added; it is
+    /// effective for tables with (roughly) uniformly spaced points evaluated at random locations.
+    void EnableGridIndex(bool val, int num_cells = 0);
 
     virtual void Estimate_x_range(double& xmin, double& xmax) const override;
 
@@ -86,6 +120,14 @@ class ChApi ChFunction_Recorder : public ChFunction {
 
     /// Method to allow de-serialization of transient data from archives.
     virtual void ArchiveIN(ChArchiveIn& marchive) override;
+
+  private:
+    /// Return the index i of the interval [x_i, x_{i+1}] containing x, searching first around 'hint'.
+    /// Assumes that there are at least two points and that x is strictly inside the range of the points.
+    size_t FindInterval(double x, size_t hint) const;
+
+    /// Build the uniform grid index, if not up to date.
+    void UpdateGrid() const;
 };
 
 /// @} chrono_functions
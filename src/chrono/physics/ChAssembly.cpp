@@ -520,6 +520,11 @@ void ChAssembly::Setup() {
     ndof = ncoords_w - ndoc_w;
 }
 
+// Number of threads for the parallel loops over bodies and links (1 unless enabled in the containing system).
+int ChAssembly::GetNumThreads() const {
+    return (system && system->GetParallelAssembly()) ? system->GetNumThreadsChrono() : 1;
+}
+
 // Update assembly's own properties first (ChTime and assets, if any).
 // Then update all contents of this assembly.
 void ChAssembly::Update(double mytime, bool update_assets) {
@@ -531,19 +536,35 @@ void ChAssembly::Update(double mytime, bool update_assets) {
 // Updates all forces (automatic, as children of bodies)
 // Updates all markers (automatic, as children of bodies).
 void ChAssembly::Update(bool update_assets) {
-    //// NOTE: do not switch these to range for loops (may want to use OMP for)
+    int nthreads = GetNumThreads();
+
+    //// NOTE: do not switch these to range for loops (OMP for)
+#pragma omp parallel for schedule(static) num_threads(nthreads)
     for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
-        bodylist[ip]->Update(ChTime, update_assets);
+        bodylist[ip]->Update(ChTime, update_assets && nthreads == 1);
     }
     for (int ip = 0; ip < (int)otherphysicslist.size(); ++ip) {
         otherphysicslist[ip]->Update(ChTime, update_assets);
     }
+#pragma omp parallel for schedule(static) num_threads(nthreads)
     for (int ip = 0; ip < (int)linklist.size(); ++ip) {
-        linklist[ip]->Update(ChTime, update_assets);
+        linklist[ip]->Update(ChTime, update_assets && nthreads == 1);
     }
     for (int ip = 0; ip < (int)meshlist.size(); ++ip) {
         meshlist[ip]->Update(ChTime, update_assets);
     }
+    if (update_assets && nthreads > 1)
+        UpdateBodyLinkAssets();
+}
+
+// Sequential update of body and link assets (which may have side effects, e.g. particle emitters).
+void ChAssembly::UpdateBodyLinkAssets() {
+    for (auto& body : bodylist) {
+        body->ChPhysicsItem::Update(body->GetChTime(), true);
+    }
+    for (auto& link : linklist) {
+        link->ChPhysicsItem::Update(link->GetChTime(), true);
+    }
 }
 
 void ChAssembly::SetNoSpeedNoAcceleration() {
@@ -568,14 +589,22 @@ void ChAssembly::IntStateGather(const unsigned int off_x,
                                 double& T) {
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumThreads();
 
-    for (auto& body : bodylist) {
+    // Note: each item sets the time in its own copy (to prevent concurrent writes)
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
+        auto& body = bodylist[ip];
+        double T_item;
         if (body->IsActive())
-            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T);
+            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T_item);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)linklist.size(); ++ip) {
+        auto& link = linklist[ip];
+        double T_item;
         if (link->IsActive())
-            link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T);
+            link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T_item);
     }
     for (auto& mesh : meshlist) {
         mesh->IntStateGather(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T);
@@ -602,25 +631,34 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
 
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumThreads();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
-            body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T, full_update);
+            body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T,
+                                  full_update && nthreads == 1);
         else
-            body->Update(T, full_update);
+            body->Update(T, full_update && nthreads == 1);
     }
     for (auto& mesh : meshlist) {
         mesh->IntStateScatter(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T, full_update);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)linklist.size(); ++ip) {
+        auto& link = linklist[ip];
         if (link->IsActive())
-            link->IntStateScatter(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T, full_update);
+            link->IntStateScatter(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T,
+                                  full_update && nthreads == 1);
         else
-            link->Update(T, full_update);
+            link->Update(T, full_update && nthreads == 1);
     }
     for (auto& item : otherphysicslist) {
         item->IntStateScatter(displ_x + item->GetOffset_x(), x, displ_v + item->GetOffset_w(), v, T, full_update);
     }
+    if (full_update && nthreads > 1)
+        UpdateBodyLinkAssets();
     SetChTime(T);
 }
 
@@ -710,13 +748,18 @@ void ChAssembly::IntStateIncrement(const unsigned int off_x,
                                    const ChStateDelta& Dv) {
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumThreads();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntStateIncrement(displ_x + body->GetOffset_x(), x_new, x, displ_v + body->GetOffset_w(), Dv);
     }
 
-    for (auto& link : linklist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)linklist.size(); ++ip) {
+        auto& link = linklist[ip];
         if (link->IsActive())
             link->IntStateIncrement(displ_x + link->GetOffset_x(), x_new, x, displ_v + link->GetOffset_w(), Dv);
     }
@@ -735,8 +778,12 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
                                    const double c)          ///< a scaling factor
 {
     unsigned int displ_v = off - this->offset_w;
+    int nthreads = GetNumThreads();
 
-    for (auto& body : bodylist) {
+    // Note: links are processed sequentially, as link forces are loaded in the residual entries of the connected bodies
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c);
     }
@@ -758,8 +805,11 @@ void ChAssembly::IntLoadResidual_Mv(const unsigned int off,      ///< offset in
                                     const double c               ///< a scaling factor
 ) {
     unsigned int displ_v = off - this->offset_w;
+    int nthreads = GetNumThreads();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntLoadResidual_Mv(displ_v + body->GetOffset_w(), R, w, c);
     }
@@ -187,6 +187,9 @@ class ChApi ChAssembly : public ChPhysicsItem {
 
     /// Updates all the auxiliary data and children of
     /// bodies, forces, links, given their current state.
+    /// If enabled in the containing system (see ChSystem::SetParallelAssembly), bodies and links are updated in
+    /// parallel (using the number of Chrono threads of the system), with their assets updated sequentially afterwards;
+    /// meshes and other physics items are always updated sequentially.
     virtual void Update(bool update_assets = true) override;
 
     /// Set zero speed (and zero accelerations) in state, without changing the position.
@@ -296,6 +299,16 @@ class ChApi ChAssembly : public ChPhysicsItem {
   private:
     virtual void SetupInitial() override;
 
+    /// Return the number of threads for the parallel loops over bodies and links (1 if the parallel update is not
+    /// enabled in the containing system).
+    /// Only items which read and write their own data and their own entries in the state and residual vectors are
+    /// processed in parallel (e.g., bodies in all passes, but links only in the update and state passes, since link
+    /// forces are applied to the connected bodies). All other items are processed sequentially.
+    int GetNumThreads() const;
+
+    /// Sequentially update the assets of all bodies and links (after a parallel update pass).
+    void UpdateBodyLinkAssets();
+
     std::vector<std::shared_ptr<ChBody>> bodylist;                 ///< list of rigid bodies
     std::vector<std::shared_ptr<ChLinkBase>> linklist;             ///< list of joints (links)
     std::vector<std::shared_ptr<fea::ChMesh>> meshlist;            ///< list of meshes
@@ -140,13 +140,14 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     ReportContactCallback* report_contact_callback;
 
     /// Utility function to accumulate contact forces from a specified list of contacts.
-    /// This function is templated by the contact type (assumed to be derived from ChContactTuple).
+    /// This function is templated by the contact list type, which must provide forward iteration over pointers to
+    /// contacts (assumed to be derived from ChContactTuple).
     /// Contact forces are accumulated in a map keyed by the contactable objects.
     /// Derived ChContactContainer classes can use this utility (processing their various lists
     /// of contacts) to cache information used for reporting through GetContactableForce and
     /// GetContactableTorque.
-    template <class Tcont>
-    void SumAllContactForces(std::list<Tcont*>& contactlist,
+    template <class Tlist>
+    void SumAllContactForces(Tlist& contactlist,
                              std::unordered_map<ChContactable*, ForceTorque>& contactforces) {
         for (auto contact = contactlist.begin(); contact != contactlist.end(); ++contact) {
             // Extract information for current contact (expressed in global frame)
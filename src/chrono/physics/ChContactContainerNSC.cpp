@@ -12,6 +12,9 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <functional>
+
 #include "chrono/physics/ChContactContainerNSC.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
@@ -35,7 +38,10 @@ ChContactContainerNSC::ChContactContainerNSC()
       n_added_666_6(0),
       n_added_666_333(0),
       n_added_666_666(0),
-      n_added_6_6_rolling(0) {}
+      n_added_6_6_rolling(0),
+      use_reaction_cache(false),
+      reaction_cache_tol(0.02),
+      n_cache_hits(0) {}
 
 ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other) : ChContactContainer(other) {
     n_added_6_6 = 0;
@@ -49,6 +55,10 @@ ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other)
     n_added_666_333 = 0;
     n_added_666_666 = 0;
     n_added_6_6_rolling = 0;
+
+    use_reaction_cache = other.use_reaction_cache;
+    reaction_cache_tol = other.reaction_cache_tol;
+    n_cache_hits = 0;
 }
 
 ChContactContainerNSC::~ChContactContainerNSC() {
@@ -88,6 +98,17 @@ void ChContactContainerNSC::RemoveAllContacts() {
 }
 
 void ChContactContainerNSC::BeginAddContact() {
+    // The reactions cached for the current contacts (updated when the reactions were scattered) become the reactions
+    // of the previous contacts, to be matched against the new contacts
+    if (use_reaction_cache) {
+        std::swap(reaction_cache, reaction_cache_prev);
+        reaction_cache.clear();
+        reaction_cache_index.clear();
+        for (size_t i = 0; i < reaction_cache_prev.size(); i++)
+            reaction_cache_index.insert({reaction_cache_prev[i].key, i});
+    }
+    n_cache_hits = 0;
+
     lastcontact_6_6 = contactlist_6_6.begin();
     n_added_6_6 = 0;
 
@@ -250,7 +271,75 @@ void ChContactContainerNSC::AddContact(const collision::ChCollisionInfo& cinfo)
     InsertContact(cinfo, cmat);
 }
 
-void ChContactContainerNSC::InsertContact(const collision::ChCollisionInfo& cinfo, const ChMaterialCompositeNSC& cmat) {
+std::size_t ChContactContainerNSC::ReactionCacheKeyHash::operator()(const ReactionCacheKey& key) const {
+    std::hash<void*> h;
+    std::size_t seed = h(key.modelA);
+    seed ^= h(key.modelB) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= h(key.shapeA) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= h(key.shapeB) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+}
+
+void ChContactContainerNSC::EnableReactionCache(bool val) {
+    use_reaction_cache = val;
+    if (!val) {
+        reaction_cache.clear();
+        reaction_cache_prev.clear();
+        reaction_cache_index.clear();
+    }
+}
+
+float* ChContactContainerNSC::CacheReactions(const collision::ChCollisionInfo& cinfo) {
+    // Identify the contact independently of the order in which the collision system reports the two models
+    ReactionCacheEntry entry;
+    entry.swapped = std::less<collision::ChCollisionModel*>()(cinfo.modelB, cinfo.modelA);
+    if (entry.swapped)
+        entry.key = {cinfo.modelB, cinfo.modelA, cinfo.shapeB, cinfo.shapeA};
+    else
+        entry.key = {cinfo.modelA, cinfo.modelB, cinfo.shapeA, cinfo.shapeB};
+    entry.pos = entry.key.modelA->GetContactable()->GetCsysForCollisionModel().TransformPointParentToLocal(
+        entry.swapped ? cinfo.vpB : cinfo.vpA);
+    entry.matched = false;
+    std::fill_n(entry.reactions, 6, 0.0f);
+
+    // Find the closest contact point (not yet matched) between the same shapes at the previous step
+    ReactionCacheEntry* match = nullptr;
+    double min_dist2 = reaction_cache_tol * reaction_cache_tol;
+    auto range = reaction_cache_index.equal_range(entry.key);
+    for (auto it = range.first; it != range.second; ++it) {
+        auto& prev = reaction_cache_prev[it->second];
+        double dist2 = (prev.pos - entry.pos).Length2();
+        if (!prev.matched && dist2 < min_dist2) {
+            match = &prev;
+            min_dist2 = dist2;
+        }
+    }
+
+    if (match) {
+        match->matched = true;
+        if (match->swapped == entry.swapped) {
+            std::copy_n(match->reactions, 6, entry.reactions);
+        } else {
+            // The contact frame is not the same; only reuse the normal reaction
+            entry.reactions[0] = match->reactions[0];
+        }
+        n_cache_hits++;
+    }
+
+    reaction_cache.push_back(entry);
+    return reaction_cache.back().reactions;
+}
+
+void ChContactContainerNSC::InsertContact(const collision::ChCollisionInfo& cinfo_in,
+                                          const ChMaterialCompositeNSC& cmat) {
+    // If enabled, redirect the reactions cache of the new contact to persistent storage in this container
+    collision::ChCollisionInfo cinfo_cached;
+    if (use_reaction_cache) {
+        cinfo_cached = cinfo_in;
+        cinfo_cached.reaction_cache = CacheReactions(cinfo_in);
+    }
+    const collision::ChCollisionInfo& cinfo = use_reaction_cache ? cinfo_cached : cinfo_in;
+
     auto contactableA = cinfo.modelA->GetContactable();
     auto contactableB = cinfo.modelB->GetContactable();
 
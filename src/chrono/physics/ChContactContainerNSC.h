@@ -15,7 +15,9 @@
 #ifndef CH_CONTACTCONTAINER_NSC_H
 #define CH_CONTACTCONTAINER_NSC_H
 
+#include <deque>
 #include <list>
+#include <unordered_map>
 
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChContactNSC.h"
@@ -84,6 +86,39 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
+    /// Identification of a contact between two collision shapes.
+    struct ReactionCacheKey {
+        collision::ChCollisionModel* modelA;
+        collision::ChCollisionModel* modelB;
+        collision::ChCollisionShape* shapeA;
+        collision::ChCollisionShape* shapeB;
+        bool operator==(const ReactionCacheKey& other) const {
+            return modelA == other.modelA && modelB == other.modelB && shapeA == other.shapeA &&
+                   shapeB == other.shapeB;
+        }
+    };
+
+    struct ReactionCacheKeyHash {
+        std::size_t operator()(const ReactionCacheKey& key) const;
+    };
+
+    /// Cached reactions of a contact.
+    struct ReactionCacheEntry {
+        ReactionCacheKey key;  ///< collision models and shapes
+        ChVector<> pos;        ///< contact point, relative to the first collision model
+        bool swapped;          ///< true if the collision system reported the two models in reverse order
+        bool matched;          ///< true if this entry was already used to initialize a new contact
+        float reactions[6];    ///< N,U,V reactions (and rolling/spinning reactions), in the contact frame
+    };
+
+    bool use_reaction_cache;    ///< cache contact reactions between steps
+    double reaction_cache_tol;  ///< max. distance between matching contact points
+    int n_cache_hits;           ///< number of contacts initialized from the cache
+
+    std::deque<ReactionCacheEntry> reaction_cache;       ///< cache entries for the current contacts
+    std::deque<ReactionCacheEntry> reaction_cache_prev;  ///< cache entries for the previous contacts
+    std::unordered_multimap<ReactionCacheKey, size_t, ReactionCacheKeyHash> reaction_cache_index;
+
   public:
     ChContactContainerNSC();
     ChContactContainerNSC(const ChContactContainerNSC& other);
@@ -127,6 +162,23 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// object.
     virtual void ReportAllContacts(std::shared_ptr<ReportContactCallback> callback) override;
 
+    /// Enable/disable caching of contact reactions between steps (default: false).
+    /// If enabled, a contact is identified across steps by its pair of collision models and shapes and by the location
+    /// of its contact point relative to the first collision model. The reactions of a persistent contact at the
+    /// previous step are used to initialize the reactions of the new contact object. Unlike the reaction cache of
+    /// persistent contact manifolds provided by the Bullet collision system (which this cache replaces, if enabled),
+    /// this does not depend on the collision detection system.\n
+    /// Note that the cached reactions are used by the VI solvers only if warm starting is enabled (see
+    /// ChIterativeSolver::EnableWarmStart).
+    void EnableReactionCache(bool val);
+
+    /// Set the maximum distance between the contact points of a contact at two consecutive steps for the contact to be
+    /// considered persistent (default: 0.02).
+    void SetReactionCacheTolerance(double tol) { reaction_cache_tol = tol; }
+
+    /// Return the number of contacts initialized with cached reactions during the last collision detection.
+    int GetNumCachedContacts() const { return n_cache_hits; }
+
     /// Report the number of scalar unilateral constraints.
     /// Note: friction constraints aren't exactly unilaterals, but they are still counted.
     virtual int GetDOC_d() override {
@@ -197,6 +249,10 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
   private:
     void InsertContact(const collision::ChCollisionInfo& cinfo, const ChMaterialCompositeNSC& cmat);
+
+    /// Create the cache entry for a new contact, initialized with the reactions of the matching contact at the
+    /// previous step (if any). Return a pointer to the cached reactions.
+    float* CacheReactions(const collision::ChCollisionInfo& cinfo);
 };
 
 CH_CLASS_VERSION(ChContactContainerNSC, 0)
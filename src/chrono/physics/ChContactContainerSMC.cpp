@@ -23,30 +23,9 @@ using namespace geometry;
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChContactContainerSMC)
 
-ChContactContainerSMC::ChContactContainerSMC()
-    : n_added_3_3(0),
-      n_added_6_3(0),
-      n_added_6_6(0),
-      n_added_333_3(0),
-      n_added_333_6(0),
-      n_added_333_333(0),
-      n_added_666_3(0),
-      n_added_666_6(0),
-      n_added_666_333(0),
-      n_added_666_666(0) {}
-
-ChContactContainerSMC::ChContactContainerSMC(const ChContactContainerSMC& other) : ChContactContainer(other) {
-    n_added_3_3 = 0;
-    n_added_6_3 = 0;
-    n_added_6_6 = 0;
-    n_added_333_3 = 0;
-    n_added_333_6 = 0;
-    n_added_333_333 = 0;
-    n_added_666_3 = 0;
-    n_added_666_6 = 0;
-    n_added_666_333 = 0;
-    n_added_666_666 = 0;
-}
+ChContactContainerSMC::ChContactContainerSMC() {}
+
+ChContactContainerSMC::ChContactContainerSMC(const ChContactContainerSMC& other) : ChContactContainer(other) {}
 
 ChContactContainerSMC::~ChContactContainerSMC() {
     RemoveAllContacts();
@@ -57,138 +36,70 @@ void ChContactContainerSMC::Update(double mytime, bool update_assets) {
     ChContactContainer::Update(mytime, update_assets);
 }
 
-template <class Tcont, class Titer>
-void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int& n_added) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        delete (*itercontact);
-        (*itercontact) = 0;
-        ++itercontact;
-    }
-    contactlist.clear();
-    lastcontact = contactlist.begin();
-    n_added = 0;
-}
-
 void ChContactContainerSMC::RemoveAllContacts() {
-    _RemoveAllContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3);
-    _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3);
-    _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6);
-    _RemoveAllContacts(contactlist_333_3, lastcontact_333_3, n_added_333_3);
-    _RemoveAllContacts(contactlist_333_6, lastcontact_333_6, n_added_333_6);
-    _RemoveAllContacts(contactlist_333_333, lastcontact_333_333, n_added_333_333);
-    _RemoveAllContacts(contactlist_666_3, lastcontact_666_3, n_added_666_3);
-    _RemoveAllContacts(contactlist_666_6, lastcontact_666_6, n_added_666_6);
-    _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
-    _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
+    contactlist_3_3.Clear();
+    contactlist_6_3.Clear();
+    contactlist_6_6.Clear();
+    contactlist_333_3.Clear();
+    contactlist_333_6.Clear();
+    contactlist_333_333.Clear();
+    contactlist_666_3.Clear();
+    contactlist_666_6.Clear();
+    contactlist_666_333.Clear();
+    contactlist_666_666.Clear();
     //**TODO*** cont. roll.
 }
 
 void ChContactContainerSMC::BeginAddContact() {
-    lastcontact_3_3 = contactlist_3_3.begin();
-    n_added_3_3 = 0;
-
-    lastcontact_6_3 = contactlist_6_3.begin();
-    n_added_6_3 = 0;
-
-    lastcontact_6_6 = contactlist_6_6.begin();
-    n_added_6_6 = 0;
-
-    lastcontact_333_3 = contactlist_333_3.begin();
-    n_added_333_3 = 0;
-
-    lastcontact_333_6 = contactlist_333_6.begin();
-    n_added_333_6 = 0;
-
-    lastcontact_333_333 = contactlist_333_333.begin();
-    n_added_333_333 = 0;
-
-    lastcontact_666_3 = contactlist_666_3.begin();
-    n_added_666_3 = 0;
-
-    lastcontact_666_6 = contactlist_666_6.begin();
-    n_added_666_6 = 0;
-
-    lastcontact_666_333 = contactlist_666_333.begin();
-    n_added_666_333 = 0;
-
-    lastcontact_666_666 = contactlist_666_666.begin();
-    n_added_666_666 = 0;
-
-    // lastcontact_roll = contactlist_roll.begin();
-    // n_added_roll = 0;
+    contactlist_3_3.Rewind();
+    contactlist_6_3.Rewind();
+    contactlist_6_6.Rewind();
+    contactlist_333_3.Rewind();
+    contactlist_333_6.Rewind();
+    contactlist_333_333.Rewind();
+    contactlist_666_3.Rewind();
+    contactlist_666_6.Rewind();
+    contactlist_666_333.Rewind();
+    contactlist_666_666.Rewind();
 }
 
-void ChContactContainerSMC::EndAddContact() {
-    // remove contacts that are beyond last contact
-    while (lastcontact_3_3 != contactlist_3_3.end()) {
-        delete (*lastcontact_3_3);
-        lastcontact_3_3 = contactlist_3_3.erase(lastcontact_3_3);
-    }
-    while (lastcontact_6_3 != contactlist_6_3.end()) {
-        delete (*lastcontact_6_3);
-        lastcontact_6_3 = contactlist_6_3.erase(lastcontact_6_3);
-    }
-    while (lastcontact_6_6 != contactlist_6_6.end()) {
-        delete (*lastcontact_6_6);
-        lastcontact_6_6 = contactlist_6_6.erase(lastcontact_6_6);
-    }
-    while (lastcontact_333_3 != contactlist_333_3.end()) {
-        delete (*lastcontact_333_3);
-        lastcontact_333_3 = contactlist_333_3.erase(lastcontact_333_3);
-    }
-    while (lastcontact_333_6 != contactlist_333_6.end()) {
-        delete (*lastcontact_333_6);
-        lastcontact_333_6 = contactlist_333_6.erase(lastcontact_333_6);
-    }
-    while (lastcontact_333_333 != contactlist_333_333.end()) {
-        delete (*lastcontact_333_333);
-        lastcontact_333_333 = contactlist_333_333.erase(lastcontact_333_333);
-    }
-    while (lastcontact_666_3 != contactlist_666_3.end()) {
-        delete (*lastcontact_666_3);
-        lastcontact_666_3 = contactlist_666_3.erase(lastcontact_666_3);
-    }
-    while (lastcontact_666_6 != contactlist_666_6.end()) {
-        delete (*lastcontact_666_6);
-        lastcontact_666_6 = contactlist_666_6.erase(lastcontact_666_6);
-    }
-    while (lastcontact_666_333 != contactlist_666_333.end()) {
-        delete (*lastcontact_666_333);
-        lastcontact_666_333 = contactlist_666_333.erase(lastcontact_666_333);
-    }
-    while (lastcontact_666_666 != contactlist_666_666.end()) {
-        delete (*lastcontact_666_666);
-        lastcontact_666_666 = contactlist_666_666.erase(lastcontact_666_666);
+template <class Ta, class Tb>
+void ChContactContainerSMC::ContactPool<Ta, Tb>::Commit(ChContactContainer* container, int nthreads) {
+    int n_requests = static_cast<int>(requests.size());
+
+    // Allocate additional storage blocks, if needed
+    while (static_cast<int>(blocks.size()) * block_size < n_requests)
+        blocks.emplace_back(new slot_type[block_size]);
+
+    // Set up all contacts, reusing already constructed ones. Each contact only reads the state of its two contactable
+    // objects and writes its own data, so this loop can be executed in parallel.
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+    for (int i = 0; i < n_requests; i++) {
+        const Request& r = requests[i];
+        if (i < n_constructed)
+            (*this)[i]->Reset(r.objA, r.objB, r.cinfo, r.cmat);
+        else
+            new (&blocks[i / block_size][i % block_size]) contact_type(container, r.objA, r.objB, r.cinfo, r.cmat);
     }
 
-    // while (lastcontact_roll != contactlist_roll.end()) {
-    //    delete (*lastcontact_roll);
-    //    lastcontact_roll = contactlist_roll.erase(lastcontact_roll);
-    //}
+    n_constructed = std::max(n_constructed, n_requests);
+    n_active = n_requests;
+    requests.clear();
 }
 
-template <class Tcont, class Titer, class Ta, class Tb>
-void _OptimalContactInsert(std::list<Tcont*>& contactlist,           // contact list
-                           Titer& lastcontact,                       // last contact acquired
-                           int& n_added,                             // number of contacts inserted
-                           ChContactContainer* container,            // contact container
-                           Ta* objA,                                 // collidable object A
-                           Tb* objB,                                 // collidable object B
-                           const collision::ChCollisionInfo& cinfo,  // collision information
-                           const ChMaterialCompositeSMC& cmat        // composite material
-) {
-    if (lastcontact != contactlist.end()) {
-        // reuse old contacts
-        (*lastcontact)->Reset(objA, objB, cinfo, cmat);
-        lastcontact++;
-    } else {
-        // add new contact
-        Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat);
-        contactlist.push_back(mc);
-        lastcontact = contactlist.end();
-    }
-    n_added++;
+void ChContactContainerSMC::EndAddContact() {
+    int nthreads = GetSystem() ? GetSystem()->nthreads_chrono : 1;
+
+    contactlist_3_3.Commit(this, nthreads);
+    contactlist_6_3.Commit(this, nthreads);
+    contactlist_6_6.Commit(this, nthreads);
+    contactlist_333_3.Commit(this, nthreads);
+    contactlist_333_6.Commit(this, nthreads);
+    contactlist_333_333.Commit(this, nthreads);
+    contactlist_666_3.Commit(this, nthreads);
+    contactlist_666_6.Commit(this, nthreads);
+    contactlist_666_333.Commit(this, nthreads);
+    contactlist_666_666.Commit(this, nthreads);
 }
 
 void ChContactContainerSMC::AddContact(const collision::ChCollisionInfo& cinfo,
@@ -276,22 +187,22 @@ void ChContactContainerSMC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 3_3
-                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
+                contactlist_3_3.Push(objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 3_6 -> 6_3
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA, swapped_cinfo, cmat);
+                contactlist_6_3.Push(objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 3_333 -> 333_3
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objB, objA, swapped_cinfo, cmat);
+                contactlist_333_3.Push(objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 3_666 -> 666_3
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objB, objA, swapped_cinfo, cmat);
+                contactlist_666_3.Push(objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -300,21 +211,21 @@ void ChContactContainerSMC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 6_3
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
+                contactlist_6_3.Push(objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 6_6
-                _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
+                contactlist_6_6.Push(objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 6_333 -> 333_6
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objB, objA, swapped_cinfo, cmat);
+                contactlist_333_6.Push(objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 6_666 -> 666_6
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objB, objA, swapped_cinfo, cmat);
+                contactlist_666_6.Push(objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -323,20 +234,20 @@ void ChContactContainerSMC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 333_3
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objA, objB, cinfo, cmat);
+                contactlist_333_3.Push(objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 333_6
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objA, objB, cinfo, cmat);
+                contactlist_333_6.Push(objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 333_333
-                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, objA, objB, cinfo, cmat);
+                contactlist_333_333.Push(objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 333_666 -> 666_333
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objB, objA, swapped_cinfo, cmat);
+                contactlist_666_333.Push(objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -345,19 +256,19 @@ void ChContactContainerSMC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 666_3
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objA, objB, cinfo, cmat);
+                contactlist_666_3.Push(objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 666_6
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objA, objB, cinfo, cmat);
+                contactlist_666_6.Push(objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 666_333
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objA, objB, cinfo, cmat);
+                contactlist_666_333.Push(objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 666_666
-                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, objA, objB, cinfo, cmat);
+                contactlist_666_666.Push(objA, objB, cinfo, cmat);
             }
         } break;
 
@@ -398,17 +309,16 @@ ChVector<> ChContactContainerSMC::GetContactableTorque(ChContactable* contactabl
     return ChVector<>(0);
 }
 
-template <class Tcont>
-void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
+template <class Tpool>
+void _ReportAllContacts(const Tpool& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
+    for (int i = 0; i < contactlist.size(); i++) {
+        auto contact = contactlist[i];
         bool proceed = mcallback->OnReportContact(
-            (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
-            (*itercontact)->GetContactDistance(), (*itercontact)->GetEffectiveCurvatureRadius(),
-            (*itercontact)->GetContactForce(), VNULL, (*itercontact)->GetObjA(), (*itercontact)->GetObjB());
+            contact->GetContactP1(), contact->GetContactP2(), contact->GetContactPlane(),
+            contact->GetContactDistance(), contact->GetEffectiveCurvatureRadius(),
+            contact->GetContactForce(), VNULL, contact->GetObjA(), contact->GetObjB());
         if (!proceed)
             break;
-        ++itercontact;
     }
 }
 
@@ -428,13 +338,11 @@ void ChContactContainerSMC::ReportAllContacts(std::shared_ptr<ReportContactCallb
 
 // STATE INTERFACE
 
-template <class Tcont>
-void _IntLoadResidual_F(std::list<Tcont*>& contactlist, ChVectorDynamic<>& R, const double c) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContIntLoadResidual_F(R, c);
-        ++itercontact;
-    }
+template <class Tpool>
+void _IntLoadResidual_F(const Tpool& contactlist, ChVectorDynamic<>& R, const double c) {
+    // Note: contacts sharing a contactable object write to the same entries in R, so this loop is kept sequential.
+    for (int i = 0; i < contactlist.size(); i++)
+        contactlist[i]->ContIntLoadResidual_F(R, c);
 }
 
 void ChContactContainerSMC::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
@@ -450,35 +358,33 @@ void ChContactContainerSMC::IntLoadResidual_F(const unsigned int off, ChVectorDy
     _IntLoadResidual_F(contactlist_666_666, R, c);
 }
 
-template <class Tcont>
-void _KRMmatricesLoad(std::list<Tcont*> contactlist, double Kfactor, double Rfactor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContKRMmatricesLoad(Kfactor, Rfactor);
-        ++itercontact;
-    }
+template <class Tpool>
+void _KRMmatricesLoad(const Tpool& contactlist, double Kfactor, double Rfactor, int nthreads) {
+    // Each contact only writes its own Jacobian block.
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+    for (int i = 0; i < contactlist.size(); i++)
+        contactlist[i]->ContKRMmatricesLoad(Kfactor, Rfactor);
 }
 
 void ChContactContainerSMC::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
-    _KRMmatricesLoad(contactlist_3_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_6_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_6_6, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_333_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_333_6, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_333_333, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_6, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_333, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_666, Kfactor, Rfactor);
+    int nthreads = GetSystem()->nthreads_chrono;
+
+    _KRMmatricesLoad(contactlist_3_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_6_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_6_6, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_333_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_333_6, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_333_333, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_6, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_333, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_666, Kfactor, Rfactor, nthreads);
 }
 
-template <class Tcont>
-void _InjectKRMmatrices(std::list<Tcont*> contactlist, ChSystemDescriptor& mdescriptor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContInjectKRMmatrices(mdescriptor);
-        ++itercontact;
-    }
+template <class Tpool>
+void _InjectKRMmatrices(const Tpool& contactlist, ChSystemDescriptor& mdescriptor) {
+    for (int i = 0; i < contactlist.size(); i++)
+        contactlist[i]->ContInjectKRMmatrices(mdescriptor);
 }
 
 void ChContactContainerSMC::InjectKRMmatrices(ChSystemDescriptor& mdescriptor) {
@@ -17,7 +17,9 @@
 
 #include <algorithm>
 #include <cmath>
-#include <list>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChContactSMC.h"
@@ -26,7 +28,8 @@
 namespace chrono {
 
 /// Class representing a container of many smooth (penalty) contacts.
-/// Implemented using linked lists of ChContactSMC objects (that is, contacts between two ChContactable objects).
+/// Implemented using pools of ChContactSMC objects (that is, contacts between two ChContactable objects), one for each
+/// pair of contactable types.
 class ChApi ChContactContainerSMC : public ChContactContainer {
   public:
     typedef ChContactSMC<ChContactable_1vars<3>, ChContactable_1vars<3> > ChContactSMC_3_3;
@@ -40,39 +43,108 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     typedef ChContactSMC<ChContactable_3vars<6, 6, 6>, ChContactable_3vars<3, 3, 3> > ChContactSMC_666_333;
     typedef ChContactSMC<ChContactable_3vars<6, 6, 6>, ChContactable_3vars<6, 6, 6> > ChContactSMC_666_666;
 
+    /// Recycled storage for the contacts between one pair of contactable types.
+    /// Contacts are constructed in place, in fixed-size blocks of contiguous memory, and are reused (never destroyed)
+    /// from one step to the next. The address of a stored contact remains valid until Clear() is called (the Jacobian
+    /// blocks of stiff contacts are referenced by pointer from the system descriptor).
+    /// Insertion is deferred: during the collision pass only the collision pair and composite material are recorded;
+    /// the contacts themselves (including evaluation of contact forces and Jacobians) are set up in parallel when the
+    /// collision pass ends.
+    template <class Ta, class Tb>
+    class ContactPool {
+      public:
+        typedef ChContactSMC<Ta, Tb> contact_type;
+
+        /// Number of contacts stored in one block of the pool.
+        static const int block_size = 256;
+
+        /// Information needed to set up a pending contact.
+        struct Request {
+            Ta* objA;
+            Tb* objB;
+            collision::ChCollisionInfo cinfo;
+            ChMaterialCompositeSMC cmat;
+        };
+
+        /// Iterator over the active contacts in the pool (dereferences to a contact pointer).
+        class const_iterator {
+          public:
+            const_iterator(const ContactPool* pool, int index) : m_pool(pool), m_index(index) {}
+            contact_type* operator*() const { return (*m_pool)[m_index]; }
+            const_iterator& operator++() {
+                ++m_index;
+                return *this;
+            }
+            bool operator!=(const const_iterator& other) const { return m_index != other.m_index; }
+
+          private:
+            const ContactPool* m_pool;
+            int m_index;
+        };
+
+        ContactPool() : n_active(0), n_constructed(0) {}
+        ~ContactPool() { Clear(); }
+
+        ContactPool(const ContactPool&) = delete;
+        ContactPool& operator=(const ContactPool&) = delete;
+
+        /// Return the number of active contacts.
+        int size() const { return n_active; }
+
+        /// Access the i-th active contact.
+        contact_type* operator[](int i) const {
+            return reinterpret_cast<contact_type*>(&blocks[i / block_size][i % block_size]);
+        }
+
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, n_active); }
+
+        /// Deactivate all contacts (without destroying them) and discard pending requests.
+        void Rewind() {
+            n_active = 0;
+            requests.clear();
+        }
+
+        /// Record a contact to be set up in the next call to Commit().
+        void Push(Ta* objA, Tb* objB, const collision::ChCollisionInfo& cinfo, const ChMaterialCompositeSMC& cmat) {
+            requests.push_back({objA, objB, cinfo, cmat});
+        }
+
+        /// Set up all pending contacts, reusing previously constructed contacts when possible.
+        /// The contact setup (force and Jacobian calculation) is done in parallel, using the specified number of
+        /// threads.
+        void Commit(ChContactContainer* container, int nthreads);
+
+        /// Destroy all contacts and release the pool memory.
+        void Clear() {
+            for (int i = 0; i < n_constructed; i++)
+                (*this)[i]->~contact_type();
+            blocks.clear();
+            requests.clear();
+            n_active = 0;
+            n_constructed = 0;
+        }
+
+      private:
+        typedef typename std::aligned_storage<sizeof(contact_type), alignof(contact_type)>::type slot_type;
+
+        std::vector<std::unique_ptr<slot_type[]>> blocks;  ///< blocks of raw contact storage
+        std::vector<Request> requests;                      ///< pending contacts (cleared, not deallocated, on commit)
+        int n_active;                                       ///< number of active contacts
+        int n_constructed;                                  ///< number of contacts constructed in the pool memory
+    };
+
   protected:
-    std::list<ChContactSMC_3_3*> contactlist_3_3;
-    std::list<ChContactSMC_6_3*> contactlist_6_3;
-    std::list<ChContactSMC_6_6*> contactlist_6_6;
-    std::list<ChContactSMC_333_3*> contactlist_333_3;
-    std::list<ChContactSMC_333_6*> contactlist_333_6;
-    std::list<ChContactSMC_333_333*> contactlist_333_333;
-    std::list<ChContactSMC_666_3*> contactlist_666_3;
-    std::list<ChContactSMC_666_6*> contactlist_666_6;
-    std::list<ChContactSMC_666_333*> contactlist_666_333;
-    std::list<ChContactSMC_666_666*> contactlist_666_666;
-
-    int n_added_3_3;
-    int n_added_6_3;
-    int n_added_6_6;
-    int n_added_333_3;
-    int n_added_333_6;
-    int n_added_333_333;
-    int n_added_666_3;
-    int n_added_666_6;
-    int n_added_666_333;
-    int n_added_666_666;
-
-    std::list<ChContactSMC_3_3*>::iterator lastcontact_3_3;
-    std::list<ChContactSMC_6_3*>::iterator lastcontact_6_3;
-    std::list<ChContactSMC_6_6*>::iterator lastcontact_6_6;
-    std::list<ChContactSMC_333_3*>::iterator lastcontact_333_3;
-    std::list<ChContactSMC_333_6*>::iterator lastcontact_333_6;
-    std::list<ChContactSMC_333_333*>::iterator lastcontact_333_333;
-    std::list<ChContactSMC_666_3*>::iterator lastcontact_666_3;
-    std::list<ChContactSMC_666_6*>::iterator lastcontact_666_6;
-    std::list<ChContactSMC_666_333*>::iterator lastcontact_666_333;
-    std::list<ChContactSMC_666_666*>::iterator lastcontact_666_666;
+    ContactPool<ChContactable_1vars<3>, ChContactable_1vars<3>> contactlist_3_3;
+    ContactPool<ChContactable_1vars<6>, ChContactable_1vars<3>> contactlist_6_3;
+    ContactPool<ChContactable_1vars<6>, ChContactable_1vars<6>> contactlist_6_6;
+    ContactPool<ChContactable_3vars<3, 3, 3>, ChContactable_1vars<3>> contactlist_333_3;
+    ContactPool<ChContactable_3vars<3, 3, 3>, ChContactable_1vars<6>> contactlist_333_6;
+    ContactPool<ChContactable_3vars<3, 3, 3>, ChContactable_3vars<3, 3, 3>> contactlist_333_333;
+    ContactPool<ChContactable_3vars<6, 6, 6>, ChContactable_1vars<3>> contactlist_666_3;
+    ContactPool<ChContactable_3vars<6, 6, 6>, ChContactable_1vars<6>> contactlist_666_6;
+    ContactPool<ChContactable_3vars<6, 6, 6>, ChContactable_3vars<3, 3, 3>> contactlist_666_333;
+    ContactPool<ChContactable_3vars<6, 6, 6>, ChContactable_3vars<6, 6, 6>> contactlist_666_666;
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
@@ -86,17 +158,17 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
 
     /// Report the number of added contacts.
     virtual int GetNcontacts() const override {
-        return n_added_3_3 + n_added_6_3 + n_added_6_6 + n_added_333_3 + n_added_333_6 + n_added_333_333 +
-               n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666;
+        return contactlist_3_3.size() + contactlist_6_3.size() + contactlist_6_6.size() + contactlist_333_3.size() +
+               contactlist_333_6.size() + contactlist_333_333.size() + contactlist_666_3.size() +
+               contactlist_666_6.size() + contactlist_666_333.size() + contactlist_666_666.size();
     }
 
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() override;
 
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
-    /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
-    /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
-    /// allocation/deallocation.
+    /// similar). Instead of deleting the previous contacts, this optimized implementation rewinds the contact pools so
+    /// that previous contact objects are reused, to avoid allocation/deallocation.
     virtual void BeginAddContact() override;
 
     /// Add a contact between two collision shapes, storing it into this container.
@@ -111,8 +183,9 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     /// A composite contact material is created from their material properties.
     virtual void AddContact(const collision::ChCollisionInfo& cinfo) override;
 
-    /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// The collision system will call EndAddContact() after adding all contacts (for example with AddContact() or
+    /// similar). This sets up all contacts recorded since BeginAddContact() and calculates their forces (and Jacobians,
+    /// if using stiff contact), in parallel over the contacts in each pool. Unused contact objects are kept for reuse.
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
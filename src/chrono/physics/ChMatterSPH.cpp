@@ -202,12 +202,13 @@ void ChContinuumSPH::ArchiveIN(ChArchiveIn& marchive) {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChMatterSPH)
 
-ChMatterSPH::ChMatterSPH() : do_collide(false) {
+ChMatterSPH::ChMatterSPH() : do_collide(false), use_cell_list(false) {
     matsurface = chrono_types::make_shared<ChMaterialSurfaceNSC>();
 }
 
 ChMatterSPH::ChMatterSPH(const ChMatterSPH& other) : ChIndexedNodes(other) {
     do_collide = other.do_collide;
+    use_cell_list = other.use_cell_list;
 
     material = other.material;
     matsurface = other.matsurface;
@@ -364,50 +365,10 @@ void ChMatterSPH::IntLoadResidual_F(
 ) {
     // COMPUTE THE SPH FORCES HERE
 
-    // First, find if any ChProximityContainerSPH object is present
-    // in the system,
-
-    std::shared_ptr<ChProximityContainerSPH> edges;
-    for (auto otherphysics : GetSystem()->Get_otherphysicslist()) {
-        if ((edges = std::dynamic_pointer_cast<ChProximityContainerSPH>(otherphysics)))
-            break;
-    }
-    assert(edges);  // If using a ChMatterSPH, you must add also a ChProximityContainerSPH.
-    if (!edges)
+    if (!ComputeForces())
         return;
 
-    // 1- Per-node initialization
-
-    for (unsigned int j = 0; j < nodes.size(); j++) {
-        nodes[j]->UserForce = VNULL;
-        nodes[j]->density = 0;
-    }
-
-    // 2- Per-edge initialization and accumulation of particles's density
-
-    edges->AccumulateStep1();
-
-    // 3- Per-node volume and pressure computation
-
-    for (unsigned int j = 0; j < nodes.size(); j++) {
-        std::shared_ptr<ChNodeSPH> mnode(nodes[j]);
-        assert(mnode);
-
-        // node volume is v=mass/density
-        if (mnode->density)
-            mnode->volume = mnode->GetMass() / mnode->density;
-        else
-            mnode->volume = 0;
-
-        // node pressure = k(dens - dens_0);
-        mnode->pressure = material.Get_pressure_stiffness() * (mnode->density - material.Get_density());
-    }
-
-    // 4- Per-edge forces computation and accumulation
-
-    edges->AccumulateStep2();
-
-    // 5- Per-node load forces
+    // Per-node load forces
 
     for (unsigned int j = 0; j < nodes.size(); j++) {
         // particle gyroscopic force:
@@ -417,10 +378,6 @@ void ChMatterSPH::IntLoadResidual_F(
         ChVector<> Gforce = GetSystem()->Get_G_acc() * nodes[j]->GetMass();
         ChVector<> TotForce = nodes[j]->UserForce + Gforce;
 
-        // downcast
-        std::shared_ptr<ChNodeSPH> mnode(nodes[j]);
-        assert(mnode);
-
         R.segment(off + 3 * j, 3) += c * TotForce.eigen();
     }
 }
@@ -475,49 +432,10 @@ void ChMatterSPH::VariablesFbReset() {
 void ChMatterSPH::VariablesFbLoadForces(double factor) {
     // COMPUTE THE SPH FORCES HERE
 
-    // First, find if any ChProximityContainerSPH object is present in the system
-
-    std::shared_ptr<ChProximityContainerSPH> edges;
-    for (auto otherphysics : GetSystem()->Get_otherphysicslist()) {
-        if ((edges = std::dynamic_pointer_cast<ChProximityContainerSPH>(otherphysics)))
-            break;
-    }
-    assert(edges);  // If using a ChMatterSPH, you must add also a ChProximityContainerSPH.
-    if (!edges)
+    if (!ComputeForces())
         return;
 
-    // 1- Per-node initialization
-
-    for (unsigned int j = 0; j < nodes.size(); j++) {
-        nodes[j]->UserForce = VNULL;
-        nodes[j]->density = 0;
-    }
-
-    // 2- Per-edge initialization and accumulation of particles's density
-
-    edges->AccumulateStep1();
-
-    // 3- Per-node volume and pressure computation
-
-    for (unsigned int j = 0; j < nodes.size(); j++) {
-        std::shared_ptr<ChNodeSPH> mnode(nodes[j]);
-        assert(mnode);
-
-        // node volume is v=mass/density
-        if (mnode->density)
-            mnode->volume = mnode->GetMass() / mnode->density;
-        else
-            mnode->volume = 0;
-
-        // node pressure = k(dens - dens_0);
-        mnode->pressure = material.Get_pressure_stiffness() * (mnode->density - material.Get_density());
-    }
-
-    // 4- Per-edge forces computation and accumulation
-
-    edges->AccumulateStep2();
-
-    // 5- Per-node load forces
+    // Per-node load forces
 
     for (unsigned int j = 0; j < nodes.size(); j++) {
         // particle gyroscopic force:
@@ -527,11 +445,7 @@ void ChMatterSPH::VariablesFbLoadForces(double factor) {
         ChVector<> Gforce = GetSystem()->Get_G_acc() * nodes[j]->GetMass();
         ChVector<> TotForce = nodes[j]->UserForce + Gforce;
 
-        // downcast
-        std::shared_ptr<ChNodeSPH> mnode(nodes[j]);
-        assert(mnode);
-
-        mnode->variables.Get_fb() += factor * TotForce.eigen();
+        nodes[j]->variables.Get_fb() += factor * TotForce.eigen();
     }
 }
 
@@ -596,6 +510,227 @@ void ChMatterSPH::Update(double mytime, bool update_assets) {
     // ClampSpeed();     // Apply limits (if in speed clamping mode) to speeds.
 }
 
+// -----------------------------------------------------------------------------
+// SPH forces
+
+double ChMatterSPH::W_poly6(double r, double h) {
+    if (r < h) {
+        return (315.0 / (64.0 * CH_C_PI * pow(h, 9))) * pow((h * h - r * r), 3);
+    } else
+        return 0;
+}
+
+double ChMatterSPH::W_sq_visco(double r, double h) {
+    if (r < h) {
+        return (45.0 / (CH_C_PI * pow(h, 6))) * (h - r);
+    } else
+        return 0;
+}
+
+void ChMatterSPH::W_gr_press(ChVector<>& Wresult, const ChVector<>& r, const double r_length, const double h) {
+    if (r_length < h) {
+        Wresult = r;
+        Wresult *= -(45.0 / (CH_C_PI * pow(h, 6))) * pow((h - r_length), 2.0);
+    } else
+        Wresult = VNULL;
+}
+
+bool ChMatterSPH::ComputeForces() {
+    if (use_cell_list) {
+        ComputeForcesCellList();
+        return true;
+    }
+    return ComputeForcesProximities();
+}
+
+bool ChMatterSPH::ComputeForcesProximities() {
+    // First, find if any ChProximityContainerSPH object is present in the system
+
+    std::shared_ptr<ChProximityContainerSPH> edges;
+    for (auto otherphysics : GetSystem()->Get_otherphysicslist()) {
+        if ((edges = std::dynamic_pointer_cast<ChProximityContainerSPH>(otherphysics)))
+            break;
+    }
+    assert(edges);  // If using a ChMatterSPH, you must add also a ChProximityContainerSPH.
+    if (!edges)
+        return false;
+
+    // 1- Per-node initialization
+
+    for (unsigned int j = 0; j < nodes.size(); j++) {
+        nodes[j]->UserForce = VNULL;
+        nodes[j]->density = 0;
+    }
+
+    // 2- Per-edge initialization and accumulation of particles's density
+
+    edges->AccumulateStep1();
+
+    // 3- Per-node volume and pressure computation
+
+    for (unsigned int j = 0; j < nodes.size(); j++) {
+        std::shared_ptr<ChNodeSPH> mnode(nodes[j]);
+        assert(mnode);
+
+        // node volume is v=mass/density
+        if (mnode->density)
+            mnode->volume = mnode->GetMass() / mnode->density;
+        else
+            mnode->volume = 0;
+
+        // node pressure = k(dens - dens_0);
+        mnode->pressure = material.Get_pressure_stiffness() * (mnode->density - material.Get_density());
+    }
+
+    // 4- Per-edge forces computation and accumulation
+
+    edges->AccumulateStep2();
+
+    return true;
+}
+
+void ChMatterSPH::ComputeForcesCellList() {
+    const int n = (int)nodes.size();
+    if (n == 0)
+        return;
+
+    int nthreads = GetSystem()->GetNumThreadsChrono();
+
+    // 1- Uniform grid covering all nodes, with cell size equal to the largest kernel radius
+
+    double h_max = 0;
+    ChVector<> pmin = nodes[0]->pos;
+    ChVector<> pmax = nodes[0]->pos;
+    for (const auto& node : nodes) {
+        h_max = std::max(h_max, node->GetKernelRadius());
+        for (int k = 0; k < 3; k++) {
+            pmin[k] = std::min(pmin[k], node->pos[k]);
+            pmax[k] = std::max(pmax[k], node->pos[k]);
+        }
+    }
+    assert(h_max > 0);
+
+    // Coarsen the grid if the cell indices would overflow (e.g. for nodes flying far away).
+    // Larger cells only result in more candidate neighbors.
+    double cell_size = h_max;
+    int64_t dims[3];
+    while (true) {
+        double ncells = 1;
+        for (int k = 0; k < 3; k++)
+            ncells *= std::floor((pmax[k] - pmin[k]) / cell_size) + 1;
+        if (ncells < 1e18)
+            break;
+        cell_size *= 2;
+    }
+    for (int k = 0; k < 3; k++)
+        dims[k] = (int64_t)((pmax[k] - pmin[k]) / cell_size) + 1;
+
+    auto cell_coords = [&](const ChVector<>& pos, int64_t* c) {
+        for (int k = 0; k < 3; k++)
+            c[k] = std::min((int64_t)((pos[k] - pmin[k]) / cell_size), dims[k] - 1);
+    };
+
+    // 2- Sort the nodes by cell index and gather their data in contiguous arrays
+
+    sorted.keys.resize(n);
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = 0; i < n; i++) {
+        int64_t c[3];
+        cell_coords(nodes[i]->pos, c);
+        sorted.keys[i] = std::make_pair(c[0] + dims[0] * (c[1] + dims[1] * c[2]), (unsigned int)i);
+    }
+    std::sort(sorted.keys.begin(), sorted.keys.end());
+
+    sorted.cell.resize(n);
+    sorted.pos.resize(n);
+    sorted.vel.resize(n);
+    sorted.mass.resize(n);
+    sorted.h.resize(n);
+    sorted.volume.resize(n);
+    sorted.pressure.resize(n);
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = 0; i < n; i++) {
+        const auto& node = nodes[sorted.keys[i].second];
+        sorted.cell[i] = sorted.keys[i].first;
+        sorted.pos[i] = node->pos;
+        sorted.vel[i] = node->pos_dt;
+        sorted.mass[i] = node->GetMass();
+        sorted.h[i] = node->GetKernelRadius();
+    }
+
+    // Visit all other nodes in the 27 cells around the i-th sorted node. Cells adjacent along X are contiguous in the
+    // sorted arrays, so that each row of 3 cells is located with a single binary search.
+    auto for_each_neighbor = [&](int i, auto&& func) {
+        int64_t c[3];
+        cell_coords(sorted.pos[i], c);
+        int64_t x0 = std::max(c[0] - 1, (int64_t)0);
+        int64_t x1 = std::min(c[0] + 1, dims[0] - 1);
+        for (int64_t z = std::max(c[2] - 1, (int64_t)0); z <= std::min(c[2] + 1, dims[2] - 1); z++) {
+            for (int64_t y = std::max(c[1] - 1, (int64_t)0); y <= std::min(c[1] + 1, dims[1] - 1); y++) {
+                int64_t first = x0 + dims[0] * (y + dims[1] * z);
+                int64_t last = first + (x1 - x0);
+                auto j = std::lower_bound(sorted.cell.begin(), sorted.cell.end(), first) - sorted.cell.begin();
+                for (; j < n && sorted.cell[j] <= last; j++) {
+                    if (j != i)
+                        func((int)j);
+                }
+            }
+        }
+    };
+
+    // 3- Per-node density, volume, and pressure.
+    // The kernel radius for a pair of nodes is the average of their radii (symmetric in i and j). The proximity
+    // container instead uses the radius of the first node in each pair, which depends on the collision system order.
+
+    const double pressure_stiffness = material.Get_pressure_stiffness();
+    const double ref_density = material.Get_density();
+    const double viscosity = material.Get_viscosity();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = 0; i < n; i++) {
+        double density = 0;
+        for_each_neighbor(i, [&](int j) {
+            double h = 0.5 * (sorted.h[i] + sorted.h[j]);
+            density += sorted.mass[j] * W_poly6((sorted.pos[j] - sorted.pos[i]).Length(), h);
+        });
+
+        // node volume is v=mass/density
+        sorted.volume[i] = density ? sorted.mass[i] / density : 0;
+
+        // node pressure = k(dens - dens_0);
+        sorted.pressure[i] = pressure_stiffness * (density - ref_density);
+
+        auto& node = nodes[sorted.keys[i].second];
+        node->density = density;
+        node->volume = sorted.volume[i];
+        node->pressure = sorted.pressure[i];
+    }
+
+    // 4- Per-node pressure and viscous forces, accumulated over the neighbors (no write conflicts)
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = 0; i < n; i++) {
+        ChVector<> force = VNULL;
+        for_each_neighbor(i, [&](int j) {
+            ChVector<> r_ji = sorted.pos[j] - sorted.pos[i];
+            double dist = r_ji.Length();
+            double h = 0.5 * (sorted.h[i] + sorted.h[j]);
+            if (dist >= h)
+                return;
+
+            ChVector<> W_k_press;
+            W_gr_press(W_k_press, r_ji, dist, h);
+            double avg_press = 0.5 * (sorted.pressure[i] + sorted.pressure[j]);
+            force += W_k_press * (sorted.volume[i] * avg_press * sorted.volume[j]);
+
+            double W_k_visc = W_sq_visco(dist, h);
+            force += (sorted.vel[j] - sorted.vel[i]) * (sorted.volume[i] * viscosity * sorted.volume[j] * W_k_visc);
+        });
+
+        nodes[sorted.keys[i].second]->UserForce = force;
+    }
+}
+
 // collision stuff
 void ChMatterSPH::SetCollide(bool mcoll) {
     if (mcoll == do_collide)
@@ -661,13 +796,14 @@ void ChMatterSPH::ArchiveOUT(ChArchiveOut& marchive) {
     marchive << CHNVP(material);
     marchive << CHNVP(matsurface);
     marchive << CHNVP(do_collide);
+    marchive << CHNVP(use_cell_list);
     marchive << CHNVP(nodes);
 }
 
 /// Method to allow de serialization of transient data from archives.
 void ChMatterSPH::ArchiveIN(ChArchiveIn& marchive) {
     // version number
-    /*int version =*/ marchive.VersionRead<ChMatterSPH>();
+    int version = marchive.VersionRead<ChMatterSPH>();
 
     // deserialize parent class
     ChIndexedNodes::ArchiveIN(marchive);
@@ -678,6 +814,10 @@ void ChMatterSPH::ArchiveIN(ChArchiveIn& marchive) {
     marchive >> CHNVP(material);
     marchive >> CHNVP(matsurface);
     marchive >> CHNVP(do_collide);
+    if (version >= 1)
+        marchive >> CHNVP(use_cell_list);
+    else
+        use_cell_list = false;
     marchive >> CHNVP(nodes);
 
     for (unsigned int j = 0; j < nodes.size(); j++) {
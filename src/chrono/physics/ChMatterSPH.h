@@ -16,6 +16,8 @@
 #define CHMATTERSPH_H
 
 #include <cmath>
+#include <cstdint>
+#include <vector>
 
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/physics/ChIndexedNodes.h"
@@ -229,6 +231,30 @@ class ChApi ChMatterSPH : public ChIndexedNodes {
     ChContinuumSPH material;                            ///< continuum material properties
     std::shared_ptr<ChMaterialSurface> matsurface;  ///< data for surface contact and impact
     bool do_collide;                                    ///< flag indicating whether or not nodes collide
+    bool use_cell_list;                                 ///< flag indicating use of the internal neighbor search
+
+    /// Node data sorted by cell index, used by the cell-list neighbor search.
+    struct SortedNodes {
+        std::vector<std::pair<int64_t, unsigned int>> keys;  ///< (cell index, node index) pairs
+        std::vector<int64_t> cell;                           ///< cell index
+        std::vector<ChVector<>> pos;                         ///< node positions
+        std::vector<ChVector<>> vel;                         ///< node velocities
+        std::vector<double> mass;                            ///< node masses
+        std::vector<double> h;                               ///< node kernel radii
+        std::vector<double> volume;                          ///< node volumes
+        std::vector<double> pressure;                        ///< node pressures
+    };
+    SortedNodes sorted;
+
+    /// Compute density, volume, pressure, and SPH forces (stored in UserForce) for all nodes.
+    /// Return false if the SPH forces could not be computed.
+    bool ComputeForces();
+
+    /// Compute the SPH quantities using the pairs of a ChProximityContainerSPH in the system.
+    bool ComputeForcesProximities();
+
+    /// Compute the SPH quantities using the internal cell-list neighbor search.
+    void ComputeForcesCellList();
 
   public:
     /// Build a cluster of nodes for SPH and meshless FEM.
@@ -246,6 +272,21 @@ class ChApi ChMatterSPH : public ChIndexedNodes {
     void SetCollide(bool mcoll);
     virtual bool GetCollide() const override { return do_collide; }
 
+    /// Enable/disable the internal cell-list neighbor search (default: false).
+    /// If disabled, the SPH density and forces are computed on the pairs of nodes reported by the collision system
+    /// to a ChProximityContainerSPH, which must be added to the system (and collision must be enabled).
+    /// If enabled, the nodes of this cluster are binned in a uniform grid with cell size equal to the largest kernel
+    /// radius and sorted by cell; densities and forces are then evaluated with parallel loops over the sorted nodes,
+    /// each node visiting only the 27 surrounding cells. No ChProximityContainerSPH is needed, and the node collision
+    /// models are only used for contact with boundaries (see SetCollide). Only interactions between nodes of this
+    /// cluster are considered, and the kernel radius for a pair of nodes is the average of their kernel radii. This
+    /// differs from the proximity-based evaluation, which uses the kernel radius of the first node of each pair (as
+    /// reported by the collision system); the two agree if all nodes have the same kernel radius.
+    void EnableCellList(bool val) { use_cell_list = val; }
+
+    /// Return true if the internal cell-list neighbor search is used.
+    bool UseCellList() const { return use_cell_list; }
+
     /// Get the number of scalar coordinates (variables), if any, in this item
     virtual int GetDOF() override { return 3 * GetNnodes(); }
 
@@ -393,12 +434,27 @@ class ChApi ChMatterSPH : public ChIndexedNodes {
     /// Update all auxiliary data of the particles
     virtual void Update(bool update_assets = true) override;
 
+    //
+    // SPH KERNELS
+    //
+
+    /// Poly6 smoothing kernel, used for the density.
+    static double W_poly6(double r, double h);
+
+    /// Laplacian of the viscosity kernel, used for the viscous forces.
+    static double W_sq_visco(double r, double h);
+
+    /// Gradient of the spiky kernel, used for the pressure forces.
+    static void W_gr_press(ChVector<>& Wresult, const ChVector<>& r, const double r_length, const double h);
+
     // SERIALIZATION
 
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
     virtual void ArchiveIN(ChArchiveIn& marchive) override;
 };
 
+CH_CLASS_VERSION(ChMatterSPH, 1)
+
 }  // end namespace chrono
 
 #endif
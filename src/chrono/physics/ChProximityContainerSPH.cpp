@@ -123,28 +123,6 @@ void ChProximityContainerSPH::ReportAllProximities(ReportProximityCallback* mcal
 
 // SOLVER INTERFACES
 
-static double W_poly6(double r, double h) {
-    if (r < h) {
-        return (315.0 / (64.0 * CH_C_PI * pow(h, 9))) * pow((h * h - r * r), 3);
-    } else
-        return 0;
-}
-
-static double W_sq_visco(double r, double h) {
-    if (r < h) {
-        return (45.0 / (CH_C_PI * pow(h, 6))) * (h - r);
-    } else
-        return 0;
-}
-
-static void W_gr_press(ChVector<>& Wresult, const ChVector<>& r, const double r_length, const double h) {
-    if (r_length < h) {
-        Wresult = r;
-        Wresult *= -(45.0 / (CH_C_PI * pow(h, 6))) * pow((h - r_length), 2.0);
-    } else
-        Wresult = VNULL;
-}
-
 void ChProximityContainerSPH::AccumulateStep1() {
     // Per-edge data computation
     std::list<ChProximitySPH*>::iterator iterproximity = proximitylist.begin();
@@ -158,7 +136,7 @@ void ChProximityContainerSPH::AccumulateStep1() {
         ChVector<> r_BA = x_B - x_A;
         double dist_BA = r_BA.Length();
 
-        double W_k_poly6 = W_poly6(dist_BA, mnodeA->GetKernelRadius());
+        double W_k_poly6 = ChMatterSPH::W_poly6(dist_BA, mnodeA->GetKernelRadius());
 
         // increment data of connected nodes
 
@@ -185,7 +163,7 @@ void ChProximityContainerSPH::AccumulateStep2() {
         // increment pressure forces
 
         ChVector<> W_k_press;
-        W_gr_press(W_k_press, r_BA, dist_BA, mnodeA->GetKernelRadius());
+        ChMatterSPH::W_gr_press(W_k_press, r_BA, dist_BA, mnodeA->GetKernelRadius());
 
         double avg_press = 0.5 * (mnodeA->pressure + mnodeB->pressure);
 
@@ -197,7 +175,7 @@ void ChProximityContainerSPH::AccumulateStep2() {
 
         // increment viscous forces..
 
-        double W_k_visc = W_sq_visco(dist_BA, mnodeA->GetKernelRadius());
+        double W_k_visc = ChMatterSPH::W_sq_visco(dist_BA, mnodeA->GetKernelRadius());
         ChVector<> velBA = mnodeB->GetPos_dt() - mnodeA->GetPos_dt();
 
         double avg_viscosity = 0.5 * (mnodeA->GetContainer()->GetMaterial().Get_viscosity() +
@@ -13,6 +13,8 @@
 // =============================================================================
 
 #include <algorithm>
+#include <map>
+#include <unordered_map>
 
 #include "chrono/collision/ChCollisionSystemBullet.h"
 #include "chrono/physics/ChProximityContainer.h"
@@ -22,10 +24,13 @@
 #include "chrono/solver/ChSolverPJacobi.h"
 #include "chrono/solver/ChSolverPMINRES.h"
 #include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/solver/ChSolverPSORcolored.h"
 #include "chrono/solver/ChSolverPSSOR.h"
 #include "chrono/solver/ChIterativeSolverLS.h"
 #include "chrono/core/ChMatrix.h"
+#include "chrono/utils/ChCheckpoint.h"
 #include "chrono/utils/ChProfiler.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 using namespace chrono::collision;
 
@@ -55,6 +60,7 @@ ChSystem::ChSystem()
       tol_force(-1),
       maxiter(6),
       use_sleeping(false),
+      parallel_assembly(false),
       min_bounce_speed(0.15),
       max_penetration_recovery_speed(0.6),
       stepcount(0),
@@ -115,6 +121,7 @@ ChSystem::ChSystem(const ChSystem& other) {
     max_penetration_recovery_speed = other.max_penetration_recovery_speed;
     SetSolverType(other.GetSolverType());
     use_sleeping = other.use_sleeping;
+    parallel_assembly = other.parallel_assembly;
 
     ncontacts = other.ncontacts;
 
@@ -225,6 +232,9 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
         case ChSolver::Type::PSSOR:
             solver = chrono_types::make_shared<ChSolverPSSOR>();
             break;
+        case ChSolver::Type::PSOR_COLORED:
+            solver = chrono_types::make_shared<ChSolverPSORcolored>();
+            break;
         case ChSolver::Type::PJACOBI:
             solver = chrono_types::make_shared<ChSolverPJacobi>();
             break;
@@ -557,6 +567,7 @@ void ChSystem::DescriptorPrepareInject(ChSystemDescriptor& mdescriptor) {
 
 void ChSystem::Setup() {
     CH_PROFILE("Setup");
+    CH_TRACE_ZONE("ChSystem::Setup");
 
     timer_setup.start();
 
@@ -644,6 +655,7 @@ void ChSystem::Update(double mytime, bool update_assets) {
 
 void ChSystem::Update(bool update_assets) {
     CH_PROFILE("Update");
+    CH_TRACE_ZONE("ChSystem::Update");
 
     if (!is_initialized)
         SetupInitial();
@@ -961,6 +973,7 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
                                     bool force_setup              // if true, call the solver's Setup() function
 ) {
     CH_PROFILE("StateSolveCorrection");
+    CH_TRACE_ZONE("ChSystem::StateSolveCorrection");
 
     if (force_state_scatter)
         StateScatter(x, v, T, full_update);
@@ -1017,6 +1030,7 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
     // Solve the problem
     // The solution is scattered in the provided system descriptor
     timer_ls_solve.start();
+    descriptor->SetNumThreads(nthreads_chrono);
     GetSolver()->Solve(*descriptor);
     timer_ls_solve.stop();
 
@@ -1154,6 +1168,7 @@ int ChSystem::GetNcontacts() {
 
 double ChSystem::ComputeCollisions() {
     CH_PROFILE("ComputeCollisions");
+    CH_TRACE_ZONE("ChSystem::ComputeCollisions");
 
     double mretC = 0.0;
 
@@ -1170,6 +1185,7 @@ double ChSystem::ComputeCollisions() {
     // for ChBody and ChParticles is used always.
     {
         CH_PROFILE("ReportContacts");
+        CH_TRACE_ZONE("ChSystem::ReportContacts");
 
         collision_system->ReportContacts(contact_container.get());
 
@@ -1303,7 +1319,17 @@ int ChSystem::DoStepDynamics(double step_size) {
 
     applied_forces_current = false;
     step = step_size;
-    return Integrate_Y();
+
+    bool success;
+    {
+        CH_TRACE_ZONE("ChSystem::DoStepDynamics");
+        success = Integrate_Y();
+    }
+
+    // Export the profiling zones recorded during this step (no-op if tracing is disabled)
+    utils::ChTraceProfiler::EndStep(stepcount, ch_time);
+
+    return success;
 }
 
 // -----------------------------------------------------------------------------
@@ -1312,6 +1338,7 @@ int ChSystem::DoStepDynamics(double step_size) {
 
 bool ChSystem::Integrate_Y() {
     CH_PROFILE("Integrate_Y");
+    CH_TRACE_ZONE("ChSystem::Integrate_Y");
 
     ResetTimers();
 
@@ -1359,6 +1386,7 @@ bool ChSystem::Integrate_Y() {
     // PERFORM TIME STEP HERE!
     {
         CH_PROFILE("Advance");
+        CH_TRACE_ZONE("ChSystem::Advance");
         timer_advance.start();
         timestepper->Advance(step);
         timer_advance.stop();
@@ -1809,6 +1837,141 @@ bool ChSystem::DoFullAssembly() {
     return last_err;
 }
 
+// -----------------------------------------------------------------------------
+//  BINARY CHECKPOINT
+
+namespace {
+
+// Reaction cache of a persistent Bullet contact point, identified by the indices of the two bodies, the indices of
+// the two collision shapes, and the contact point in the local frame of the first body.
+struct ReactionCacheRecord {
+    int32_t bodyA;
+    int32_t bodyB;
+    int32_t shapeA;
+    int32_t shapeB;
+    double pointA[3];
+    float cache[3];
+    float padding;
+};
+
+// Map the collision objects in the manifold to body indices (return false if not both bodies).
+bool GetManifoldBodies(const btPersistentManifold* manifold,
+                       const std::unordered_map<ChContactable*, int32_t>& body_index,
+                       int32_t& bodyA,
+                       int32_t& bodyB) {
+    auto modelA = static_cast<collision::ChCollisionModel*>(manifold->getBody0()->getUserPointer());
+    auto modelB = static_cast<collision::ChCollisionModel*>(manifold->getBody1()->getUserPointer());
+    auto itA = body_index.find(modelA->GetContactable());
+    auto itB = body_index.find(modelB->GetContactable());
+    if (itA == body_index.end() || itB == body_index.end())
+        return false;
+    bodyA = itA->second;
+    bodyB = itB->second;
+    return true;
+}
+
+}  // end anonymous namespace
+
+void ChSystem::CheckpointOut(utils::ChCheckpoint& checkpoint) const {
+    double state[3] = {ch_time, step, static_cast<double>(stepcount)};
+    checkpoint.SetSection("system.state", state, sizeof(state), sizeof(double));
+
+    // Reaction caches are only used by NSC contacts
+    auto bullet = std::dynamic_pointer_cast<collision::ChCollisionSystemBullet>(collision_system);
+    if (GetContactMethod() != ChContactMethod::NSC || !bullet)
+        return;
+
+    std::unordered_map<ChContactable*, int32_t> body_index;
+    const auto& bodies = assembly.Get_bodylist();
+    for (size_t i = 0; i < bodies.size(); i++)
+        body_index[bodies[i].get()] = static_cast<int32_t>(i);
+
+    std::vector<ReactionCacheRecord> records;
+    auto dispatcher = bullet->GetBulletCollisionWorld()->getDispatcher();
+    for (int i = 0; i < dispatcher->getNumManifolds(); i++) {
+        auto manifold = dispatcher->getManifoldByIndexInternal(i);
+        ReactionCacheRecord record = {};
+        if (!GetManifoldBodies(manifold, body_index, record.bodyA, record.bodyB))
+            continue;
+        for (int j = 0; j < manifold->getNumContacts(); j++) {
+            const auto& pt = manifold->getContactPoint(j);
+            if (pt.reactions_cache[0] == 0 && pt.reactions_cache[1] == 0 && pt.reactions_cache[2] == 0)
+                continue;
+            record.shapeA = pt.m_index0;
+            record.shapeB = pt.m_index1;
+            for (int k = 0; k < 3; k++) {
+                record.pointA[k] = pt.m_localPointA[k];
+                record.cache[k] = pt.reactions_cache[k];
+            }
+            records.push_back(record);
+        }
+    }
+
+    checkpoint.SetArray("bullet.reaction_cache", records);
+}
+
+void ChSystem::CheckpointIn(const utils::ChCheckpoint& checkpoint) {
+    size_t n;
+    auto state = checkpoint.GetArray<double>("system.state", n);
+    if (state && n == 3) {
+        ch_time = state[0];
+        step = state[1];
+        stepcount = static_cast<size_t>(state[2]);
+    }
+
+    auto records = checkpoint.GetArray<ReactionCacheRecord>("bullet.reaction_cache", n);
+    auto bullet = std::dynamic_pointer_cast<collision::ChCollisionSystemBullet>(collision_system);
+    if (!records || n == 0 || !bullet)
+        return;
+
+    // Group the cached reactions by pair of bodies
+    std::map<std::pair<int32_t, int32_t>, std::vector<const ReactionCacheRecord*>> pairs;
+    for (size_t i = 0; i < n; i++)
+        pairs[std::make_pair(records[i].bodyA, records[i].bodyB)].push_back(&records[i]);
+
+    std::unordered_map<ChContactable*, int32_t> body_index;
+    const auto& bodies = assembly.Get_bodylist();
+    for (size_t i = 0; i < bodies.size(); i++)
+        body_index[bodies[i].get()] = static_cast<int32_t>(i);
+
+    // Regenerate the persistent contact manifolds and seed the caches of the contact points that match a cached
+    // point (same bodies and shapes, and closest local point on the first body, within the collision envelope)
+    ComputeCollisions();
+
+    auto dispatcher = bullet->GetBulletCollisionWorld()->getDispatcher();
+    for (int i = 0; i < dispatcher->getNumManifolds(); i++) {
+        auto manifold = dispatcher->getManifoldByIndexInternal(i);
+        int32_t bodyA, bodyB;
+        if (!GetManifoldBodies(manifold, body_index, bodyA, bodyB))
+            continue;
+        auto found = pairs.find(std::make_pair(bodyA, bodyB));
+        if (found == pairs.end())
+            continue;
+        double tolerance = manifold->getContactBreakingThreshold();
+        for (int j = 0; j < manifold->getNumContacts(); j++) {
+            auto& pt = manifold->getContactPoint(j);
+            const ReactionCacheRecord* match = nullptr;
+            double min_dist2 = tolerance * tolerance;
+            for (auto record : found->second) {
+                if (record->shapeA != pt.m_index0 || record->shapeB != pt.m_index1)
+                    continue;
+                double dx = record->pointA[0] - pt.m_localPointA[0];
+                double dy = record->pointA[1] - pt.m_localPointA[1];
+                double dz = record->pointA[2] - pt.m_localPointA[2];
+                double dist2 = dx * dx + dy * dy + dz * dz;
+                if (dist2 <= min_dist2) {
+                    min_dist2 = dist2;
+                    match = record;
+                }
+            }
+            if (match) {
+                for (int k = 0; k < 3; k++)
+                    pt.reactions_cache[k] = match->cache[k];
+            }
+        }
+    }
+}
+
 // -----------------------------------------------------------------------------
 //  STREAMING - FILE HANDLING
 
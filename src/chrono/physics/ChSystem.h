@@ -43,6 +43,10 @@
 
 namespace chrono {
 
+namespace utils {
+class ChCheckpoint;
+}
+
 /// Physical system.
 ///
 /// This class is used to represent a multibody physical system,
@@ -234,8 +238,11 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     /// Set the number of OpenMP threads used by Chrono itself, Eigen, and the collision detection system.
     /// <pre>
-    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians) and
-    ///                           in SCM deformable terrain calculations.
+    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians),
+    ///                           in the assembly loops over bodies and links (update, state gather/scatter,
+    ///                           residual loads; only if enabled with SetParallelAssembly), in the
+    ///                           graph-colored PSOR solver (ChSolverPSORcolored), and in SCM deformable
+    ///                           terrain calculations.
     ///   num_threads_collision - used in parallelization of collision detection (if applicable).
     ///                           If passing 0, then num_threads_collision = num_threads_chrono.
     ///   num_threads_eigen     - used in the Eigen sparse direct solvers and a few linear algebra operations.
@@ -699,6 +706,17 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Tell if the system will put to sleep the bodies whose motion has almost come to a rest.
     bool GetUseSleeping() const { return use_sleeping; }
 
+    /// Enable/disable the parallel update of bodies and links in the assembly (default: false).
+    /// If enabled, the update and state passes over bodies and links use the number of Chrono threads (see
+    /// SetNumThreads). In that case, any object shared by several bodies or links and evaluated during their update
+    /// (e.g., a ChFunction used by multiple motors, or a user-provided force functor) must be safe to call
+    /// concurrently.
+    /// The ChFunction classes provided with Chrono are thread-safe in this sense.
+    void SetParallelAssembly(bool val) { parallel_assembly = val; }
+
+    /// Tell if bodies and links in the assembly are updated in parallel.
+    bool GetParallelAssembly() const { return parallel_assembly; }
+
   private:
     /// Put bodies to sleep if possible. Also awakens sleeping bodies, if needed.
     /// Returns true if some body changed from sleep to no sleep or viceversa,
@@ -706,6 +724,7 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// because the sleeping policy changed the totalDOFs and offsets.
     bool ManageSleepingBodies();
 
+  protected:
     /// Performs a single dynamical simulation step, according to
     /// current values of:  Y, time, step  (and other minor settings)
     /// Depending on the integration type, it switches to one of the following:
@@ -716,6 +735,8 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     /// Advances the dynamical simulation for a single step, of length step_size.
     /// This function is typically called many times in a loop in order to simulate up to a desired end time.
+    /// If tracing is enabled, the profiling zones recorded during the step are exported at its end (see
+    /// utils::ChTraceProfiler).
     int DoStepDynamics(double step_size);
 
     /// Performs integration until the m_endtime is exactly
@@ -855,6 +876,17 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     // SERIALIZATION
     //
 
+    /// Write the system time and step information, as well as any warm-start data, to the given binary checkpoint.
+    /// For NSC systems using the Bullet collision system, the contact reaction caches (the multipliers of the previous
+    /// step, used to warm-start the VI solver) are stored for each persistent contact point.
+    /// Derived classes may override this function to store additional data (make sure to call the base method).
+    virtual void CheckpointOut(utils::ChCheckpoint& checkpoint) const;
+
+    /// Restore the system time and step information, as well as any warm-start data, from the given binary checkpoint.
+    /// This function is called after all bodies were re-created from the checkpoint data. If contact reaction caches
+    /// are available, collision detection is performed and the caches of matching contact points are re-seeded.
+    virtual void CheckpointIn(const utils::ChCheckpoint& checkpoint);
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive);
 
@@ -901,6 +933,8 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     bool use_sleeping;  ///< if true, put to sleep objects that come to rest
 
+    bool parallel_assembly;  ///< if true, update bodies and links of the assembly in parallel
+
     std::shared_ptr<ChSystemDescriptor> descriptor;  ///< system descriptor
     std::shared_ptr<ChSolver> solver;                ///< solver for DVI or DAE problem
 
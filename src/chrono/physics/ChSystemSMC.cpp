@@ -17,6 +17,8 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 
 #include "chrono/physics/ChSystemSMC.h"
@@ -38,7 +40,12 @@ ChSystemSMC::ChSystemSMC(bool use_material_properties)
       m_contact_model(Hertz),
       m_adhesion_model(AdhesionForceModel::Constant),
       m_tdispl_model(OneStep),
-      m_stiff_contact(false) {
+      m_stiff_contact(false),
+      m_adaptive_step(false),
+      m_adaptive_resolution(50),
+      m_adaptive_step_min(0),
+      m_adaptive_num_steps(0),
+      m_adaptive_num_rejections(0) {
     descriptor = chrono_types::make_shared<ChSystemDescriptor>();
 
     SetSolverType(ChSolver::Type::PSOR);
@@ -56,7 +63,13 @@ ChSystemSMC::ChSystemSMC(bool use_material_properties)
     m_characteristicVelocity = 1;
 }
 
-ChSystemSMC::ChSystemSMC(const ChSystemSMC& other) : ChSystem(other) {}
+ChSystemSMC::ChSystemSMC(const ChSystemSMC& other)
+    : ChSystem(other),
+      m_adaptive_step(other.m_adaptive_step),
+      m_adaptive_resolution(other.m_adaptive_resolution),
+      m_adaptive_step_min(other.m_adaptive_step_min),
+      m_adaptive_num_steps(0),
+      m_adaptive_num_rejections(0) {}
 
 void ChSystemSMC::SetContactContainer(std::shared_ptr<ChContactContainer> container) {
     if (std::dynamic_pointer_cast<ChContactContainerSMC>(container))
@@ -67,6 +80,138 @@ void ChSystemSMC::SetSlipVelocityThreshold(double vel) {
     m_minSlipVelocity = std::max(vel, std::numeric_limits<double>::epsilon());
 }
 
+// -----------------------------------------------------------------------------
+// Adaptive step size control
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// Callback for finding the smallest ratio of effective mass and contact stiffness over all contacts.
+class StableStepContactCallback : public ChContactContainer::ReportContactCallback {
+  public:
+    StableStepContactCallback() : m_min_ratio(std::numeric_limits<double>::infinity()) {}
+
+    virtual bool OnReportContact(const ChVector<>& pA,
+                                 const ChVector<>& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector<>& react_forces,
+                                 const ChVector<>& react_torques,
+                                 ChContactable* objA,
+                                 ChContactable* objB) override {
+        double delta = -distance;
+        double force = std::abs(react_forces.x());
+        if (delta <= 0 || force == 0)
+            return true;
+
+        // Effective mass (inactive objects, e.g. fixed bodies, have infinite mass)
+        double mA = (objA && objA->IsContactActive()) ? objA->GetContactableMass() : 0;
+        double mB = (objB && objB->IsContactActive()) ? objB->GetContactableMass() : 0;
+        if (mA + mB == 0)
+            return true;
+        double m_eff = (mA > 0 && mB > 0) ? mA * mB / (mA + mB) : mA + mB;
+
+        // Contact stiffness (tangent stiffness for a Hertzian contact, upper bound for a Hookean one)
+        double k = 1.5 * force / delta;
+
+        m_min_ratio = std::min(m_min_ratio, m_eff / k);
+        return true;
+    }
+
+    double m_min_ratio;
+};
+
+}  // end anonymous namespace
+
+double ChSystemSMC::EstimateStableStep() {
+    double h = std::min(step_max, step);
+
+    // Contact stiffness criterion
+    auto callback = chrono_types::make_shared<StableStepContactCallback>();
+    contact_container->ReportAllContacts(callback);
+    if (callback->m_min_ratio < std::numeric_limits<double>::infinity())
+        h = std::min(h, CH_C_PI * std::sqrt(callback->m_min_ratio) / m_adaptive_resolution);
+
+    // Body motion criterion: no body may move by more than its collision envelope (or, if larger, a fraction of its
+    // size) relative to another one during a step.
+    for (const auto& body : Get_bodylist()) {
+        if (body->GetBodyFixed() || !body->GetCollide())
+            continue;
+        ChVector<> bbmin;
+        ChVector<> bbmax;
+        body->GetCollisionModel()->GetAABB(bbmin, bbmax);
+        ChVector<> size = bbmax - bbmin;
+        double length = std::max((double)body->GetCollisionModel()->GetEnvelope(),
+                                 0.01 * std::min(size.x(), std::min(size.y(), size.z())));
+        double speed = body->GetPos_dt().Length() + 0.5 * size.Length() * body->GetWvel_par().Length();
+        if (speed * h > 0.5 * length)
+            h = 0.5 * length / speed;
+    }
+
+    return std::max(h, m_adaptive_step_min);
+}
+
+bool ChSystemSMC::Integrate_Y() {
+    if (!m_adaptive_step) {
+        m_adaptive_num_steps = 1;
+        m_adaptive_num_rejections = 0;
+        return ChSystem::Integrate_Y();
+    }
+
+    // Advance by the requested step, using a sequence of steps of estimated stable size
+    double frame_step = step;
+    double end_time = ch_time + frame_step;
+    bool success = true;
+    m_adaptive_num_steps = 0;
+    m_adaptive_num_rejections = 0;
+
+    // State at the beginning of the current step, restored if the step is rejected
+    Setup();
+    ChState x0(GetNcoords_x(), this);
+    ChStateDelta v0(GetNcoords_v(), this);
+    double T0;
+
+    while (end_time - ch_time > 1e-10 * frame_step) {
+        double remaining = end_time - ch_time;
+        double h = EstimateStableStep();
+
+        // Avoid a very small last step, by splitting the remaining interval in two steps not smaller than the minimum
+        // step size (a last step smaller than that is only taken if the remaining interval is itself that small)
+        if (remaining < 1.25 * h)
+            h = (remaining > h) ? std::max(0.5 * remaining, m_adaptive_step_min) : remaining;
+
+        StateGather(x0, v0, T0);
+        size_t stepcount0 = stepcount;
+
+        while (true) {
+            step = h;
+            success = ChSystem::Integrate_Y();
+            step = frame_step;
+            if (!success)
+                break;
+
+            // Accept the step if it is not much larger than the stable step size estimated for the new state (with the
+            // contacts found during this step and the new velocities) or if it cannot be reduced any further
+            double h_new = EstimateStableStep();
+            if (h_new >= 0.5 * h || h <= m_adaptive_step_min)
+                break;
+
+            // Otherwise, restore the state and repeat the step with the new estimate
+            StateScatter(x0, v0, T0, true);
+            stepcount = stepcount0;
+            h = h_new;
+            m_adaptive_num_rejections++;
+        }
+
+        if (!success)
+            break;
+        m_adaptive_num_steps++;
+    }
+
+    return success;
+}
+
 // STREAMING - FILE HANDLING
 
 // Trick to avoid putting the following mapper macro inside the class definition in .h file:
@@ -109,6 +109,47 @@ class ChApi ChSystemSMC : public ChSystem {
     void SetCharacteristicImpactVelocity(double vel) { m_characteristicVelocity = vel; }
     double GetCharacteristicImpactVelocity() const { return m_characteristicVelocity; }
 
+    /// Enable/disable adaptive step size control (default: false).
+    /// If enabled, each call to DoStepDynamics(step) advances the system by 'step' using a sequence of integration
+    /// steps of variable size. Before each of these, a stable step size is estimated (see EstimateStableStep) and
+    /// clamped to the interval [GetAdaptiveStepMin(), min(GetStepMax(), step)]. After each integration step, the
+    /// stable step size is estimated again for the new state (new contacts and velocities); if this estimate is smaller
+    /// than half of the step just taken, the step is rejected, the state is restored, and the step is repeated with the
+    /// new estimate. As such, the step passed to DoStepDynamics acts as an output interval, while quiescent phases are
+    /// simulated with larger steps than fast phases.
+    void EnableAdaptiveStep(bool val) { m_adaptive_step = val; }
+    bool GetAdaptiveStep() const { return m_adaptive_step; }
+
+    /// Set the number of integration steps per contact duration (default: 50).
+    /// Used in estimating the stable step size from the contact stiffness (see EstimateStableStep).
+    void SetAdaptiveStepResolution(double num_steps) { m_adaptive_resolution = num_steps; }
+    double GetAdaptiveStepResolution() const { return m_adaptive_resolution; }
+
+    /// Set the minimum step size with adaptive step size control (default: 0).
+    /// This is independent of the minimum step size of ChSystem (see SetStepMin), which is typically larger than the
+    /// stable step size for SMC contact. Steps of this size are always accepted.
+    void SetAdaptiveStepMin(double step_min) { m_adaptive_step_min = std::max(step_min, 0.0); }
+    double GetAdaptiveStepMin() const { return m_adaptive_step_min; }
+
+    /// Estimate a stable step size for the current state.
+    /// The estimate uses the contacts found at the last collision detection (no additional collision detection is
+    /// performed) and the current body velocities, and is the smallest of:
+    /// - for each contact, the contact duration pi*sqrt(m/k) divided by the adaptive step resolution, with m the
+    ///   effective mass of the contacting objects and k the contact stiffness estimated from the normal contact force
+    ///   and the overlap (as for a Hertzian contact, k = 1.5*F/delta);
+    /// - for each colliding body, half of a characteristic length (the larger of its collision envelope and 1% of the
+    ///   smallest dimension of its bounding box) divided by its largest point speed, so that contacts are detected at
+    ///   small overlaps;
+    /// - the maximum step size (see SetStepMax) and the step size of the last call to DoStepDynamics.
+    /// The result is not smaller than the adaptive minimum step size (see SetAdaptiveStepMin).
+    double EstimateStableStep();
+
+    /// Return the number of (accepted) integration steps taken during the last call to DoStepDynamics.
+    int GetNumAdaptiveSteps() const { return m_adaptive_num_steps; }
+
+    /// Return the number of rejected integration steps during the last call to DoStepDynamics.
+    int GetNumAdaptiveRejections() const { return m_adaptive_num_rejections; }
+
     //
     // SERIALIZATION
     //
@@ -127,6 +168,14 @@ class ChApi ChSystemSMC : public ChSystem {
     bool m_stiff_contact;                        ///< flag indicating stiff contacts (triggers Jacobian calculation)
     double m_minSlipVelocity;                    ///< slip velocity below which no tangential forces are generated
     double m_characteristicVelocity;             ///< characteristic impact velocity (Hooke model)
+    bool m_adaptive_step;                        ///< use adaptive step size control
+    double m_adaptive_resolution;                ///< number of steps per contact duration
+    double m_adaptive_step_min;                  ///< minimum step size with adaptive step size control
+    int m_adaptive_num_steps;                    ///< number of steps taken during the last call to DoStepDynamics
+    int m_adaptive_num_rejections;               ///< number of steps rejected during the last call to DoStepDynamics
+
+    /// Advance the system by the current step, using adaptive step size control if enabled.
+    virtual bool Integrate_Y() override;
 };
 
 CH_CLASS_VERSION(ChSystemSMC, 0)
@@ -15,12 +15,16 @@
 #ifndef CHCONSTRAINT_H
 #define CHCONSTRAINT_H
 
+#include <vector>
+
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChClassFactory.h"
 #include "chrono/core/ChMatrix.h"
 
 namespace chrono {
 
+class ChVariables;
+
 /// Modes for constraint
 enum eChConstraintMode {
     CONSTRAINT_FREE = 0,        ///< the constraint does not enforce anything
@@ -280,6 +284,11 @@ class ChApi ChConstraint {
     /// Same as Build_Cq, but puts the _transposed_ jacobian row as a column.
     virtual void Build_CqT(ChSparseMatrix& storage, int inscol) = 0;
 
+    /// Append to the given list the ChVariables objects referenced by this constraint.
+    /// Used by solvers which need to know which constraints are coupled (e.g., to update constraints in parallel).
+    /// The default implementation does not report any variables; such constraints are treated conservatively.
+    virtual void AppendVariables(std::vector<ChVariables*>& vars) const {}
+
     /// Set offset in global q vector (set automatically by ChSystemDescriptor)
     void SetOffset(int moff) { offset = moff; }
 
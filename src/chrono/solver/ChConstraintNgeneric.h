@@ -56,6 +56,11 @@ class ChApi ChConstraintNgeneric : public ChConstraint {
     /// Access the Nth variable object
     ChVariables* GetVariables_N(size_t n) { return variables[n]; }
 
+    /// Append to the given list all constrained variable objects.
+    virtual void AppendVariables(std::vector<ChVariables*>& vars) const override {
+        vars.insert(vars.end(), variables.begin(), variables.end());
+    }
+
     /// Set references to the constrained objects, each of ChVariables type,
     /// automatically creating/resizing jacobians if needed.
     void SetVariables(std::vector<ChVariables*> mvars);
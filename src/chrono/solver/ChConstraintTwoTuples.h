@@ -123,6 +123,12 @@ class ChConstraintTwoTuples : public ChConstraint {
         tuple_a.Build_CqT(storage, inscol);
         tuple_b.Build_CqT(storage, inscol);
     }
+
+    /// Append to the given list the variable objects of both tuples.
+    virtual void AppendVariables(std::vector<ChVariables*>& vars) const override {
+        tuple_a.AppendVariables(vars);
+        tuple_b.AppendVariables(vars);
+    }
 };
 
 }  // end namespace chrono
@@ -12,17 +12,86 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/core/ChSparsityPatternLearner.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 #define SPM_DEF_SPARSITY 0.9  ///< default predicted sparsity (in [0,1])
 
 namespace chrono {
 
+// Proxy sparse matrix which loads the elements set during assembly directly in the nonzero array of a compressed target
+// matrix, following a scatter map. When recording, the nonzero index of each element is found with a binary search in
+// its row and appended to the map; otherwise, the next index in the map is used, after checking that it corresponds to
+// the element row and column. Like ChSparsityPatternLearner, the proxy itself does not store any elements.
+class ChScatterMapMatrix : public ChSparseMatrix {
+  public:
+    ChScatterMapMatrix(ChSparseMatrix& target, std::vector<int>& map, bool record)
+        : ChSparseMatrix(target.rows(), target.cols()),
+          m_target(target),
+          m_map(map),
+          m_record(record),
+          m_next(0),
+          m_valid(true) {
+        if (record)
+            m_map.clear();
+    }
+
+    virtual void SetElement(int row, int col, double el, bool overwrite = true) override {
+        if (!m_valid)
+            return;
+
+        const int* outer = m_target.outerIndexPtr();
+        const int* inner = m_target.innerIndexPtr();
+        int k;
+        if (m_record) {
+            const int* first = inner + outer[row];
+            const int* last = inner + outer[row + 1];
+            const int* it = std::lower_bound(first, last, col);
+            if (it == last || *it != col) {
+                m_valid = false;
+                return;
+            }
+            k = static_cast<int>(it - inner);
+            m_map.push_back(k);
+        } else {
+            if (m_next >= m_map.size()) {
+                m_valid = false;
+                return;
+            }
+            k = m_map[m_next++];
+            if (k < outer[row] || k >= outer[row + 1] || inner[k] != col) {
+                m_valid = false;
+                return;
+            }
+        }
+
+        double* values = m_target.valuePtr();
+        overwrite ? values[k] = el : values[k] += el;
+    }
+
+    bool IsValid() const { return m_valid; }
+
+  private:
+    ChSparseMatrix& m_target;
+    std::vector<int>& m_map;
+    bool m_record;
+    size_t m_next;
+    bool m_valid;
+};
+
+// ---------------------------------------------------------------------------
+
 ChDirectSolverLS::ChDirectSolverLS()
     : m_lock(false),
       m_use_learner(true),
       m_force_update(true),
+      m_cache_pattern(false),
+      m_scatter_valid(false),
+      m_structure_revision(0),
+      m_pattern_changed(true),
       m_null_pivot_detection(false),
       m_use_rhs_sparsity(false),
       m_use_perm(false),
@@ -40,48 +109,77 @@ void ChDirectSolverLS::ResetTimers() {
 }
 
 bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChDirectSolverLS::Setup");
     m_timer_setup_assembly.start();
 
     // Calculate problem size.
     // Note that ChSystemDescriptor::UpdateCountsAndOffsets was already called at the beginning of the step.
     m_dim = sysd.CountActiveVariables() + sysd.CountActiveConstraints();
 
+    // If caching of the sparsity pattern is enabled, load the matrix through the cached scatter map if:
+    // (a) no explicit update was requested,
+    // (b) the scatter map was recorded for the current problem structure, and
+    // (c) all elements loaded during assembly match the scatter map
+    bool use_cache = m_cache_pattern && !m_force_update && m_scatter_valid &&
+                     m_structure_revision == sysd.GetStructureRevision() && m_mat.rows() == m_dim;
+    if (use_cache)
+        use_cache = LoadMatrixCached(sysd, false);
+
     // If use of the sparsity pattern learner is enabled, call it if:
     // (a) an explicit update was requested (by default this is true at the first call), or
-    // (b) the sparsity pattern is not locked and so has to be re-evaluated at each call
-    bool call_learner = m_use_learner && (m_force_update || !m_lock);
+    // (b) the sparsity pattern is not locked and so has to be re-evaluated at each call, or
+    // (c) the sparsity pattern is cached, but the cache could not be used
+    bool call_learner = !use_cache && m_use_learner && (m_force_update || !m_lock || m_cache_pattern);
 
     // If use of the sparsity pattern learner is disabled, reserve space for nonzeros,
     // using the current sparsity level estimate, if:
     // (a) this is the first call to setup, or
-    // (b) the sparsity pattern is not locked and so has to be re-evaluated at each call
-    bool call_reserve = !m_use_learner && (m_setup_call == 0 || !m_lock);
+    // (b) the sparsity pattern is not locked and so has to be re-evaluated at each call, or
+    // (c) the sparsity pattern is cached, but the cache could not be used
+    bool call_reserve = !use_cache && !m_use_learner && (m_setup_call == 0 || !m_lock || m_cache_pattern);
 
     if (verbose) {
         GetLog() << "Solver setup\n";
         GetLog() << "  call number:    " << m_setup_call << "\n";
         GetLog() << "  use learner?    " << m_use_learner << "\n";
         GetLog() << "  pattern locked? " << m_lock << "\n";
+        GetLog() << "  use cache?      " << m_cache_pattern << "\n";
         GetLog() << "  CALL learner:   " << call_learner << "\n";
         GetLog() << "  CALL reserve:   " << call_reserve << "\n";
+        GetLog() << "  CACHE reused:   " << use_cache << "\n";
     }
 
-    if (call_learner) {
-        ChSparsityPatternLearner sparsity_pattern(m_dim, m_dim);
-        sysd.ConvertToMatrixForm(&sparsity_pattern, nullptr);
-        sparsity_pattern.Apply(m_mat);
-        m_force_update = false;
-    } else if (call_reserve) {
-        double density = (m_sparsity > 0) ? 1 - m_sparsity : 1 - SPM_DEF_SPARSITY;
-        m_mat.resize(m_dim, m_dim);
-        m_mat.reserve(Eigen::VectorXi::Constant(m_dim, static_cast<int>(m_dim * density)));
+    if (!use_cache) {
+        if (call_learner) {
+            ChSparsityPatternLearner sparsity_pattern(m_dim, m_dim);
+            sysd.ConvertToMatrixForm(&sparsity_pattern, nullptr);
+            sparsity_pattern.Apply(m_mat);
+            m_force_update = false;
+        } else if (call_reserve) {
+            double density = (m_sparsity > 0) ? 1 - m_sparsity : 1 - SPM_DEF_SPARSITY;
+            m_mat.resize(m_dim, m_dim);
+            m_mat.reserve(Eigen::VectorXi::Constant(m_dim, static_cast<int>(m_dim * density)));
+        }
+
+        // Let the system descriptor load the current matrix
+        sysd.ConvertToMatrixForm(&m_mat, nullptr);
+
+        // Allow the matrix to be compressed
+        m_mat.makeCompressed();
+
+        // Record the scatter map for the new sparsity pattern (reloading the matrix if recording failed)
+        if (m_cache_pattern) {
+            m_scatter_valid = LoadMatrixCached(sysd, true);
+            m_structure_revision = sysd.GetStructureRevision();
+            if (!m_scatter_valid) {
+                sysd.ConvertToMatrixForm(&m_mat, nullptr);
+                m_mat.makeCompressed();
+            }
+        }
     }
 
-    // Let the system descriptor load the current matrix
-    sysd.ConvertToMatrixForm(&m_mat, nullptr);
-
-    // Allow the matrix to be compressed
-    m_mat.makeCompressed();
+    // The concrete solver can reuse its symbolic analysis only if the cached pattern was used
+    m_pattern_changed = !use_cache;
 
     m_timer_setup_assembly.stop();
 
@@ -108,7 +206,15 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
     return result;
 }
 
+bool ChDirectSolverLS::LoadMatrixCached(ChSystemDescriptor& sysd, bool record) {
+    std::fill(m_mat.valuePtr(), m_mat.valuePtr() + m_mat.nonZeros(), 0.0);
+    ChScatterMapMatrix proxy(m_mat, m_scatter_map, record);
+    sysd.ConvertToMatrixForm(&proxy, nullptr);
+    return proxy.IsValid();
+}
+
 double ChDirectSolverLS::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChDirectSolverLS::Solve");
     // Assemble the problem right-hand side vector
     m_timer_solve_assembly.start();
     sysd.ConvertToMatrixForm(nullptr, &m_rhs);
@@ -145,6 +251,9 @@ double ChDirectSolverLS::Solve(ChSystemDescriptor& sysd) {
 bool ChDirectSolverLS::SetupCurrent() {
     m_timer_setup_assembly.start();
 
+    // The matrix was loaded externally, so its sparsity pattern may have changed
+    m_pattern_changed = true;
+
     // Allow the matrix to be compressed, if not yet compressed
     m_mat.makeCompressed();
 
@@ -232,7 +341,10 @@ void ChDirectSolverLS::ArchiveIN(ChArchiveIn& marchive) {
 // ---------------------------------------------------------------------------
 
 bool ChSolverSparseLU::FactorizeMatrix() {
-    m_engine.compute(m_mat);
+    // Reuse the symbolic analysis (column ordering and elimination tree) if the sparsity pattern did not change
+    if (m_pattern_changed)
+        m_engine.analyzePattern(m_mat);
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
@@ -261,7 +373,10 @@ void ChSolverSparseLU::PrintErrorMessage() {
 // ---------------------------------------------------------------------------
 
 bool ChSolverSparseQR::FactorizeMatrix() {
-    m_engine.compute(m_mat);
+    // Reuse the symbolic analysis (column ordering) if the sparsity pattern did not change
+    if (m_pattern_changed)
+        m_engine.analyzePattern(m_mat);
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
@@ -15,6 +15,8 @@
 #ifndef CH_DIRECTSOLVER_LS_H
 #define CH_DIRECTSOLVER_LS_H
 
+#include <vector>
+
 #include "chrono/core/ChMatrix.h"
 #include "chrono/core/ChTimer.h"
 #include "chrono/solver/ChSolverLS.h"
@@ -37,9 +39,10 @@ performing the actual matrix factorization and then computing the solution vecto
 See ChSolverMkl (which implements Eigen's interface to the Intel MKL Pardiso solver) and ChSolverMumps (which interfaces
 to the MUMPS solver).
 
-ChDirectSolverLS manages the detection and update of the matrix sparsity pattern, providing two main features:
+ChDirectSolverLS manages the detection and update of the matrix sparsity pattern, providing three main features:
 - sparsity pattern lock
 - sparsity pattern learning
+- sparsity pattern caching
 
 The sparsity pattern \e lock skips sparsity identification or reserving memory for nonzeros on all but the first call to
 Setup. This feature is intended for problems where the system matrix sparsity pattern does not change significantly from
@@ -56,6 +59,14 @@ to a fully dense matrix). This value is used if the sparsity pattern learner is
 space for matrix indices and nonzeros.
 See #SetSparsityEstimate();
 
+The sparsity pattern \e caching feature records, together with the matrix sparsity pattern, the location in the matrix
+nonzero array of each element loaded during assembly. On subsequent calls to Setup, the matrix values are overwritten in
+place and the concrete solver can reuse the symbolic analysis of the matrix (e.g., the fill-reducing ordering). The
+cache is rebuilt only when the system descriptor reports a structural change (see
+ChSystemDescriptor::GetStructureRevision) or when the loaded elements do not match the cached ones. This feature is
+intended for problems with a constant sparsity pattern, such as FEA models.\n
+See #CacheSparsityPattern();
+
 <br>
 
 <div class="ce-warning">
@@ -92,6 +103,12 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// or structure occurred. This function has no effect if the sparsity pattern learner is disabled.
     void ForceSparsityPatternUpdate() { m_force_update = true; }
 
+    /// Enable/disable caching of the sparsity pattern and of the matrix assembly scatter map (default: false).\n
+    /// If enabled, the matrix is assembled by writing values directly in its nonzero array and the symbolic analysis
+    /// of the matrix is reused (if supported by the concrete solver), as long as the problem structure does not change.
+    /// If enabled, this option takes precedence over the sparsity pattern lock.
+    void CacheSparsityPattern(bool val) { m_cache_pattern = val; }
+
     /// Set estimate for matrix sparsity, a value in [0,1], with 0 indicating a fully dense matrix (default: 0.9).\n
     /// Only used if the sparsity pattern learner is disabled.
     void SetSparsityEstimate(double sparsity) { m_sparsity = sparsity; }
@@ -188,6 +205,11 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// This function is only called if Factorize or Solve returned false.
     virtual void PrintErrorMessage() = 0;
 
+    /// Load the problem matrix through the cached scatter map, after zeroing its values.
+    /// If 'record' is true, the scatter map is rebuilt for the current sparsity pattern of the matrix.
+    /// Return false if an element does not match the scatter map (or the sparsity pattern, when recording).
+    bool LoadMatrixCached(ChSystemDescriptor& sysd, bool record);
+
     /// Indicate whether or not the #Solve() phase requires an up-to-date problem matrix.
     /// Typically, direct solvers only require the matrix for their #Setup() phase.
     virtual bool SolveRequiresMatrix() const override { return false; }
@@ -206,6 +228,12 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     bool m_use_learner;   ///< use the sparsity pattern learner?
     bool m_force_update;  ///< force a call to the sparsity pattern learner?
 
+    bool m_cache_pattern;               ///< cache the sparsity pattern and the assembly scatter map?
+    bool m_scatter_valid;               ///< is the cached scatter map valid?
+    unsigned int m_structure_revision;  ///< problem structure revision for the cached scatter map
+    std::vector<int> m_scatter_map;     ///< nonzero index of each element loaded during matrix assembly
+    bool m_pattern_changed;             ///< did the sparsity pattern change since the last factorization?
+
     bool m_use_perm;              ///< use of the permutation vector?
     bool m_use_rhs_sparsity;      ///< leverage right-hand side sparsity?
     bool m_null_pivot_detection;  ///< enable detection of zero pivots?
@@ -0,0 +1,135 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/solver/ChFlatConstraints.h"
+#include "chrono/solver/ChSystemDescriptor.h"
+#include "chrono/utils/ChTraceProfiler.h"
+
+namespace chrono {
+
+ChFlatConstraints::ChFlatConstraints() : m_valid(false) {}
+
+bool ChFlatConstraints::Update(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChFlatConstraints::Update");
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+
+    m_valid = false;
+
+    int n_q = sysd.CountActiveVariables();
+    int n_c = sysd.CountActiveConstraints();
+
+    // Map each column to the variables object it belongs to
+    m_col_vars.assign(n_q, nullptr);
+    for (auto var : mvariables) {
+        if (var->IsActive())
+            std::fill_n(m_col_vars.begin() + var->GetOffset(), var->Get_ndof(), var);
+    }
+
+    // Number of non-zeros in each row (full blocks for all active variables of a constraint)
+    Eigen::VectorXi row_nnz = Eigen::VectorXi::Zero(n_c);
+    for (auto c : mconstraints) {
+        if (!c->IsActive())
+            continue;
+        m_vars.clear();
+        c->AppendVariables(m_vars);
+        if (m_vars.empty())
+            return false;
+        for (auto var : m_vars) {
+            if (var->IsActive())
+                row_nnz[c->GetOffset()] += var->Get_ndof();
+        }
+    }
+
+    // Load the constraint Jacobians and cfm terms
+    m_Cq.resize(n_c, n_q);
+    m_Cq.reserve(row_nnz);
+    m_cfm.resize(n_c);
+    for (auto c : mconstraints) {
+        if (!c->IsActive())
+            continue;
+        c->Build_Cq(m_Cq, c->GetOffset());
+        m_cfm(c->GetOffset()) = c->Get_cfm_i();
+    }
+    m_Cq.makeCompressed();
+
+    // Check that each row consists of complete variable blocks. A row with fewer non-zeros than expected indicates
+    // a constraint acting more than once on the same variables.
+    const int* outer = m_Cq.outerIndexPtr();
+    const int* inner = m_Cq.innerIndexPtr();
+    for (int i = 0; i < n_c; i++) {
+        if (outer[i + 1] - outer[i] != row_nnz[i])
+            return false;
+        for (int k = outer[i]; k < outer[i + 1];) {
+            ChVariables* var = m_col_vars[inner[k]];
+            int ndof = var->Get_ndof();
+            if (inner[k] != var->GetOffset() || k + ndof > outer[i + 1] || inner[k + ndof - 1] != inner[k] + ndof - 1)
+                return false;
+            k += ndof;
+        }
+    }
+
+    // Premultiply each Jacobian block by the inverse mass of the corresponding variables
+    m_Eq = m_Cq;
+    const double* cq = m_Cq.valuePtr();
+    double* eq = m_Eq.valuePtr();
+#pragma omp parallel for schedule(static) num_threads(sysd.GetNumThreads())
+    for (int i = 0; i < n_c; i++) {
+        for (int k = outer[i]; k < outer[i + 1];) {
+            ChVariables* var = m_col_vars[inner[k]];
+            int ndof = var->Get_ndof();
+            var->Compute_invMb_v(Eigen::Map<ChVectorDynamic<>>(eq + k, ndof),
+                                 Eigen::Map<const ChVectorDynamic<>>(cq + k, ndof));
+            k += ndof;
+        }
+    }
+
+    m_valid = true;
+    return true;
+}
+
+void ChFlatConstraints::ShurComplementProduct(ChVectorDynamic<>& result,
+                                              const ChVectorDynamic<>& lvector,
+                                              std::vector<bool>* enabled) {
+    assert(m_valid);
+    assert(lvector.size() == m_Cq.rows());
+
+    if (!enabled) {
+        // result = [Cq]*([invM][Cq]'*l) + [E]*l
+        m_u.noalias() = m_Eq.transpose() * lvector;
+        result.noalias() = m_Cq * m_u;
+        result += m_cfm.cwiseProduct(lvector);
+        return;
+    }
+
+    // Exclude the multipliers of the constraints which are not enabled
+    m_l = lvector;
+    for (int i = 0; i < m_l.size(); i++) {
+        if (!(*enabled)[i])
+            m_l(i) = 0;
+    }
+
+    m_u.noalias() = m_Eq.transpose() * m_l;
+    result.noalias() = m_Cq * m_u;
+    result += m_cfm.cwiseProduct(m_l);
+
+    for (int i = 0; i < result.size(); i++) {
+        if (!(*enabled)[i])
+            result(i) = 0;  // not enabled constraints, just set to 0 result
+    }
+}
+
+}  // end namespace chrono
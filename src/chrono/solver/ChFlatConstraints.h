@@ -0,0 +1,103 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+
+#ifndef CH_FLAT_CONSTRAINTS_H
+#define CH_FLAT_CONSTRAINTS_H
+
+#include <vector>
+
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+
+class ChSystemDescriptor;
+class ChVariables;
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Flattened storage of the active constraints of a system descriptor, for use by iterative VI solvers.\n
+/// The Jacobians [Cq] of all active constraints and the corresponding [Eq]=[invM][Cq]' blocks are stored as rows of
+/// two compressed sparse matrices with identical sparsity patterns (row i corresponds to the constraint with offset i,
+/// columns are the offsets of the active variables). The cfm terms are stored in a dense vector. With this data,
+/// the Schur complement product and the row operations needed by PSOR-like methods do not require any virtual calls
+/// to ChConstraint or ChVariables objects.\n
+/// The flat representation must be rebuilt with Update() whenever the constraint Jacobians change (typically, once
+/// per solve). It is only valid if all active constraints report their variables (see
+/// ChConstraint::AppendVariables) and load full Jacobian blocks for each of them; otherwise, Update() returns false
+/// and solvers must use the constraint objects directly.
+class ChApi ChFlatConstraints {
+  public:
+    ChFlatConstraints();
+
+    /// Build the flat representation of the active constraints in the given system descriptor.
+    /// The number of threads specified in the system descriptor is used to compute the [Eq] blocks.
+    /// Return false if the constraints cannot be represented in flat form.
+    bool Update(ChSystemDescriptor& sysd);
+
+    /// Return true if the last call to Update() was successful.
+    bool IsValid() const { return m_valid; }
+
+    /// Return the number of (active) constraints, i.e. the number of rows of [Cq].
+    int GetNumConstraints() const { return static_cast<int>(m_Cq.rows()); }
+
+    /// Return the number of (active) variable coordinates, i.e. the number of columns of [Cq].
+    int GetNumCoordinates() const { return static_cast<int>(m_Cq.cols()); }
+
+    /// Access the matrix of constraint Jacobians.
+    const ChSparseMatrix& GetCq() const { return m_Cq; }
+
+    /// Access the matrix [Eq]' = [Cq][invM] (the rows of [Cq] premultiplied by the inverse mass).
+    const ChSparseMatrix& GetEq() const { return m_Eq; }
+
+    /// Perform the product with the Schur complement matrix
+    /// <pre>
+    ///    result = [N]*l = [ [Cq][M^(-1)][Cq'] + [E] ] * l
+    /// </pre>
+    /// Constraints with enabled=false (if an 'enabled' vector is provided) are not handled and their result is 0.
+    /// Unlike ChSystemDescriptor::ShurComplementProduct, this function does not modify the variables 'qb' data.
+    void ShurComplementProduct(ChVectorDynamic<>& result,
+                               const ChVectorDynamic<>& lvector,
+                               std::vector<bool>* enabled = nullptr);
+
+    /// Compute the product [Cq_i]*q for the i-th constraint, with q a system-level vector of variable coordinates.
+    double Compute_Cq_q(int i, const ChVectorDynamic<>& q) const {
+        double result = 0;
+        for (int k = m_Cq.outerIndexPtr()[i]; k < m_Cq.outerIndexPtr()[i + 1]; k++)
+            result += m_Cq.valuePtr()[k] * q(m_Cq.innerIndexPtr()[k]);
+        return result;
+    }
+
+    /// Increment the system-level vector of variable coordinates q by [invM]*[Cq_i]'*deltal, for the i-th constraint.
+    void Increment_q(int i, double deltal, ChVectorDynamic<>& q) const {
+        for (int k = m_Eq.outerIndexPtr()[i]; k < m_Eq.outerIndexPtr()[i + 1]; k++)
+            q(m_Eq.innerIndexPtr()[k]) += m_Eq.valuePtr()[k] * deltal;
+    }
+
+  private:
+    bool m_valid;
+    ChSparseMatrix m_Cq;                   ///< constraint Jacobians (one row per active constraint)
+    ChSparseMatrix m_Eq;                   ///< rows of [Cq][invM], same sparsity pattern as m_Cq
+    ChVectorDynamic<> m_cfm;               ///< constraint force mixing terms
+    ChVectorDynamic<> m_u;                 ///< scratch vector, [invM][Cq]'*l
+    ChVectorDynamic<> m_l;                 ///< scratch vector, masked multipliers
+    std::vector<ChVariables*> m_col_vars;  ///< variables owning each column
+    std::vector<ChVariables*> m_vars;      ///< scratch list of constraint variables
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
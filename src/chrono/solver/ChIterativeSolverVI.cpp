@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChIterativeSolverVI.h"
+#include "chrono/solver/ChSystemDescriptor.h"
 
 namespace chrono {
 
@@ -21,6 +22,8 @@ ChIterativeSolverVI::ChIterativeSolverVI()
       m_omega(1.0),
       m_shlambda(1.0),
       m_iterations(0),
+      m_use_flat(true),
+      m_flat_active(false),
       record_violation_history(false) {}
 
 void ChIterativeSolverVI::SetOmega(double mval) {
@@ -33,6 +36,21 @@ void ChIterativeSolverVI::SetSharpnessLambda(double mval) {
         m_shlambda = mval;
 }
 
+bool ChIterativeSolverVI::UpdateFlatConstraints(ChSystemDescriptor& sysd) {
+    m_flat_active = m_use_flat && m_flat.Update(sysd);
+    return m_flat_active;
+}
+
+void ChIterativeSolverVI::ShurComplementProduct(ChSystemDescriptor& sysd,
+                                                ChVectorDynamic<>& result,
+                                                const ChVectorDynamic<>& lvector,
+                                                std::vector<bool>* enabled) {
+    if (m_flat_active)
+        m_flat.ShurComplementProduct(result, lvector, enabled);
+    else
+        sysd.ShurComplementProduct(result, lvector, enabled);
+}
+
 void ChIterativeSolverVI::AtIterationEnd(double mmaxviolation, double mdeltalambda, unsigned int iternum) {
     if (!record_violation_history)
         return;
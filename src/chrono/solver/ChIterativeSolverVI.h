@@ -17,6 +17,7 @@
 
 #include "chrono/solver/ChSolverVI.h"
 #include "chrono/solver/ChIterativeSolver.h"
+#include "chrono/solver/ChFlatConstraints.h"
 
 namespace chrono {
 
@@ -51,6 +52,10 @@ The 'tolerance' threshold value used in the stopping criteria may have different
 individual iterative VI solver for details.
 
 Diagonal preconditioning is enabled by default, but may not supported by all iterative VI solvers.
+
+By default, the PSOR, APGD, BB, and PMINRES solvers operate on a flattened copy of the constraint Jacobians (see
+ChFlatConstraints), built at the beginning of each solve. If the constraints cannot be represented in flat form, these
+solvers fall back to operating on the individual constraint objects.
 */
 class ChApi ChIterativeSolverVI : public ChIterativeSolver, public ChSolverVI {
   public:
@@ -73,12 +78,20 @@ class ChApi ChIterativeSolverVI : public ChIterativeSolver, public ChSolverVI {
     /// GetViolationHistory).
     void SetRecordViolation(bool mval) { record_violation_history = mval; }
 
+    /// Enable/disable the use of flattened constraint storage (default: true).
+    /// If enabled, solvers which support it operate on contiguous arrays of constraint Jacobians instead of calling
+    /// virtual methods of the individual constraint objects in each iteration (see ChFlatConstraints).
+    void EnableFlatConstraints(bool val) { m_use_flat = val; }
+
     /// Return the current value of the overrelaxation factor.
     double GetOmega() const { return m_omega; }
 
     /// Return the current value of the sharpness factor.
     double GetSharpnessLambda() const { return m_shlambda; }
 
+    /// Return true if flattened constraint storage is enabled.
+    bool UseFlatConstraints() const { return m_use_flat; }
+
     /// Return the number of iterations performed during the last solve.
     virtual int GetIterations() const override { return m_iterations; }
 
@@ -97,6 +110,19 @@ class ChApi ChIterativeSolverVI : public ChIterativeSolver, public ChSolverVI {
     /// Note: 'iternum' starts at 0 for the first iteration.
     void AtIterationEnd(double mmaxviolation, double mdeltalambda, unsigned int iternum);
 
+    /// Build the flattened constraint storage for the given system descriptor, if enabled.
+    /// Must be called at the beginning of each solve. Return true if the flat representation can be used in the
+    /// current solve.
+    bool UpdateFlatConstraints(ChSystemDescriptor& sysd);
+
+    /// Perform the product with the Schur complement matrix, result = [N]*l.
+    /// If available in the current solve, the flattened constraint storage is used; otherwise, this function falls back
+    /// to ChSystemDescriptor::ShurComplementProduct (which also modifies the variables 'qb' data).
+    void ShurComplementProduct(ChSystemDescriptor& sysd,
+                               ChVectorDynamic<>& result,
+                               const ChVectorDynamic<>& lvector,
+                               std::vector<bool>* enabled = nullptr);
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
 
@@ -113,6 +139,10 @@ class ChApi ChIterativeSolverVI : public ChIterativeSolver, public ChSolverVI {
     double m_omega;     ///< over-relaxation factor
     double m_shlambda;  ///< sharpness factor
 
+    bool m_use_flat;           ///< use flattened constraint storage, if possible
+    bool m_flat_active;        ///< flattened constraint storage available in the current solve
+    ChFlatConstraints m_flat;  ///< flattened constraint storage
+
     bool record_violation_history;
     std::vector<double> violation_history;
     std::vector<double> dlambda_history;
@@ -23,6 +23,7 @@ class my_enum_mappers : public ChSolver {
     CH_ENUM_MAPPER_BEGIN(Type);
     CH_ENUM_VAL(Type::PSOR);
     CH_ENUM_VAL(Type::PSSOR);
+    CH_ENUM_VAL(Type::PSOR_COLORED);
     CH_ENUM_VAL(Type::PJACOBI);
     CH_ENUM_VAL(Type::PMINRES);
     CH_ENUM_VAL(Type::BARZILAIBORWEIN);
@@ -42,6 +42,7 @@ class ChApi ChSolver {
         BARZILAIBORWEIN,  ///< Barzilai-Borwein
         APGD,             ///< Accelerated Projected Gradient Descent
         ADDM,             ///< Alternating Direction Method of Multipliers
+        PSOR_COLORED,     ///< Projected SOR with parallel sweeps over graph-colored constraints
         // Direct linear solvers
         SPARSE_LU,        ///< Sparse supernodal LU factorization
         SPARSE_QR,        ///< Sparse left-looking rank-revealing QR factorization
@@ -17,6 +17,7 @@
 
 #include "chrono/solver/ChIterativeSolverLS.h"
 #include "chrono/core/ChSparsityPatternLearner.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -49,6 +50,7 @@ ChSolverADMM::ChSolverADMM(std::shared_ptr<ChDirectSolverLS> my_LS_engine) :
 
 
 double ChSolverADMM::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverADMM::Solve");
 
     switch (this->acceleration) {
     case AdmmAcceleration::BASIC:
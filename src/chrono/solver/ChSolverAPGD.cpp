@@ -15,6 +15,7 @@
 #include "chrono/solver/ChSolverAPGD.h"
 
 #include "chrono/core/ChStream.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 #include <iostream>
 #include <sstream>
@@ -63,15 +64,16 @@ double ChSolverAPGD::Res4(ChSystemDescriptor& sysd) {
     // Project the gradient (for rollback strategy)
     // g_proj = (l-project_orthogonal(l - gdiff*g, fric))/gdiff;
     double gdiff = 1.0 / (nc * nc);
-    sysd.ShurComplementProduct(tmp, gammaNew);  // tmp = N * gammaNew
-    tmp = gammaNew - gdiff * (tmp + r);         // Note: no aliasing issues here
-    sysd.ConstraintsProject(tmp);               // tmp = ProjectionOperator(gammaNew - gdiff * g)
-    tmp = (gammaNew - tmp) / gdiff;             // Note: no aliasing issues here
+    ShurComplementProduct(sysd, tmp, gammaNew);  // tmp = N * gammaNew
+    tmp = gammaNew - gdiff * (tmp + r);          // Note: no aliasing issues here
+    sysd.ConstraintsProject(tmp);                // tmp = ProjectionOperator(gammaNew - gdiff * g)
+    tmp = (gammaNew - tmp) / gdiff;              // Note: no aliasing issues here
 
     return tmp.norm();
 }
 
 double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverAPGD::Solve");
     bool verbose = false;
     const std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     const std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
@@ -84,6 +86,9 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
         mconstraints[ic]->Update_auxiliary();
 
+    // Build the flattened constraint storage used in the Schur complement products
+    UpdateFlatConstraints(sysd);
+
     double L, t;
     double theta;
     double thetaNew;
@@ -143,7 +148,7 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     // (5) L_k = norm(N * (gamma_0 - gamma_hat_0)) / norm(gamma_0 - gamma_hat_0)
     tmp = gamma - gamma_hat;
     L = tmp.norm();
-    sysd.ShurComplementProduct(yNew, tmp, nullptr);  // yNew = N * tmp = N * (gamma - gamma_hat)
+    ShurComplementProduct(sysd, yNew, tmp, nullptr);  // yNew = N * tmp = N * (gamma - gamma_hat)
     L = yNew.norm() / L;
     yNew.setZero();  //// RADU  is this really necessary here?
 
@@ -157,16 +162,16 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     for (m_iterations = 0; m_iterations < m_max_iterations; m_iterations++) {
         // (8) g = N * y_k - r
         // (9) gamma_(k+1) = ProjectionOperator(y_k - t_k * g)
-        sysd.ShurComplementProduct(g, y);  // g = N * y
+        ShurComplementProduct(sysd, g, y);  // g = N * y
         gammaNew = y - t * (g + r);
         sysd.ConstraintsProject(gammaNew);
 
         // (10) while 0.5 * gamma_(k+1)' * N * gamma_(k+1) - gamma_(k+1)' * r >=
         //            0.5 * y_k' * N * y_k - y_k' * r + g' * (gamma_(k+1) - y_k) + 0.5 * L_k * norm(gamma_(k+1) - y_k)^2
-        sysd.ShurComplementProduct(tmp, gammaNew);  // tmp = N * gammaNew;
+        ShurComplementProduct(sysd, tmp, gammaNew);  // tmp = N * gammaNew;
         obj1 = gammaNew.dot(0.5 * tmp + r);
 
-        sysd.ShurComplementProduct(tmp, y);  // tmp = N * y;
+        ShurComplementProduct(sysd, tmp, y);  // tmp = N * y;
         obj2 = y.dot(0.5 * tmp + r) + (gammaNew - y).dot(g + 0.5 * L * (gammaNew - y));
 
         while (obj1 >= obj2) {
@@ -181,10 +186,10 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
             sysd.ConstraintsProject(gammaNew);
 
             // Update obj1 and obj2
-            sysd.ShurComplementProduct(tmp, gammaNew);  // tmp = N * gammaNew;
+            ShurComplementProduct(sysd, tmp, gammaNew);  // tmp = N * gammaNew;
             obj1 = gammaNew.dot(0.5 * tmp + r);
 
-            sysd.ShurComplementProduct(tmp, y);  // tmp = N * y;
+            ShurComplementProduct(sysd, tmp, y);  // tmp = N * y;
             obj2 = y.dot(0.5 * tmp + r) + (gammaNew - y).dot(g + 0.5 * L * (gammaNew - y));
         }  // (14) endwhile
 
@@ -14,6 +14,7 @@
 
 #include "chrono/solver/ChSolverBB.h"
 #include "chrono/core/ChMathematics.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -23,6 +24,7 @@ CH_FACTORY_REGISTER(ChSolverBB)
 ChSolverBB::ChSolverBB() : n_armijo(10), max_armijo_backtrace(3), lastgoodres(1e30) {}
 
 double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverBB::Solve");
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
@@ -70,6 +72,9 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
     for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
         mconstraints[ic]->Update_auxiliary();
 
+    // Build the flattened constraint storage used in the Schur complement products
+    UpdateFlatConstraints(sysd);
+
     // Average all g_i for the triplet of contact constraints n,u,v.
     //  Can be used for the fixed point phase and/or by preconditioner.
     int j_friction_comp = 0;
@@ -143,8 +148,8 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
 
     // g = gradient of 0.5*l'*N*l-l'*b
     // g = N*l-b
-    sysd.ShurComplementProduct(mg, ml);  // 1)  g = N * l
-    mg -= mb;                            // 2)  g = N * l - b_shur
+    ShurComplementProduct(sysd, mg, ml);  // 1)  g = N * l
+    mg -= mb;                             // 2)  g = N * l - b_shur
 
     mg_p = mg;
 
@@ -190,7 +195,7 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
             ml_p = ml + lambda * mdir;
 
             // m_tmp = Nl_p = N*l_p;
-            sysd.ShurComplementProduct(mb_tmp, ml_p);
+            ShurComplementProduct(sysd, mb_tmp, ml_p);
 
             // g_p = N * l_p - b  = Nl_p - b
             mg_p = mb_tmp - mb;
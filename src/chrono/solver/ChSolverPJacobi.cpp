@@ -14,6 +14,7 @@
 
 #include "chrono/solver/ChSolverPJacobi.h"
 #include "chrono/core/ChMathematics.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -25,6 +26,7 @@ ChSolverPJacobi::ChSolverPJacobi() : maxviolation(0) {
 }
 
 double ChSolverPJacobi::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverPJacobi::Solve");
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
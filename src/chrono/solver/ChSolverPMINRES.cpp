@@ -14,6 +14,7 @@
 
 #include "chrono/solver/ChSolverPMINRES.h"
 #include "chrono/core/ChMathematics.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -26,6 +27,7 @@ ChSolverPMINRES::ChSolverPMINRES()
       r_proj_resid(1e30) {}
 
 double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverPMINRES::Solve");
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
@@ -60,6 +62,9 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
     for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
         mconstraints[ic]->Update_auxiliary();
 
+    // Build the flattened constraint storage used in the Schur complement products
+    UpdateFlatConstraints(sysd);
+
     // Average all g_i for the triplet of contact constraints n,u,v.
     //  Can be used as diagonal preconditioner.
     int j_friction_comp = 0;
@@ -133,8 +138,8 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
     // ...
 
     // r = b - N*l;
-    sysd.ShurComplementProduct(mr, ml);  // r = N*l
-    mr = mb - mr;                        // r =-N*l+b
+    ShurComplementProduct(sysd, mr, ml);  // r = N*l
+    mr = mb - mr;                         // r =-N*l+b
 
     // r = (project_orthogonal(l+diff*r, fric) - l)/diff;
     mr = ml + grad_diffstep * mr;    // r = l + diff*r
@@ -151,10 +156,10 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
     mz = mp;
 
     // NMr = N*M*r = N*z
-    sysd.ShurComplementProduct(mNMr, mz);  // NMr = N*z
+    ShurComplementProduct(sysd, mNMr, mz);  // NMr = N*z
 
     // Np = N*p
-    sysd.ShurComplementProduct(mNp, mp);  // Np = N*p
+    ShurComplementProduct(sysd, mNp, mp);  // Np = N*p
 
     //// RADU
     //// Is the above correct?  We always have z=p and therefore NMr = Np...
@@ -194,8 +199,8 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
         sysd.ConstraintsProject(ml);  // l = P(l)
 
         // r = b - N*l;
-        sysd.ShurComplementProduct(mr, ml);  // r = N*l
-        mr = mb - mr;                        // r =-N*l+b
+        ShurComplementProduct(sysd, mr, ml);  // r = N*l
+        mr = mb - mr;                         // r =-N*l+b
 
         // r = (project_orthogonal(l+diff*r, fric) - l)/diff;
         mr = ml + grad_diffstep * mr;
@@ -225,7 +230,7 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
         mNMr_old = mNMr;
 
         // NMr = N*z;
-        sysd.ShurComplementProduct(mNMr, mz);  // NMr = N*z
+        ShurComplementProduct(sysd, mNMr, mz);  // NMr = N*z
 
         // beta = z'*(NMr-NMr_old)/(z_old'*(NMr_old));
         mtmp = mNMr - mNMr_old;
@@ -14,6 +14,7 @@
 
 #include "chrono/solver/ChSolverPSOR.h"
 #include "chrono/core/ChMathematics.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -23,6 +24,7 @@ CH_FACTORY_REGISTER(ChSolverPSOR)
 ChSolverPSOR::ChSolverPSOR() : maxviolation(0) {}
 
 double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverPSOR::Solve");
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
@@ -63,13 +65,30 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
             mvariables[iv]->Compute_invMb_v(mvariables[iv]->Get_qb(), mvariables[iv]->Get_fb());  // q = [M]'*fb
     }
 
+    // If possible, operate on the flattened constraint storage and on a system-level vector of variable coordinates
+    // (instead of the individual constraint and variable objects)
+    bool use_flat = UpdateFlatConstraints(sysd);
+    ChVectorDynamic<> q;
+    if (use_flat)
+        sysd.FromVariablesToVector(q, true);
+
+    auto compute_Cq_q = [&](ChConstraint* c) {
+        return use_flat ? m_flat.Compute_Cq_q(c->GetOffset(), q) : c->Compute_Cq_q();
+    };
+    auto increment_q = [&](ChConstraint* c, double deltal) {
+        if (use_flat)
+            m_flat.Increment_q(c->GetOffset(), deltal, q);
+        else
+            c->Increment_q(deltal);
+    };
+
     // 3)  For all items with variables, add the effect of initial (guessed)
     //     lagrangian reactions of constraints, if a warm start is desired.
     //     Otherwise, if no warm start, simply resets initial lagrangians to zero.
     if (m_warm_start) {
         for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
             if (mconstraints[ic]->IsActive())
-                mconstraints[ic]->Increment_q(mconstraints[ic]->Get_l_i());
+                increment_q(mconstraints[ic], mconstraints[ic]->Get_l_i());
     } else {
         for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
             mconstraints[ic]->Set_l_i(0.);
@@ -90,7 +109,7 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
             // skip computations if constraint not active.
             if (mconstraints[ic]->IsActive()) {
                 // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
-                double mresidual = mconstraints[ic]->Compute_Cq_q() + mconstraints[ic]->Get_b_i() +
+                double mresidual = compute_Cq_q(mconstraints[ic]) + mconstraints[ic]->Get_b_i() +
                                    mconstraints[ic]->Get_cfm_i() * mconstraints[ic]->Get_l_i();
 
                 // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
@@ -127,9 +146,9 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
                         double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
                         double true_delta_1 = new_lambda_1 - old_lambda_friction[1];
                         double true_delta_2 = new_lambda_2 - old_lambda_friction[2];
-                        mconstraints[ic - 2]->Increment_q(true_delta_0);
-                        mconstraints[ic - 1]->Increment_q(true_delta_1);
-                        mconstraints[ic - 0]->Increment_q(true_delta_2);
+                        increment_q(mconstraints[ic - 2], true_delta_0);
+                        increment_q(mconstraints[ic - 1], true_delta_1);
+                        increment_q(mconstraints[ic - 0], true_delta_2);
 
                         if (this->record_violation_history) {
                             maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_0));
@@ -160,7 +179,7 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
 
                     // For all items with variables, add the effect of incremented
                     // (and projected) lagrangian reactions:
-                    mconstraints[ic]->Increment_q(true_delta);
+                    increment_q(mconstraints[ic], true_delta);
 
                     if (this->record_violation_history)
                         maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta));
@@ -184,6 +203,10 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
 
     }  // end iteration loop
 
+    // Scatter the system-level vector back to the variables
+    if (use_flat)
+        sysd.FromVectorToVariables(q);
+
     return maxviolation;
 }
 
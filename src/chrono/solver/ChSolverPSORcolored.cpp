@@ -0,0 +1,316 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/solver/ChSolverPSORcolored.h"
+#include "chrono/core/ChMathematics.h"
+#include "chrono/utils/ChTraceProfiler.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSolverPSORcolored)
+
+ChSolverPSORcolored::ChSolverPSORcolored() : maxviolation(0), color_offsets(1, 0) {}
+
+// -----------------------------------------------------------------------------
+// Constraint coloring
+// -----------------------------------------------------------------------------
+
+// A unit is either a frictional contact triplet (three consecutive CONSTRAINT_FRIC constraints, the first one being
+// the normal component) or a single constraint. Units are colored greedily, in the order of the constraint list, so
+// that no two units with the same color act on the same active variable. Inactive variables (e.g., of fixed bodies)
+// are never modified by the solver and therefore do not introduce conflicts.
+void ChSolverPSORcolored::ColorConstraints(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverPSORcolored::ColorConstraints");
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+
+    // Size the per-variable color masks (indexed by the offsets of the active variables)
+    int n_q = 0;
+    for (auto var : mvariables) {
+        if (var->IsActive())
+            n_q = std::max(n_q, var->GetOffset() + var->Get_ndof());
+    }
+    var_colors.assign(n_q, 0);
+
+    std::vector<int> unit_start;
+    std::vector<int> unit_color;
+    unit_start.reserve(mconstraints.size());
+    unit_color.reserve(mconstraints.size());
+    uncolored_units.clear();
+
+    int num_colors = 0;
+    int i_friction_comp = 0;
+    for (int ic = 0; ic < (int)mconstraints.size(); ic++) {
+        if (!mconstraints[ic]->IsActive())
+            continue;
+
+        int size = 1;
+        if (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) {
+            // Only the normal component of a friction triplet starts a new unit
+            i_friction_comp = (i_friction_comp + 1) % 3;
+            if (i_friction_comp != 1)
+                continue;
+            size = 3;
+        }
+
+        // Collect the variables of all constraints in this unit and find the colors already used at these variables
+        unit_vars.clear();
+        for (int k = 0; k < size; k++)
+            mconstraints[ic + k]->AppendVariables(unit_vars);
+
+        uint64_t used = 0;
+        int num_active = 0;
+        for (auto var : unit_vars) {
+            if (var->IsActive()) {
+                used |= var_colors[var->GetOffset()];
+                num_active++;
+            }
+        }
+
+        // Units with unknown (or only inactive) variables, or without an available color, are processed sequentially
+        if (num_active == 0 || used == ~uint64_t(0)) {
+            uncolored_units.push_back(ic);
+            continue;
+        }
+
+        // Assign the first available color
+        int color = 0;
+        while (used & (uint64_t(1) << color))
+            color++;
+        for (auto var : unit_vars) {
+            if (var->IsActive())
+                var_colors[var->GetOffset()] |= (uint64_t(1) << color);
+        }
+
+        unit_start.push_back(ic);
+        unit_color.push_back(color);
+        num_colors = std::max(num_colors, color + 1);
+    }
+
+    // Group the colored units by color, preserving their relative order
+    color_offsets.assign(num_colors + 1, 0);
+    for (auto color : unit_color)
+        color_offsets[color + 1]++;
+    for (int color = 0; color < num_colors; color++)
+        color_offsets[color + 1] += color_offsets[color];
+
+    std::vector<int> next(color_offsets.begin(), color_offsets.end() - 1);
+    color_units.resize(unit_start.size());
+    for (size_t iu = 0; iu < unit_start.size(); iu++)
+        color_units[next[unit_color[iu]]++] = unit_start[iu];
+}
+
+// -----------------------------------------------------------------------------
+// Projected SOR update of one unit
+// -----------------------------------------------------------------------------
+
+void ChSolverPSORcolored::UpdateUnit(std::vector<ChConstraint*>& mconstraints,
+                                     int start,
+                                     double& violation,
+                                     double& deltalambda) const {
+    if (mconstraints[start]->GetMode() == CONSTRAINT_FRIC) {
+        ChConstraint** c = &mconstraints[start];
+        double old_lambda[3];
+        for (int k = 0; k < 3; k++) {
+            // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+            double mresidual = c[k]->Compute_Cq_q() + c[k]->Get_b_i() + c[k]->Get_cfm_i() * c[k]->Get_l_i();
+
+            // only the normal component contributes to the constraint violation
+            if (k == 0)
+                violation = ChMax(violation, fabs(ChMin(0.0, mresidual)));
+
+            // update:   lambda += delta_lambda;
+            double deltal = (m_omega / c[k]->Get_g_i()) * (-mresidual);
+            old_lambda[k] = c[k]->Get_l_i();
+            c[k]->Set_l_i(old_lambda[k] + deltal);
+        }
+
+        c[0]->Project();  // the N normal component will take care of N,U,V
+
+        for (int k = 0; k < 3; k++) {
+            double new_lambda = c[k]->Get_l_i();
+            // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+            if (m_shlambda != 1.0) {
+                new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda[k];
+                c[k]->Set_l_i(new_lambda);
+            }
+            double true_delta = new_lambda - old_lambda[k];
+            c[k]->Increment_q(true_delta);
+
+            if (this->record_violation_history)
+                deltalambda = ChMax(deltalambda, fabs(true_delta));
+        }
+    } else {
+        ChConstraint* c = mconstraints[start];
+
+        // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+        double mresidual = c->Compute_Cq_q() + c->Get_b_i() + c->Get_cfm_i() * c->Get_l_i();
+
+        // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+        violation = ChMax(violation, fabs(c->Violation(mresidual)));
+
+        // update:   lambda += delta_lambda;
+        double deltal = (m_omega / c->Get_g_i()) * (-mresidual);
+        double old_lambda = c->Get_l_i();
+        c->Set_l_i(old_lambda + deltal);
+
+        // If new lagrangian multiplier does not satisfy inequalities, project
+        // it into an admissible orthant (or, in general, onto an admissible set)
+        c->Project();
+
+        // After projection, the lambda may have changed a bit..
+        double new_lambda = c->Get_l_i();
+
+        // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+        if (m_shlambda != 1.0) {
+            new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
+            c->Set_l_i(new_lambda);
+        }
+
+        double true_delta = new_lambda - old_lambda;
+
+        // For all items with variables, add the effect of incremented
+        // (and projected) lagrangian reactions:
+        c->Increment_q(true_delta);
+
+        if (this->record_violation_history)
+            deltalambda = ChMax(deltalambda, fabs(true_delta));
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Solve
+// -----------------------------------------------------------------------------
+
+double ChSolverPSORcolored::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverPSORcolored::Solve");
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+    int nthreads = sysd.GetNumThreads();
+    int ncons = (int)mconstraints.size();
+    int nvars = (int)mvariables.size();
+
+    m_iterations = 0;
+    maxviolation = 0;
+
+    ColorConstraints(sysd);
+    int num_colors = GetNumColors();
+
+    // 1)  Update auxiliary data in all constraints before starting,
+    //     that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
+    // 2)  Compute, for all items with variables, the initial guess for
+    //     still unconstrained system:
+#pragma omp parallel num_threads(nthreads)
+    {
+#pragma omp for schedule(static) nowait
+        for (int ic = 0; ic < ncons; ic++)
+            mconstraints[ic]->Update_auxiliary();
+
+#pragma omp for schedule(static)
+        for (int iv = 0; iv < nvars; iv++) {
+            if (mvariables[iv]->IsActive())
+                mvariables[iv]->Compute_invMb_v(mvariables[iv]->Get_qb(), mvariables[iv]->Get_fb());  // q = [M]'*fb
+        }
+    }
+
+    // Average all g_i for the triplet of contact constraints n,u,v.
+    auto average_g_i = [&mconstraints](int start) {
+        if (mconstraints[start]->GetMode() != CONSTRAINT_FRIC)
+            return;
+        ChConstraint** c = &mconstraints[start];
+        double g_i = (c[0]->Get_g_i() + c[1]->Get_g_i() + c[2]->Get_g_i()) / 3.0;
+        c[0]->Set_g_i(g_i);
+        c[1]->Set_g_i(g_i);
+        c[2]->Set_g_i(g_i);
+    };
+    int ncolored = (int)color_units.size();
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int iu = 0; iu < ncolored; iu++)
+        average_g_i(color_units[iu]);
+    for (auto start : uncolored_units)
+        average_g_i(start);
+
+    // 3)  For all items with variables, add the effect of initial (guessed)
+    //     lagrangian reactions of constraints, if a warm start is desired.
+    //     Otherwise, if no warm start, simply resets initial lagrangians to zero.
+    if (m_warm_start) {
+        auto warm_start = [&mconstraints](int start) {
+            int size = (mconstraints[start]->GetMode() == CONSTRAINT_FRIC) ? 3 : 1;
+            for (int k = 0; k < size; k++)
+                mconstraints[start + k]->Increment_q(mconstraints[start + k]->Get_l_i());
+        };
+#pragma omp parallel num_threads(nthreads)
+        {
+            for (int color = 0; color < num_colors; color++) {
+#pragma omp for schedule(static)
+                for (int iu = color_offsets[color]; iu < color_offsets[color + 1]; iu++)
+                    warm_start(color_units[iu]);
+            }
+        }
+        for (auto start : uncolored_units)
+            warm_start(start);
+    } else {
+        for (int ic = 0; ic < ncons; ic++)
+            mconstraints[ic]->Set_l_i(0.);
+    }
+
+    // 4)  Perform the iteration loops
+    //     In each iteration, the units of one color are updated concurrently (they do not share any active
+    //     variables), followed by the sequential update of the uncolored units.
+    for (int iter = 0; iter < m_max_iterations; iter++) {
+        maxviolation = 0;
+        double maxdeltalambda = 0;
+
+#pragma omp parallel num_threads(nthreads)
+        {
+            double violation = 0;
+            double deltalambda = 0;
+
+            for (int color = 0; color < num_colors; color++) {
+#pragma omp for schedule(static)
+                for (int iu = color_offsets[color]; iu < color_offsets[color + 1]; iu++)
+                    UpdateUnit(mconstraints, color_units[iu], violation, deltalambda);
+            }
+
+#pragma omp single
+            {
+                for (auto start : uncolored_units)
+                    UpdateUnit(mconstraints, start, violation, deltalambda);
+            }
+
+#pragma omp critical
+            {
+                maxviolation = ChMax(maxviolation, violation);
+                maxdeltalambda = ChMax(maxdeltalambda, deltalambda);
+            }
+        }
+
+        // For recording into violation history, if debugging
+        if (this->record_violation_history)
+            AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+        m_iterations++;
+
+        // Terminate the loop if violation in constraints has been successfully limited.
+        if (maxviolation < m_tolerance)
+            break;
+    }
+
+    return maxviolation;
+}
+
+}  // end namespace chrono
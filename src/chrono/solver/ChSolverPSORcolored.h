@@ -0,0 +1,85 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+
+#ifndef CHSOLVER_PSOR_COLORED_H
+#define CHSOLVER_PSOR_COLORED_H
+
+#include <cstdint>
+#include <vector>
+
+#include "chrono/solver/ChIterativeSolverVI.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// A multithreaded version of the PSOR solver (projective fixed point method, with overrelaxation and immediate
+/// variable update as in SOR methods).\n
+/// Before each solve, the constraints are colored so that constraints with the same color do not act on the same
+/// (active) variables. The three constraints of a frictional contact (normal and two tangential components) are
+/// always treated as a unit. Each iteration sweeps the colors in sequence and the constraints of one color are
+/// updated concurrently, using the number of threads specified in the system descriptor (see
+/// ChSystemDescriptor::SetNumThreads). The results do not depend on the number of threads.\n
+/// Constraints which cannot be assigned one of the first 64 colors, as well as constraints which do not report their
+/// variables (see ChConstraint::AppendVariables), are updated sequentially at the end of each sweep.\n
+/// See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the
+/// solver.
+class ChApi ChSolverPSORcolored : public ChIterativeSolverVI {
+  public:
+    ChSolverPSORcolored();
+
+    ~ChSolverPSORcolored() {}
+
+    virtual Type GetType() const override { return Type::PSOR_COLORED; }
+
+    /// Performs the solution of the problem.
+    /// \return  the maximum constraint violation after termination.
+    virtual double Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                         ) override;
+
+    /// Return the tolerance error reached during the last solve.
+    /// For the PSOR solver, this is the maximum constraint violation.
+    virtual double GetError() const override { return maxviolation; }
+
+    /// Return the number of constraint colors used in the last solve.
+    int GetNumColors() const { return static_cast<int>(color_offsets.size()) - 1; }
+
+    /// Return the number of constraints units (single constraints or frictional contact triplets) which were updated
+    /// sequentially in the last solve.
+    int GetNumUncolored() const { return static_cast<int>(uncolored_units.size()); }
+
+  private:
+    /// Partition the active constraints in units and color the units.
+    void ColorConstraints(ChSystemDescriptor& sysd);
+
+    /// Perform one projected SOR update of the unit starting at the specified constraint.
+    /// Accumulate the constraint violation and the change in Lagrange multipliers.
+    void UpdateUnit(std::vector<ChConstraint*>& constraints, int start, double& violation, double& deltalambda) const;
+
+    double maxviolation;
+
+    std::vector<int> color_units;      ///< first constraint of each colored unit, grouped by color
+    std::vector<int> color_offsets;    ///< start of each color in color_units (size: number of colors + 1)
+    std::vector<int> uncolored_units;  ///< first constraint of each unit updated sequentially
+
+    std::vector<uint64_t> var_colors;     ///< colors already used at each active variable (indexed by offset)
+    std::vector<ChVariables*> unit_vars;  ///< scratch list of variables of a unit
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
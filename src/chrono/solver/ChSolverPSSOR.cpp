@@ -14,6 +14,7 @@
 
 #include "chrono/solver/ChSolverPSSOR.h"
 #include "chrono/core/ChMathematics.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -23,6 +24,7 @@ CH_FACTORY_REGISTER(ChSolverPSSOR)
 ChSolverPSSOR::ChSolverPSSOR() : maxviolation(0) {}
 
 double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverPSSOR::Solve");
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
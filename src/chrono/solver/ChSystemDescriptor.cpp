@@ -25,7 +25,16 @@ CH_FACTORY_REGISTER(ChSystemDescriptor)
 
 #define CH_SPINLOCK_HASHSIZE 203
 
-ChSystemDescriptor::ChSystemDescriptor() : n_q(0), n_c(0), c_a(1.0), freeze_count(false) {
+ChSystemDescriptor::ChSystemDescriptor()
+    : n_q(0),
+      n_c(0),
+      c_a(1.0),
+      num_threads(1),
+      freeze_count(false),
+      n_variables_blocks(0),
+      n_constraints_blocks(0),
+      n_stiffness_blocks(0),
+      structure_revision(0) {
     vconstraints.clear();
     vvariables.clear();
     vstiffness.clear();
@@ -93,10 +102,21 @@ int ChSystemDescriptor::CountActiveConstraints() {
 }
 
 void ChSystemDescriptor::UpdateCountsAndOffsets() {
+    int old_n_q = n_q;
+    int old_n_c = n_c;
+
     freeze_count = false;
     CountActiveVariables();
     CountActiveConstraints();
     freeze_count = true;
+
+    if (n_q != old_n_q || n_c != old_n_c || vvariables.size() != n_variables_blocks ||
+        vconstraints.size() != n_constraints_blocks || vstiffness.size() != n_stiffness_blocks) {
+        n_variables_blocks = vvariables.size();
+        n_constraints_blocks = vconstraints.size();
+        n_stiffness_blocks = vstiffness.size();
+        structure_revision++;
+    }
 }
 
 void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Cq,
@@ -77,11 +77,18 @@ class ChApi ChSystemDescriptor {
 
     double c_a;  // coefficient form M mass matrices in vvariables
 
+    int num_threads;  // number of OpenMP threads available to solvers
+
   private:
     int n_q;            ///< number of active variables
     int n_c;            ///< number of active constraints
     bool freeze_count;  ///< for optimization: avoid to re-count the number of active variables and constraints
 
+    size_t n_variables_blocks;        ///< number of variables blocks at last structural change
+    size_t n_constraints_blocks;      ///< number of constraints at last structural change
+    size_t n_stiffness_blocks;        ///< number of stiffness blocks at last structural change
+    unsigned int structure_revision;  ///< counter of structural changes
+
   public:
     /// Constructor
     ChSystemDescriptor();
@@ -136,8 +143,15 @@ class ChApi ChSystemDescriptor {
     /// Updates counts of scalar variables and scalar constraints,
     /// if you added/removed some item or if you switched some active state,
     /// otherwise CountActiveVariables() and CountActiveConstraints() might fail.
+    /// If the number of variables, constraints, or stiffness blocks changed, the structure revision is incremented.
     virtual void UpdateCountsAndOffsets();
 
+    /// Return the revision number of the problem structure.
+    /// This counter is incremented by UpdateCountsAndOffsets whenever a structural change is detected. Solvers which
+    /// cache data depending on the problem structure (e.g., the sparsity pattern of the assembled system matrix) can
+    /// use it to decide when such data must be rebuilt.
+    unsigned int GetStructureRevision() const { return structure_revision; }
+
     /// Sets the c_a coefficient (default=1) used for scaling the M masses of the vvariables
     /// when performing ShurComplementProduct(), SystemProduct(), ConvertToMatrixForm(),
     virtual void SetMassFactor(const double mc_a) { c_a = mc_a; }
@@ -146,6 +160,13 @@ class ChApi ChSystemDescriptor {
     /// when performing ShurComplementProduct(), SystemProduct(), ConvertToMatrixForm(),
     virtual double GetMassFactor() { return c_a; }
 
+    /// Set the number of OpenMP threads which solvers may use when operating on this descriptor (default: 1).
+    /// ChSystem sets this value to its number of Chrono threads (see ChSystem::SetNumThreads) before each solve.
+    void SetNumThreads(int nthreads) { num_threads = nthreads; }
+
+    /// Get the number of OpenMP threads which solvers may use when operating on this descriptor.
+    int GetNumThreads() const { return num_threads; }
+
     // DATA <-> MATH.VECTORS FUNCTIONS
 
     /// Get a vector with all the 'fb' known terms ('forces'etc.) associated to all variables,
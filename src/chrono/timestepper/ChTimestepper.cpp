@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepper.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -306,6 +307,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerImplicit)
 
 // Performs a step of Euler implicit for II order systems
 void ChTimestepperEulerImplicit::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperEulerImplicit::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -399,6 +401,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerImplicitLinearized)
 // If the solver in StateSolveCorrection is a CCP complementarity
 // solver, this is the typical Anitescu stabilized timestepper for DVIs.
 void ChTimestepperEulerImplicitLinearized::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperEulerImplicitLinearized::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -469,6 +472,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerImplicitProjected)
 // If the solver in StateSolveCorrection is a CCP complementarity
 // solver, this is the Tasora stabilized timestepper for DVIs.
 void ChTimestepperEulerImplicitProjected::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperEulerImplicitProjected::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -562,6 +566,7 @@ CH_FACTORY_REGISTER(ChTimestepperTrapezoidal)
 // order in constraint reactions. Use damped HHT or damped Newmark for
 // more advanced options.
 void ChTimestepperTrapezoidal::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperTrapezoidal::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -657,6 +662,7 @@ CH_FACTORY_REGISTER(ChTimestepperTrapezoidalLinearized)
 
 // Performs a step of trapezoidal implicit linearized for II order systems
 void ChTimestepperTrapezoidalLinearized::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperTrapezoidalLinearized::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -822,6 +828,7 @@ void ChTimestepperNewmark::SetGammaBeta(double mgamma, double mbeta) {
 
 // Performs a step of Newmark constrained implicit for II order DAE systems
 void ChTimestepperNewmark::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperNewmark::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
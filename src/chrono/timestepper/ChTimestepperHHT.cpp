@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -50,6 +51,7 @@ void ChTimestepperHHT::SetAlpha(double malpha) {
 
 // Performs a step of HHT (generalized alpha) implicit for II order systems
 void ChTimestepperHHT::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperHHT::Advance");
     // Downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
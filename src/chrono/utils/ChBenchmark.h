@@ -20,6 +20,9 @@
 #ifndef CH_BENCHMARK_H
 #define CH_BENCHMARK_H
 
+#include <string>
+#include <vector>
+
 #include "chrono_thirdparty/googlebenchmark/include/benchmark/benchmark.h"
 #include "chrono/physics/ChSystem.h"
 
@@ -180,6 +183,95 @@ class ChBenchmarkFixture : public ::benchmark::Fixture {
     TEST* m_test;
 };
 
+// =============================================================================
+
+/// Base class for a Chrono kernel benchmark test.
+/// A kernel test exercises a single computational kernel (e.g., collision detection, contact force computation, solver
+/// iterations, matrix factorization) in isolation, on a problem of given size.
+/// A derived class should set up the problem for the specified size in Setup and implement Execute (to invoke the
+/// kernel once). Optionally, a derived class can override Report to add kernel-specific counters.
+class ChBenchmarkKernel {
+  public:
+    virtual ~ChBenchmarkKernel() {}
+
+    virtual void Setup(int size) = 0;
+    virtual void Execute() = 0;
+    virtual void Report(benchmark::State& st) {}
+};
+
+/// Generic benchmark fixture for Chrono kernel tests.
+/// The template parameter is a ChBenchmarkKernel. A new kernel test is created for each benchmark run, with the size
+/// given by the first benchmark argument.
+template <typename KERNEL>
+class ChBenchmarkKernelFixture : public ::benchmark::Fixture {
+  public:
+    ChBenchmarkKernelFixture() : m_kernel(nullptr) {}
+    ~ChBenchmarkKernelFixture() { delete m_kernel; }
+
+    void SetUp(const ::benchmark::State& st) override {
+        delete m_kernel;
+        m_kernel = new KERNEL();
+        m_kernel->Setup(static_cast<int>(st.range(0)));
+    }
+
+    void TearDown(const ::benchmark::State&) override {
+        delete m_kernel;
+        m_kernel = nullptr;
+    }
+
+    KERNEL* m_kernel;
+};
+
+/// Define and register a test named TEST_NAME using the specified ChBenchmarkKernel KERNEL.
+/// The kernel is benchmarked for problem sizes between MIN_SIZE and MAX_SIZE (in multiples of MULT). The problem size
+/// is reported as the "Size" counter and used to estimate the asymptotic complexity of the kernel.
+#define CH_BM_KERNEL(TEST_NAME, KERNEL, MIN_SIZE, MAX_SIZE, MULT)             \
+    using TEST_NAME = chrono::utils::ChBenchmarkKernelFixture<KERNEL>;         \
+    BENCHMARK_DEFINE_F(TEST_NAME, Kernel)(benchmark::State & st) {             \
+        while (st.KeepRunning()) {                                             \
+            m_kernel->Execute();                                               \
+        }                                                                      \
+        st.counters["Size"] = static_cast<double>(st.range(0));                \
+        st.SetComplexityN(st.range(0));                                        \
+        m_kernel->Report(st);                                                  \
+    }                                                                          \
+    BENCHMARK_REGISTER_F(TEST_NAME, Kernel)                                    \
+        ->ArgName("size")                                                      \
+        ->RangeMultiplier(MULT)                                                \
+        ->Range(MIN_SIZE, MAX_SIZE)                                            \
+        ->Unit(benchmark::kMicrosecond)                                        \
+        ->Complexity();
+
+/// Run all registered benchmarks, writing results in JSON format to the specified file, unless a different output was
+/// requested on the command line (with --benchmark_out).
+inline int ChBenchmarkMainJSON(int argc, char** argv, const std::string& out_file) {
+    std::vector<char*> args(argv, argv + argc);
+    std::string out_arg = "--benchmark_out=" + out_file;
+    std::string format_arg = "--benchmark_out_format=json";
+    bool has_out = false;
+    for (int i = 1; i < argc; i++) {
+        if (std::string(argv[i]).compare(0, 16, "--benchmark_out=") == 0)
+            has_out = true;
+    }
+    if (!has_out) {
+        args.push_back(&out_arg[0]);
+        args.push_back(&format_arg[0]);
+    }
+    int nargs = static_cast<int>(args.size());
+    ::benchmark::Initialize(&nargs, args.data());
+    if (::benchmark::ReportUnrecognizedArguments(nargs, args.data()))
+        return 1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+/// Define a main function which runs all registered benchmarks and writes the results to the file OUT_FILE in JSON
+/// format (for regression tracking).
+#define CH_BM_MAIN_JSON(OUT_FILE)                                          \
+    int main(int argc, char** argv) {                                      \
+        return chrono::utils::ChBenchmarkMainJSON(argc, argv, OUT_FILE);   \
+    }
+
 }  // end namespace utils
 }  // end namespace chrono
 
@@ -0,0 +1,723 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Binary checkpoint of a Chrono system (bodies, collision shapes, contact
+// materials, and solver warm-start state), stored as a versioned collection of
+// named bulk-array sections.
+//
+// =============================================================================
+
+#include <cassert>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <unordered_map>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+    #undef WIN32_LEAN_AND_MEAN
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "chrono/assets/ChCylinderShape.h"
+#include "chrono/physics/ChMaterialSurfaceNSC.h"
+#include "chrono/physics/ChMaterialSurfaceSMC.h"
+#include "chrono/physics/ChSystem.h"
+#include "chrono/utils/ChCheckpoint.h"
+#include "chrono/utils/ChDeflate.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+namespace chrono {
+namespace utils {
+
+// -----------------------------------------------------------------------------
+// File layout
+// -----------------------------------------------------------------------------
+
+namespace {
+
+const char checkpoint_magic[8] = {'C', 'H', 'C', 'K', 'P', 'T', '\0', '\0'};
+const size_t checkpoint_alignment = 64;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t num_sections;
+    uint64_t reserved[6];
+};
+
+struct SectionEntry {
+    char name[32];
+    uint32_t compression;
+    uint32_t element_size;
+    uint64_t offset;
+    uint64_t size;
+    uint64_t stored_size;
+};
+
+static_assert(sizeof(FileHeader) == 64, "Unexpected size of checkpoint file header");
+static_assert(sizeof(SectionEntry) == 64, "Unexpected size of checkpoint section entry");
+
+size_t Align(size_t offset) {
+    return (offset + checkpoint_alignment - 1) / checkpoint_alignment * checkpoint_alignment;
+}
+
+// Group the bytes of the elements in the given buffer by their position in the element (byte-shuffle).
+// Floating point data compresses much better when the exponent and mantissa bytes are stored contiguously.
+void Shuffle(const char* in, char* out, size_t size, size_t element_size) {
+    size_t n = size / element_size;
+    for (size_t b = 0; b < element_size; b++)
+        for (size_t i = 0; i < n; i++)
+            out[b * n + i] = in[i * element_size + b];
+    std::memcpy(out + n * element_size, in + n * element_size, size - n * element_size);
+}
+
+void Unshuffle(const char* in, char* out, size_t size, size_t element_size) {
+    size_t n = size / element_size;
+    for (size_t b = 0; b < element_size; b++)
+        for (size_t i = 0; i < n; i++)
+            out[i * element_size + b] = in[b * n + i];
+    std::memcpy(out + n * element_size, in + n * element_size, size - n * element_size);
+}
+
+// Checkpoint information.
+struct CheckpointInfo {
+    int32_t contact_method;
+    int32_t num_bodies;
+    int32_t num_shapes;
+    int32_t num_materials;
+};
+
+// Per-body identifier, flags, collision family, and number of collision shapes.
+struct BodyInfo {
+    int32_t identifier;
+    uint32_t flags;
+    int16_t family_group;
+    int16_t family_mask;
+    int32_t num_shapes;
+};
+
+enum BodyFlags : uint32_t { BODY_FIXED = 1u << 0, BODY_COLLIDE = 1u << 1, BODY_SLEEPING = 1u << 2 };
+
+// Per-shape type, material, and dimensions.
+struct ShapeInfo {
+    int32_t type;
+    int32_t material;
+    double dims[4];
+};
+
+const size_t num_material_params = 11;
+
+// Collision shape types that can be restored from a checkpoint.
+bool IsSupportedShape(collision::ChCollisionShape::Type type) {
+    switch (type) {
+        case collision::ChCollisionShape::Type::SPHERE:
+        case collision::ChCollisionShape::Type::ELLIPSOID:
+        case collision::ChCollisionShape::Type::BOX:
+        case collision::ChCollisionShape::Type::CAPSULE:
+        case collision::ChCollisionShape::Type::CYLINDER:
+        case collision::ChCollisionShape::Type::CYLSHELL:
+        case collision::ChCollisionShape::Type::CONE:
+        case collision::ChCollisionShape::Type::ROUNDEDBOX:
+        case collision::ChCollisionShape::Type::ROUNDEDCYL:
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // end anonymous namespace
+
+// -----------------------------------------------------------------------------
+// Memory-mapped file
+// -----------------------------------------------------------------------------
+
+class ChCheckpoint::MappedFile {
+  public:
+    // Map an existing file for reading.
+    static std::shared_ptr<MappedFile> OpenRead(const std::string& filename);
+
+    // Create a file of given size and map it for writing.
+    static std::shared_ptr<MappedFile> Create(const std::string& filename, size_t size);
+
+    ~MappedFile();
+
+    char* data;
+    size_t size;
+
+  private:
+    MappedFile() : data(nullptr), size(0) {}
+
+#if defined(_WIN32)
+    HANDLE m_file = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = nullptr;
+#endif
+};
+
+#if defined(_WIN32)
+
+std::shared_ptr<ChCheckpoint::MappedFile> ChCheckpoint::MappedFile::OpenRead(const std::string& filename) {
+    std::shared_ptr<MappedFile> file(new MappedFile());
+    file->m_file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                               FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file->m_file == INVALID_HANDLE_VALUE)
+        return nullptr;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file->m_file, &size) || size.QuadPart == 0)
+        return nullptr;
+    file->m_mapping = CreateFileMappingA(file->m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!file->m_mapping)
+        return nullptr;
+    file->data = static_cast<char*>(MapViewOfFile(file->m_mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!file->data)
+        return nullptr;
+    file->size = static_cast<size_t>(size.QuadPart);
+    return file;
+}
+
+std::shared_ptr<ChCheckpoint::MappedFile> ChCheckpoint::MappedFile::Create(const std::string& filename, size_t size) {
+    std::shared_ptr<MappedFile> file(new MappedFile());
+    file->m_file = CreateFileA(filename.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                               FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file->m_file == INVALID_HANDLE_VALUE)
+        return nullptr;
+    LARGE_INTEGER lsize;
+    lsize.QuadPart = static_cast<LONGLONG>(size);
+    file->m_mapping =
+        CreateFileMappingA(file->m_file, nullptr, PAGE_READWRITE, lsize.HighPart, lsize.LowPart, nullptr);
+    if (!file->m_mapping)
+        return nullptr;
+    file->data = static_cast<char*>(MapViewOfFile(file->m_mapping, FILE_MAP_WRITE, 0, 0, size));
+    if (!file->data)
+        return nullptr;
+    file->size = size;
+    return file;
+}
+
+ChCheckpoint::MappedFile::~MappedFile() {
+    if (data)
+        UnmapViewOfFile(data);
+    if (m_mapping)
+        CloseHandle(m_mapping);
+    if (m_file != INVALID_HANDLE_VALUE)
+        CloseHandle(m_file);
+}
+
+#else
+
+std::shared_ptr<ChCheckpoint::MappedFile> ChCheckpoint::MappedFile::OpenRead(const std::string& filename) {
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return nullptr;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return nullptr;
+    }
+    void* addr = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED)
+        return nullptr;
+    std::shared_ptr<MappedFile> file(new MappedFile());
+    file->data = static_cast<char*>(addr);
+    file->size = static_cast<size_t>(st.st_size);
+    return file;
+}
+
+std::shared_ptr<ChCheckpoint::MappedFile> ChCheckpoint::MappedFile::Create(const std::string& filename, size_t size) {
+    int fd = open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        return nullptr;
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        close(fd);
+        return nullptr;
+    }
+    void* addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED)
+        return nullptr;
+    std::shared_ptr<MappedFile> file(new MappedFile());
+    file->data = static_cast<char*>(addr);
+    file->size = size;
+    return file;
+}
+
+ChCheckpoint::MappedFile::~MappedFile() {
+    if (data)
+        munmap(data, size);
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+// Sections and file I/O
+// -----------------------------------------------------------------------------
+
+ChCheckpoint::ChCheckpoint() : m_compression(Compression::NONE) {}
+
+ChCheckpoint::~ChCheckpoint() {}
+
+void ChCheckpoint::SetSection(const std::string& name, const void* data, size_t size, size_t element_size) {
+    assert(name.size() < sizeof(SectionEntry::name));
+    auto& section = m_sections[name];
+    section.buffer.assign(static_cast<const char*>(data), static_cast<const char*>(data) + size);
+    section.data = section.buffer.data();
+    section.size = size;
+    section.element_size = element_size;
+}
+
+const void* ChCheckpoint::GetSection(const std::string& name, size_t& size) const {
+    auto it = m_sections.find(name);
+    if (it == m_sections.end()) {
+        size = 0;
+        return nullptr;
+    }
+    size = it->second.size;
+    return it->second.data;
+}
+
+bool ChCheckpoint::Write(const std::string& filename) const {
+    // Encode the sections (compress if requested and if this reduces the section size)
+    struct Encoded {
+        const char* data;
+        size_t size;
+        uint32_t compression;
+        std::vector<char> buffer;
+    };
+    std::vector<Encoded> encoded;
+    encoded.reserve(m_sections.size());
+
+    for (const auto& s : m_sections) {
+        const auto& section = s.second;
+        encoded.push_back({section.data, section.size, 0, {}});
+        if (m_compression != Compression::ZLIB || section.size == 0)
+            continue;
+        std::vector<char> shuffled(section.size);
+        Shuffle(section.data, shuffled.data(), section.size, section.element_size);
+        auto& e = encoded.back();
+        if (!DeflateCompress(shuffled.data(), section.size, e.buffer))
+            continue;
+        if (e.buffer.size() < section.size) {
+            e.data = e.buffer.data();
+            e.size = e.buffer.size();
+            e.compression = static_cast<uint32_t>(Compression::ZLIB);
+        }
+    }
+
+    // Calculate the file layout
+    size_t offset = Align(sizeof(FileHeader) + m_sections.size() * sizeof(SectionEntry));
+    std::vector<size_t> offsets;
+    for (const auto& e : encoded) {
+        offsets.push_back(offset);
+        offset = Align(offset + e.size);
+    }
+
+    auto file = MappedFile::Create(filename, offset);
+    if (!file)
+        return false;
+
+    FileHeader header = {};
+    std::memcpy(header.magic, checkpoint_magic, sizeof(header.magic));
+    header.version = version;
+    header.num_sections = static_cast<uint32_t>(m_sections.size());
+    std::memcpy(file->data, &header, sizeof(header));
+
+    size_t i = 0;
+    for (const auto& s : m_sections) {
+        SectionEntry entry = {};
+        std::strncpy(entry.name, s.first.c_str(), sizeof(entry.name) - 1);
+        entry.compression = encoded[i].compression;
+        entry.element_size = static_cast<uint32_t>(s.second.element_size);
+        entry.offset = offsets[i];
+        entry.size = s.second.size;
+        entry.stored_size = encoded[i].size;
+        std::memcpy(file->data + sizeof(FileHeader) + i * sizeof(SectionEntry), &entry, sizeof(entry));
+        std::memcpy(file->data + offsets[i], encoded[i].data, encoded[i].size);
+        i++;
+    }
+
+    return true;
+}
+
+bool ChCheckpoint::Read(const std::string& filename) {
+    m_sections.clear();
+    m_file.reset();
+
+    auto file = MappedFile::OpenRead(filename);
+    if (!file || file->size < sizeof(FileHeader))
+        return false;
+
+    FileHeader header;
+    std::memcpy(&header, file->data, sizeof(header));
+    if (std::memcmp(header.magic, checkpoint_magic, sizeof(header.magic)) != 0 || header.version > version)
+        return false;
+    if (sizeof(FileHeader) + header.num_sections * sizeof(SectionEntry) > file->size)
+        return false;
+
+    for (uint32_t i = 0; i < header.num_sections; i++) {
+        SectionEntry entry;
+        std::memcpy(&entry, file->data + sizeof(FileHeader) + i * sizeof(SectionEntry), sizeof(entry));
+        entry.name[sizeof(entry.name) - 1] = '\0';
+        // The stored data must lie within the file (checked without overflow), an uncompressed section cannot be
+        // larger than its stored data, and a compressed section must fit the sizes supported by the decoder
+        bool valid = entry.element_size > 0 && entry.offset <= file->size &&
+                     entry.stored_size <= file->size - entry.offset;
+        if (entry.compression == static_cast<uint32_t>(Compression::NONE))
+            valid = valid && entry.size <= entry.stored_size;
+        else if (entry.compression == static_cast<uint32_t>(Compression::ZLIB))
+            valid = valid && entry.stored_size <= INT_MAX && entry.size <= INT_MAX;
+        else
+            valid = false;
+        if (!valid) {
+            m_sections.clear();
+            return false;
+        }
+
+        auto& section = m_sections[entry.name];
+        section.size = entry.size;
+        section.element_size = entry.element_size;
+
+        const char* stored = file->data + entry.offset;
+        if (entry.compression == static_cast<uint32_t>(Compression::NONE)) {
+            // Reference the section data in place
+            section.data = stored;
+            continue;
+        }
+
+        std::vector<char> shuffled(entry.size);
+        if (!DeflateDecompress(stored, entry.stored_size, shuffled.data(), entry.size)) {
+            m_sections.clear();
+            return false;
+        }
+        section.buffer.resize(entry.size);
+        Unshuffle(shuffled.data(), section.buffer.data(), entry.size, entry.element_size);
+        section.data = section.buffer.data();
+    }
+
+    m_file = file;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Capture and restore system state
+// -----------------------------------------------------------------------------
+
+bool ChCheckpoint::Capture(ChSystem& system) {
+    m_sections.clear();
+    m_file.reset();
+
+    bool nsc = system.GetContactMethod() == ChContactMethod::NSC;
+    const auto& bodies = system.Get_bodylist();
+    size_t num_bodies = bodies.size();
+
+    std::vector<BodyInfo> body_info(num_bodies);
+    std::vector<double> body_mass(7 * num_bodies);
+    std::vector<ChVector<>> body_pos(num_bodies);
+    std::vector<ChQuaternion<>> body_rot(num_bodies);
+    std::vector<ChVector<>> body_vel(num_bodies);
+    std::vector<ChQuaternion<>> body_rot_dt(num_bodies);
+    std::vector<ChVector<>> body_acc(num_bodies);
+    std::vector<ChQuaternion<>> body_rot_dtdt(num_bodies);
+
+    std::vector<ShapeInfo> shape_info;
+    std::vector<ChCoordsys<>> shape_csys;
+
+    std::unordered_map<const ChMaterialSurface*, int32_t> material_index;
+    std::vector<float> material_params;
+
+    for (size_t i = 0; i < num_bodies; i++) {
+        const auto& body = bodies[i];
+        auto model = body->GetCollisionModel();
+
+        auto& info = body_info[i];
+        info.identifier = body->GetIdentifier();
+        info.flags = (body->GetBodyFixed() ? BODY_FIXED : 0) | (body->GetCollide() ? BODY_COLLIDE : 0) |
+                     (body->GetSleeping() ? BODY_SLEEPING : 0);
+        info.family_group = model->GetFamilyGroup();
+        info.family_mask = model->GetFamilyMask();
+        info.num_shapes = model->GetNumShapes();
+
+        const auto& inertiaXX = body->GetInertiaXX();
+        const auto& inertiaXY = body->GetInertiaXY();
+        double mass[7] = {body->GetMass(), inertiaXX.x(), inertiaXX.y(), inertiaXX.z(),
+                          inertiaXY.x(),   inertiaXY.y(), inertiaXY.z()};
+        std::copy(mass, mass + 7, body_mass.begin() + 7 * i);
+
+        body_pos[i] = body->GetPos();
+        body_rot[i] = body->GetRot();
+        body_vel[i] = body->GetPos_dt();
+        body_rot_dt[i] = body->GetRot_dt();
+        body_acc[i] = body->GetPos_dtdt();
+        body_rot_dtdt[i] = body->GetRot_dtdt();
+
+        for (int index = 0; index < info.num_shapes; index++) {
+            auto shape = model->GetShape(index);
+            const std::vector<double>& dims = shape->GetDimensions();
+            if (!IsSupportedShape(shape->GetType()) || dims.empty() || dims.size() > 4) {
+                std::cout << "utils::ChCheckpoint ERROR: unknown or not supported collision shape\n";
+                return false;
+            }
+
+            // Store each contact material only once
+            auto mat = shape->GetMaterial().get();
+            auto found = material_index.find(mat);
+            int32_t mat_index;
+            if (found != material_index.end()) {
+                mat_index = found->second;
+            } else {
+                mat_index = static_cast<int32_t>(material_index.size());
+                material_index[mat] = mat_index;
+                if (nsc) {
+                    auto m = static_cast<const ChMaterialSurfaceNSC*>(mat);
+                    material_params.insert(material_params.end(),
+                                           {m->static_friction, m->sliding_friction, m->rolling_friction,
+                                            m->spinning_friction, m->restitution, m->cohesion, m->dampingf,
+                                            m->compliance, m->complianceT, m->complianceRoll, m->complianceSpin});
+                } else {
+                    auto m = static_cast<const ChMaterialSurfaceSMC*>(mat);
+                    material_params.insert(material_params.end(),
+                                           {m->young_modulus, m->poisson_ratio, m->static_friction,
+                                            m->sliding_friction, m->restitution, m->constant_adhesion,
+                                            m->adhesionMultDMT, m->kn, m->gn, m->kt, m->gt});
+                }
+            }
+
+            ShapeInfo sinfo = {};
+            sinfo.type = static_cast<int32_t>(shape->GetType());
+            sinfo.material = mat_index;
+            std::copy(dims.begin(), dims.end(), sinfo.dims);
+            shape_info.push_back(sinfo);
+            shape_csys.push_back(model->GetShapePos(index));
+        }
+    }
+
+    CheckpointInfo info = {static_cast<int32_t>(nsc ? 0 : 1), static_cast<int32_t>(num_bodies),
+                           static_cast<int32_t>(shape_info.size()), static_cast<int32_t>(material_index.size())};
+    SetSection("info", &info, sizeof(info), sizeof(int32_t));
+
+    SetArray("body.info", body_info);
+    SetSection("body.mass", body_mass.data(), body_mass.size() * sizeof(double), sizeof(double));
+    SetSection("body.pos", body_pos.data(), num_bodies * sizeof(ChVector<>), sizeof(double));
+    SetSection("body.rot", body_rot.data(), num_bodies * sizeof(ChQuaternion<>), sizeof(double));
+    SetSection("body.vel", body_vel.data(), num_bodies * sizeof(ChVector<>), sizeof(double));
+    SetSection("body.rot_dt", body_rot_dt.data(), num_bodies * sizeof(ChQuaternion<>), sizeof(double));
+    SetSection("body.acc", body_acc.data(), num_bodies * sizeof(ChVector<>), sizeof(double));
+    SetSection("body.rot_dtdt", body_rot_dtdt.data(), num_bodies * sizeof(ChQuaternion<>), sizeof(double));
+    SetArray("shape.info", shape_info);
+    SetSection("shape.csys", shape_csys.data(), shape_csys.size() * sizeof(ChCoordsys<>), sizeof(double));
+    SetArray("material", material_params);
+
+    // System time and system-specific warm-start state
+    system.CheckpointOut(*this);
+
+    return true;
+}
+
+bool ChCheckpoint::Restore(ChSystem& system) const {
+    size_t n;
+    auto info = GetArray<CheckpointInfo>("info", n);
+    if (!info || n != 1) {
+        std::cout << "utils::ChCheckpoint ERROR: missing checkpoint information\n";
+        return false;
+    }
+
+    bool nsc = (info->contact_method == 0);
+    if (nsc != (system.GetContactMethod() == ChContactMethod::NSC)) {
+        std::cout << "utils::ChCheckpoint ERROR: checkpoint data inconsistent with the Chrono system\n";
+        std::cout << "    Contact method in checkpoint: " << (nsc ? "NSC" : "SMC") << "\n";
+        return false;
+    }
+
+    size_t num_bodies = info->num_bodies;
+    size_t num_shapes = info->num_shapes;
+    size_t num_materials = info->num_materials;
+
+    size_t n_info, n_mass, n_pos, n_rot, n_vel, n_rot_dt, n_acc, n_rot_dtdt, n_shapes, n_csys, n_mat;
+    auto body_info = GetArray<BodyInfo>("body.info", n_info);
+    auto body_mass = GetArray<double>("body.mass", n_mass);
+    auto body_pos = GetArray<ChVector<>>("body.pos", n_pos);
+    auto body_rot = GetArray<ChQuaternion<>>("body.rot", n_rot);
+    auto body_vel = GetArray<ChVector<>>("body.vel", n_vel);
+    auto body_rot_dt = GetArray<ChQuaternion<>>("body.rot_dt", n_rot_dt);
+    auto body_acc = GetArray<ChVector<>>("body.acc", n_acc);
+    auto body_rot_dtdt = GetArray<ChQuaternion<>>("body.rot_dtdt", n_rot_dtdt);
+    auto shape_info = GetArray<ShapeInfo>("shape.info", n_shapes);
+    auto shape_csys = GetArray<ChCoordsys<>>("shape.csys", n_csys);
+    auto material_params = GetArray<float>("material", n_mat);
+
+    if (n_info != num_bodies || n_mass != 7 * num_bodies || n_pos != num_bodies || n_rot != num_bodies ||
+        n_vel != num_bodies || n_rot_dt != num_bodies || n_acc != num_bodies || n_rot_dtdt != num_bodies ||
+        n_shapes != num_shapes || n_csys != num_shapes || n_mat != num_material_params * num_materials) {
+        std::cout << "utils::ChCheckpoint ERROR: inconsistent checkpoint data\n";
+        return false;
+    }
+
+    // Create the contact materials
+    std::vector<std::shared_ptr<ChMaterialSurface>> materials(num_materials);
+    for (size_t i = 0; i < num_materials; i++) {
+        const float* p = material_params + num_material_params * i;
+        if (nsc) {
+            auto m = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+            m->static_friction = p[0];
+            m->sliding_friction = p[1];
+            m->rolling_friction = p[2];
+            m->spinning_friction = p[3];
+            m->restitution = p[4];
+            m->cohesion = p[5];
+            m->dampingf = p[6];
+            m->compliance = p[7];
+            m->complianceT = p[8];
+            m->complianceRoll = p[9];
+            m->complianceSpin = p[10];
+            materials[i] = m;
+        } else {
+            auto m = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+            m->young_modulus = p[0];
+            m->poisson_ratio = p[1];
+            m->static_friction = p[2];
+            m->sliding_friction = p[3];
+            m->restitution = p[4];
+            m->constant_adhesion = p[5];
+            m->adhesionMultDMT = p[6];
+            m->kn = p[7];
+            m->gn = p[8];
+            m->kt = p[9];
+            m->gt = p[10];
+            materials[i] = m;
+        }
+    }
+
+    // Create the bodies
+    size_t ishape = 0;
+    for (size_t i = 0; i < num_bodies; i++) {
+        const auto& binfo = body_info[i];
+
+        auto body = std::shared_ptr<ChBody>(system.NewBody());
+        system.AddBody(body);
+
+        body->SetPos(body_pos[i]);
+        body->SetRot(body_rot[i]);
+        body->SetPos_dt(body_vel[i]);
+        body->SetRot_dt(body_rot_dt[i]);
+        body->SetPos_dtdt(body_acc[i]);
+        body->SetRot_dtdt(body_rot_dtdt[i]);
+
+        body->SetIdentifier(binfo.identifier);
+        body->SetBodyFixed((binfo.flags & BODY_FIXED) != 0);
+        body->SetCollide((binfo.flags & BODY_COLLIDE) != 0);
+        body->SetSleeping((binfo.flags & BODY_SLEEPING) != 0);
+
+        const double* mass = body_mass + 7 * i;
+        body->SetMass(mass[0]);
+        body->SetInertiaXX(ChVector<>(mass[1], mass[2], mass[3]));
+        body->SetInertiaXY(ChVector<>(mass[4], mass[5], mass[6]));
+
+        if (binfo.num_shapes < 0) {
+            std::cout << "utils::ChCheckpoint ERROR: inconsistent checkpoint data\n";
+            return false;
+        }
+
+        auto model = body->GetCollisionModel();
+        model->ClearModel();
+
+        for (int j = 0; j < binfo.num_shapes; j++, ishape++) {
+            if (ishape >= num_shapes || shape_info[ishape].material < 0 ||
+                shape_info[ishape].material >= static_cast<int32_t>(num_materials)) {
+                std::cout << "utils::ChCheckpoint ERROR: inconsistent checkpoint data\n";
+                return false;
+            }
+            const auto& sinfo = shape_info[ishape];
+            const double* dims = sinfo.dims;
+            const auto& mat = materials[sinfo.material];
+            const auto& spos = shape_csys[ishape].pos;
+            const auto& srot = shape_csys[ishape].rot;
+
+            switch (collision::ChCollisionShape::Type(sinfo.type)) {
+                case collision::ChCollisionShape::Type::SPHERE:
+                    AddSphereGeometry(body.get(), mat, dims[0], spos, srot);
+                    break;
+                case collision::ChCollisionShape::Type::ELLIPSOID:
+                    AddEllipsoidGeometry(body.get(), mat, ChVector<>(dims[0], dims[1], dims[2]), spos, srot);
+                    break;
+                case collision::ChCollisionShape::Type::BOX:
+                    AddBoxGeometry(body.get(), mat, ChVector<>(dims[0], dims[1], dims[2]), spos, srot);
+                    break;
+                case collision::ChCollisionShape::Type::CAPSULE:
+                    AddCapsuleGeometry(body.get(), mat, dims[0], dims[1], spos, srot);
+                    break;
+                case collision::ChCollisionShape::Type::CYLINDER:
+                    AddCylinderGeometry(body.get(), mat, dims[0], dims[2], spos, srot);
+                    break;
+                case collision::ChCollisionShape::Type::CONE:
+                    AddConeGeometry(body.get(), mat, dims[0], dims[2], spos, srot);
+                    break;
+                case collision::ChCollisionShape::Type::ROUNDEDBOX:
+                    AddRoundedBoxGeometry(body.get(), mat, ChVector<>(dims[0], dims[1], dims[2]), dims[3], spos,
+                                          srot);
+                    break;
+                case collision::ChCollisionShape::Type::ROUNDEDCYL:
+                    AddRoundedCylinderGeometry(body.get(), mat, dims[0], dims[2], dims[3], spos, srot);
+                    break;
+                case collision::ChCollisionShape::Type::CYLSHELL: {
+                    model->AddCylindricalShell(mat, dims[0], dims[1], spos, ChMatrix33<>(srot));
+                    auto cylinder = chrono_types::make_shared<ChCylinderShape>();
+                    cylinder->GetCylinderGeometry().rad = dims[0];
+                    cylinder->GetCylinderGeometry().p1 = ChVector<>(0, dims[1], 0);
+                    cylinder->GetCylinderGeometry().p2 = ChVector<>(0, -dims[1], 0);
+                    cylinder->Pos = spos;
+                    cylinder->Rot = srot;
+                    body->AddAsset(cylinder);
+                    break;
+                }
+                default:
+                    std::cout << "utils::ChCheckpoint ERROR: unknown or not supported collision shape\n";
+                    return false;
+            }
+        }
+
+        model->SetFamilyGroup(binfo.family_group);
+        model->SetFamilyMask(binfo.family_mask);
+        model->BuildModel();
+    }
+
+    // System time and system-specific warm-start state
+    system.CheckpointIn(*this);
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool WriteCheckpointBinary(ChSystem* system, const std::string& filename, ChCheckpoint::Compression compression) {
+    ChCheckpoint checkpoint;
+    checkpoint.SetCompression(compression);
+    return checkpoint.Capture(*system) && checkpoint.Write(filename);
+}
+
+bool ReadCheckpointBinary(ChSystem* system, const std::string& filename) {
+    ChCheckpoint checkpoint;
+    return checkpoint.Read(filename) && checkpoint.Restore(*system);
+}
+
+}  // end namespace utils
+}  // end namespace chrono
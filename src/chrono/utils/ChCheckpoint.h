@@ -0,0 +1,147 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Binary checkpoint of a Chrono system (bodies, collision shapes, contact
+// materials, and solver warm-start state), stored as a versioned collection of
+// named bulk-array sections.
+//
+// =============================================================================
+
+#ifndef CH_CHECKPOINT_H
+#define CH_CHECKPOINT_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+class ChSystem;
+
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Binary checkpoint of a Chrono system.
+/// A checkpoint is a collection of named sections, each holding a bulk array of fixed-size elements. Body data is
+/// stored in structure-of-arrays form (identifiers and flags, mass properties, positions, rotations, velocities, and
+/// accelerations), followed by the collision shapes of all bodies and the (shared) contact materials. The system
+/// time, step size, and step count, as well as system-specific warm-start state (e.g., contact reaction caches for
+/// Bullet-based NSC systems or contact history for Chrono::Multicore SMC systems) are stored through
+/// ChSystem::CheckpointOut and restored through ChSystem::CheckpointIn.
+///
+/// The file layout consists of a header, a section table, and the section data (each section aligned at 64 bytes).
+/// Files are written and read through memory mapping; uncompressed sections are accessed in place, without copying,
+/// for as long as the checkpoint object is alive. Optionally, sections are byte-shuffled and zlib-compressed.
+///
+/// Limitations (as for the text checkpoint, see WriteCheckpoint):
+/// - only bodies (ChBody) in the system are stored; links, meshes, and other physics items are not;
+/// - only a subset of collision shapes is supported and the visualization assets are recreated from the contact
+///   geometry.
+class ChApi ChCheckpoint {
+  public:
+    /// Section compression mode.
+    enum class Compression {
+        NONE,  ///< no compression
+        ZLIB   ///< byte-shuffle and zlib (deflate) compression
+    };
+
+    ChCheckpoint();
+    ~ChCheckpoint();
+
+    // Not copyable: uncompressed sections of a checkpoint read from file point into the mapped file.
+    ChCheckpoint(const ChCheckpoint&) = delete;
+    ChCheckpoint& operator=(const ChCheckpoint&) = delete;
+
+    /// Set the compression mode used when writing the checkpoint (default: NONE).
+    void SetCompression(Compression compression) { m_compression = compression; }
+
+    /// Capture the state of the given system, replacing any sections currently in this checkpoint.
+    /// Return false if a collision shape type is not supported (supported types are those that can be restored:
+    /// sphere, ellipsoid, box, capsule, cylinder, cylindrical shell, cone, rounded box, and rounded cylinder).
+    bool Capture(ChSystem& system);
+
+    /// Create bodies in the given system and restore their state and the system state.
+    /// Return false if the checkpoint is inconsistent with the given system (e.g., different contact method).
+    bool Restore(ChSystem& system) const;
+
+    /// Write the checkpoint to the specified file.
+    bool Write(const std::string& filename) const;
+
+    /// Read a checkpoint from the specified file, replacing any sections currently in this checkpoint.
+    /// Return false if the file could not be opened or is not a valid checkpoint of a supported version.
+    bool Read(const std::string& filename);
+
+    /// Add (or replace) a section with the given name, copying the specified data.
+    /// The element size is used for byte-shuffling when the section is compressed.
+    void SetSection(const std::string& name, const void* data, size_t size, size_t element_size = 1);
+
+    /// Add (or replace) a section with the given name, copying the specified array.
+    template <typename T>
+    void SetArray(const std::string& name, const std::vector<T>& data) {
+        SetSection(name, data.data(), data.size() * sizeof(T), sizeof(T));
+    }
+
+    /// Return true if this checkpoint contains a section with the given name.
+    bool HasSection(const std::string& name) const { return m_sections.find(name) != m_sections.end(); }
+
+    /// Return a pointer to the data of the section with the given name (nullptr if not present) and its size in bytes.
+    const void* GetSection(const std::string& name, size_t& size) const;
+
+    /// Return a pointer to the array stored in the section with the given name (nullptr if not present) and the number
+    /// of elements in the array.
+    template <typename T>
+    const T* GetArray(const std::string& name, size_t& count) const {
+        size_t size = 0;
+        auto data = static_cast<const T*>(GetSection(name, size));
+        count = size / sizeof(T);
+        return data;
+    }
+
+    /// Current version of the checkpoint file format.
+    static const unsigned int version = 1;
+
+  private:
+    struct Section {
+        std::vector<char> buffer;  ///< owned data (empty if the section references the mapped file)
+        const char* data;          ///< section data
+        size_t size;               ///< section size (bytes)
+        size_t element_size;       ///< element size (bytes), used for byte-shuffling
+    };
+
+    class MappedFile;
+
+    Compression m_compression;
+    std::map<std::string, Section> m_sections;
+    std::shared_ptr<MappedFile> m_file;  ///< mapped file referenced by uncompressed sections
+};
+
+/// Write a binary checkpoint of the given system to the specified file.
+ChApi bool WriteCheckpointBinary(ChSystem* system,
+                                 const std::string& filename,
+                                 ChCheckpoint::Compression compression = ChCheckpoint::Compression::NONE);
+
+/// Read a binary checkpoint from the specified file and create the bodies in the given system.
+ChApi bool ReadCheckpointBinary(ChSystem* system, const std::string& filename);
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,68 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+
+#include "chrono/utils/ChDeflate.h"
+
+// Only the zlib encoder and decoder of the STB image libraries are used. They are compiled in this translation unit
+// with internal linkage, so that they do not clash with other modules which also compile these libraries. The image
+// functions are then unused, which is expected for this third-party code.
+#if defined(__GNUC__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wunused-function"
+#endif
+#define STB_IMAGE_STATIC
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_ONLY_PNG
+#define STBI_NO_STDIO
+#include "chrono_thirdparty/stb/stb_image.h"
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#define STBI_WRITE_NO_STDIO
+#include "chrono_thirdparty/stb/stb_image_write.h"
+#if defined(__GNUC__)
+    #pragma GCC diagnostic pop
+#endif
+
+namespace chrono {
+namespace utils {
+
+bool DeflateCompress(const char* data, size_t size, std::vector<char>& out) {
+    if (size > INT_MAX)
+        return false;
+
+    int out_len = 0;
+    unsigned char* buffer = stbi_zlib_compress(reinterpret_cast<unsigned char*>(const_cast<char*>(data)),
+                                               static_cast<int>(size), &out_len, 8);
+    if (!buffer)
+        return false;
+
+    out.assign(buffer, buffer + out_len);
+    std::free(buffer);
+    return true;
+}
+
+bool DeflateDecompress(const char* data, size_t size, char* out, size_t out_size) {
+    if (size > INT_MAX || out_size > INT_MAX)
+        return false;
+
+    int out_len = stbi_zlib_decode_buffer(out, static_cast<int>(out_size), data, static_cast<int>(size));
+    return out_len >= 0 && static_cast<size_t>(out_len) == out_size;
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,46 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// zlib (deflate) compression of memory buffers.
+//
+// =============================================================================
+
+#ifndef CH_DEFLATE_H
+#define CH_DEFLATE_H
+
+#include <cstddef>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Compress the given buffer in the zlib format.
+/// Return false if the buffer could not be compressed (e.g., if it is larger than INT_MAX bytes).
+ChApi bool DeflateCompress(const char* data, size_t size, std::vector<char>& out);
+
+/// Decompress the given zlib buffer into a buffer of known size.
+/// Return false if the data is corrupt or does not decompress to exactly out_size bytes.
+ChApi bool DeflateDecompress(const char* data, size_t size, char* out, size_t out_size);
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,106 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
+#include "chrono/core/ChTimer.h"
+#include "chrono/physics/ChSystem.h"
+#include "chrono/utils/ChEnsembleRunner.h"
+
+namespace chrono {
+namespace utils {
+
+ChEnsembleRunner::ChEnsembleRunner(std::shared_ptr<Scenario> scenario, int num_members)
+    : m_scenario(scenario),
+      m_num_members(num_members),
+      m_num_threads(std::max(1, (int)std::thread::hardware_concurrency())),
+      m_step(1e-3),
+      m_single_threaded(true),
+      m_keep_systems(false),
+      m_wall_time(0) {}
+
+bool ChEnsembleRunner::Run(double end_time) {
+    ChTimer<> timer;
+    timer.reset();
+    timer.start();
+
+    m_status.assign(m_num_members, MemberStatus());
+    m_systems.assign(m_num_members, nullptr);
+
+    // Members are assigned dynamically to the workers (members may have very different costs)
+    std::atomic<int> next(0);
+    auto worker = [&]() {
+        int index;
+        while ((index = next++) < m_num_members)
+            RunMember(index, end_time);
+    };
+
+    int num_workers = std::max(1, std::min(m_num_threads, m_num_members));
+    std::vector<std::thread> workers;
+    for (int i = 1; i < num_workers; i++)
+        workers.push_back(std::thread(worker));
+    worker();
+    for (auto& w : workers)
+        w.join();
+
+    timer.stop();
+    m_wall_time = timer.GetTimeSeconds();
+
+    return std::all_of(m_status.begin(), m_status.end(), [](const MemberStatus& s) { return s.completed; });
+}
+
+void ChEnsembleRunner::RunMember(int index, double end_time) {
+    MemberStatus& status = m_status[index];
+
+    ChTimer<> timer;
+    timer.reset();
+    timer.start();
+
+    try {
+        auto system = m_scenario->Create(index);
+        if (!system)
+            throw std::runtime_error("no system created");
+        if (m_single_threaded)
+            system->SetNumThreads(1, 1, 1);
+
+        while (system->GetChTime() < end_time - 1e-10 * m_step) {
+            system->DoStepDynamics(std::min(m_step, end_time - system->GetChTime()));
+            status.num_steps++;
+            m_scenario->OnStep(index, *system);
+            if (m_scenario->Done(index, *system))
+                break;
+        }
+
+        m_scenario->OnFinish(index, *system);
+        status.time = system->GetChTime();
+        status.completed = true;
+
+        if (m_keep_systems)
+            m_systems[index] = system;
+    } catch (const std::exception& e) {
+        status.error = e.what();
+    } catch (...) {
+        status.error = "unknown error";
+    }
+
+    timer.stop();
+    status.wall_time = timer.GetTimeSeconds();
+}
+
+}  // end namespace utils
+}  // end namespace chrono
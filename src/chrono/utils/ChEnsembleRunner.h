@@ -0,0 +1,157 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// In-process runner for ensembles of independent Chrono simulations (e.g.
+// parameter sweeps), advanced concurrently on a pool of worker threads.
+//
+// =============================================================================
+
+#ifndef CH_ENSEMBLE_RUNNER_H
+#define CH_ENSEMBLE_RUNNER_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+class ChSystem;
+
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Runner for an ensemble of independent simulations (e.g., design-of-experiments runs or parameter sweeps).
+/// The ensemble members are defined by a user-provided Scenario which creates the system for a given member index
+/// and collects its results. Members are distributed dynamically over a pool of worker threads; each worker creates
+/// the system of the next unprocessed member, advances it to the final time, and (unless requested otherwise) releases
+/// it before moving on. As such, at most as many systems as worker threads are alive at any time.
+///
+/// Data that is identical for all members (meshes, lookup tables, terrain data, etc.) should be loaded only once,
+/// through GetSharedData, and shared by all systems. Such data must not be modified during the simulation.
+///
+/// Notes:
+/// - by default, each member system is set to use a single thread (see SetSingleThreadedMembers), so that
+///   parallelism is obtained across ensemble members;
+/// - the Scenario functions are called concurrently from the worker threads (with different member indices) and must
+///   therefore not modify shared state without synchronization;
+/// - an exception thrown while creating or simulating a member is caught and reported in the member status; it does
+///   not affect the other members.
+class ChApi ChEnsembleRunner {
+  public:
+    /// Interface for the definition of the ensemble members.
+    class ChApi Scenario {
+      public:
+        virtual ~Scenario() {}
+
+        /// Create and initialize the system for the ensemble member with given index.
+        virtual std::shared_ptr<ChSystem> Create(int index) = 0;
+
+        /// Process the system of the given member after each integration step (e.g., collect output).
+        virtual void OnStep(int index, ChSystem& system) {}
+
+        /// Return true to terminate the simulation of the given member before the final time.
+        virtual bool Done(int index, ChSystem& system) { return false; }
+
+        /// Process the system of the given member at the end of its simulation (e.g., collect results).
+        virtual void OnFinish(int index, ChSystem& system) {}
+    };
+
+    /// Status of an ensemble member.
+    struct MemberStatus {
+        bool completed = false;  ///< simulation finished without errors
+        double time = 0;         ///< final simulation time
+        int num_steps = 0;       ///< number of integration steps
+        double wall_time = 0;    ///< wall-clock time for creation and simulation [s]
+        std::string error;       ///< error message (if simulation failed)
+    };
+
+    /// Create a runner for an ensemble with the specified number of members.
+    ChEnsembleRunner(std::shared_ptr<Scenario> scenario, int num_members);
+
+    ~ChEnsembleRunner() {}
+
+    /// Set the number of worker threads (default: number of hardware threads).
+    void SetNumThreads(int num_threads) { m_num_threads = num_threads; }
+
+    /// Set the integration step size (default: 1e-3).
+    void SetStepSize(double step) { m_step = step; }
+
+    /// Set whether each member system is set to use a single thread (default: true).
+    /// If false, the threading settings of the member systems are left as set by Scenario::Create.
+    void SetSingleThreadedMembers(bool val) { m_single_threaded = val; }
+
+    /// Set whether the member systems are kept after their simulation (default: false).
+    /// If true, the systems can be accessed after Run with GetSystem, at the cost of keeping all of them in memory.
+    void SetKeepSystems(bool val) { m_keep_systems = val; }
+
+    /// Get data shared by all ensemble members, loading it the first time it is requested.
+    /// The data is identified by the given key; the loader is invoked only once, even if this function is called
+    /// concurrently from multiple threads (typically from Scenario::Create).
+    template <typename T>
+    std::shared_ptr<T> GetSharedData(const std::string& key, std::function<std::shared_ptr<T>()> loader) {
+        std::lock_guard<std::mutex> lock(m_shared_mutex);
+        auto& data = m_shared_data[key];
+        if (!data)
+            data = loader();
+        return std::static_pointer_cast<T>(data);
+    }
+
+    /// Simulate all ensemble members up to the specified final time.
+    /// Return true if all members completed successfully.
+    bool Run(double end_time);
+
+    /// Get the number of ensemble members.
+    int GetNumMembers() const { return m_num_members; }
+
+    /// Get the status of the specified member (after Run).
+    const MemberStatus& GetStatus(int index) const { return m_status[index]; }
+
+    /// Get the system of the specified member (only available if SetKeepSystems(true) was used).
+    std::shared_ptr<ChSystem> GetSystem(int index) const { return m_systems[index]; }
+
+    /// Get the wall-clock time of the last call to Run [s].
+    double GetWallTime() const { return m_wall_time; }
+
+  private:
+    /// Create and simulate the member with given index.
+    void RunMember(int index, double end_time);
+
+    std::shared_ptr<Scenario> m_scenario;
+    int m_num_members;
+    int m_num_threads;
+    double m_step;
+    bool m_single_threaded;
+    bool m_keep_systems;
+    double m_wall_time;
+
+    std::vector<MemberStatus> m_status;
+    std::vector<std::shared_ptr<ChSystem>> m_systems;
+
+    std::mutex m_shared_mutex;
+    std::map<std::string, std::shared_ptr<void>> m_shared_data;
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
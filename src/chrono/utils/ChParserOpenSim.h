@@ -20,6 +20,7 @@
 #define CH_PARSER_OPENSIM_H
 
 #include <functional>
+#include <iterator>
 #include <map>
 
 #include "chrono/core/ChApiCE.h"
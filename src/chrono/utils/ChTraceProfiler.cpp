@@ -0,0 +1,276 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Low-overhead, thread-safe tracing of scoped profiling zones, with export to
+// the Chrome trace-event JSON format and to a per-step CSV summary.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "chrono/utils/ChTraceProfiler.h"
+
+namespace chrono {
+namespace utils {
+
+namespace {
+
+// Zone recorded by a thread.
+struct TraceEvent {
+    const char* name;
+    int64_t start;
+    int64_t end;
+};
+
+// Fixed-capacity, single-producer single-consumer ring buffer of zones.
+// The owning thread is the only producer; the consumer is the thread calling EndStep or Close.
+class TraceBuffer {
+  public:
+    TraceBuffer(size_t capacity, int tid) : m_events(capacity), m_head(0), m_tail(0), m_dropped(0), m_tid(tid) {}
+
+    void Push(const TraceEvent& event) {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) >= m_events.size()) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        m_events[head % m_events.size()] = event;
+        m_head.store(head + 1, std::memory_order_release);
+    }
+
+    template <typename F>
+    void Drain(F&& f) {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        size_t head = m_head.load(std::memory_order_acquire);
+        for (; tail != head; ++tail)
+            f(m_events[tail % m_events.size()]);
+        m_tail.store(tail, std::memory_order_release);
+    }
+
+    size_t GetNumDropped() const { return m_dropped.load(std::memory_order_relaxed); }
+    int GetThreadIndex() const { return m_tid; }
+
+  private:
+    std::vector<TraceEvent> m_events;
+    std::atomic<size_t> m_head;
+    std::atomic<size_t> m_tail;
+    std::atomic<size_t> m_dropped;
+    int m_tid;
+};
+
+// Per-step statistics for one zone.
+struct ZoneStats {
+    unsigned int calls = 0;
+    double total = 0;
+    double max = 0;
+};
+
+struct CStringLess {
+    bool operator()(const char* a, const char* b) const { return std::strcmp(a, b) < 0; }
+};
+
+// Write a zone name as a JSON string, escaping quotes, backslashes, and control characters.
+void WriteJsonString(std::ostream& os, const char* s) {
+    os << '"';
+    for (; *s; ++s) {
+        unsigned char c = static_cast<unsigned char>(*s);
+        if (c == '"' || c == '\\')
+            os << '\\' << *s;
+        else if (c < 0x20)
+            os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec << std::setfill(' ');
+        else
+            os << *s;
+    }
+    os << '"';
+}
+
+// Write a zone name as a CSV field, enclosed in quotes (with embedded quotes doubled) if needed.
+void WriteCsvField(std::ostream& os, const char* s) {
+    if (!std::strpbrk(s, ",\"\r\n")) {
+        os << s;
+        return;
+    }
+    os << '"';
+    for (; *s; ++s) {
+        if (*s == '"')
+            os << '"';
+        os << *s;
+    }
+    os << '"';
+}
+
+// Global tracing state.
+struct TraceState {
+    ~TraceState() { CloseChromeTrace(); }
+
+    // Write all pending zones to the Chrome trace and, if provided, accumulate per-zone statistics.
+    void Drain(std::map<const char*, ZoneStats, CStringLess>* stats) {
+        for (auto& buffer : buffers) {
+            int tid = buffer->GetThreadIndex();
+            buffer->Drain([&](const TraceEvent& e) {
+                double dur = (e.end - e.start) * 1e-6;
+                if (stats) {
+                    auto& s = (*stats)[e.name];
+                    s.calls++;
+                    s.total += dur;
+                    s.max = std::max(s.max, dur);
+                }
+                if (json.is_open()) {
+                    json << (json_first ? "" : ",\n") << "{\"name\":";
+                    WriteJsonString(json, e.name);
+                    json << ",\"cat\":\"chrono\",\"ph\":\"X\",\"ts\":" << std::fixed << std::setprecision(3)
+                         << (e.start - epoch) * 1e-3 << ",\"dur\":" << dur * 1e3 << ",\"pid\":0,\"tid\":" << tid << "}";
+                    json_first = false;
+                }
+            });
+        }
+    }
+
+    void CloseChromeTrace() {
+        if (json.is_open()) {
+            json << "\n]}\n";
+            json.close();
+        }
+    }
+
+    std::mutex mutex;                                   // protects the list of buffers and the outputs
+    std::vector<std::unique_ptr<TraceBuffer>> buffers;  // per-thread buffers (never released)
+    size_t capacity = 65536;                            // capacity of new buffers
+    int64_t epoch = 0;                                  // time origin for the Chrome trace
+    std::ofstream json;                                 // Chrome trace output
+    bool json_first = true;                             // no event written yet to the Chrome trace?
+    std::ofstream csv;                                  // per-step CSV output
+};
+
+TraceState& GetState() {
+    static TraceState state;
+    return state;
+}
+
+thread_local TraceBuffer* tls_buffer = nullptr;
+
+}  // end anonymous namespace
+
+// -----------------------------------------------------------------------------
+
+std::atomic<bool> ChTraceProfiler::m_enabled(false);
+
+void ChTraceProfiler::Enable(bool val) {
+    if (val) {
+        auto& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (state.epoch == 0)
+            state.epoch = Now();
+    }
+    m_enabled.store(val, std::memory_order_relaxed);
+}
+
+void ChTraceProfiler::SetBufferCapacity(size_t capacity) {
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.capacity = std::max(capacity, size_t(1));
+}
+
+bool ChTraceProfiler::SetOutputChromeTrace(const std::string& filename) {
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.CloseChromeTrace();
+    state.json.open(filename);
+    if (!state.json.is_open())
+        return false;
+    state.json << "{\"traceEvents\":[\n";
+    state.json_first = true;
+    return true;
+}
+
+bool ChTraceProfiler::SetOutputCSV(const std::string& filename) {
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (state.csv.is_open())
+        state.csv.close();
+    state.csv.open(filename);
+    if (!state.csv.is_open())
+        return false;
+    state.csv << "step,time,zone,calls,total_ms,max_ms\n";
+    return true;
+}
+
+void ChTraceProfiler::EndStep(size_t step, double time) {
+    if (!IsEnabled())
+        return;
+
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    std::map<const char*, ZoneStats, CStringLess> stats;
+    state.Drain(state.csv.is_open() ? &stats : nullptr);
+
+    // Mark the end of the step in the Chrome trace
+    if (state.json.is_open()) {
+        state.json << (state.json_first ? "" : ",\n")
+                   << "{\"name\":\"step\",\"ph\":\"i\",\"s\":\"g\",\"ts\":" << std::fixed << std::setprecision(3)
+                   << (Now() - state.epoch) * 1e-3 << ",\"pid\":0,\"tid\":0,\"args\":{\"step\":" << step
+                   << ",\"time\":" << std::defaultfloat << std::setprecision(6) << time << "}}";
+        state.json_first = false;
+    }
+
+    for (const auto& s : stats) {
+        state.csv << step << "," << std::defaultfloat << std::setprecision(9) << time << ",";
+        WriteCsvField(state.csv, s.first);
+        state.csv << "," << s.second.calls << "," << std::fixed << std::setprecision(6) << s.second.total << ","
+                  << s.second.max << "\n";
+    }
+}
+
+void ChTraceProfiler::Close() {
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.Drain(nullptr);
+    state.CloseChromeTrace();
+    if (state.csv.is_open())
+        state.csv.close();
+}
+
+size_t ChTraceProfiler::GetNumDropped() {
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    size_t dropped = 0;
+    for (const auto& buffer : state.buffers)
+        dropped += buffer->GetNumDropped();
+    return dropped;
+}
+
+void ChTraceProfiler::Record(const char* name, int64_t start, int64_t end) {
+    TraceBuffer* buffer = tls_buffer;
+    if (!buffer) {
+        // First zone recorded by this thread: create and register its buffer
+        auto& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        int tid = static_cast<int>(state.buffers.size());
+        state.buffers.push_back(std::unique_ptr<TraceBuffer>(new TraceBuffer(state.capacity, tid)));
+        buffer = state.buffers.back().get();
+        tls_buffer = buffer;
+    }
+    buffer->Push({name, start, end});
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,130 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Low-overhead, thread-safe tracing of scoped profiling zones, with export to
+// the Chrome trace-event JSON format and to a per-step CSV summary.
+//
+// =============================================================================
+
+#ifndef CH_TRACE_PROFILER_H
+#define CH_TRACE_PROFILER_H
+
+// To disable built-in tracing at compile time, define CH_NO_TRACE.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Tracing profiler for scoped zones (see CH_TRACE_ZONE).
+/// Each thread records the zones it executes (name, start, and end time) in its own fixed-capacity ring buffer, with no
+/// locking on the recording path. At the end of each simulation step (see EndStep, called by ChSystem), the recorded
+/// zones from all threads are drained and written to the enabled outputs:
+/// - a Chrome trace-event JSON file (load in chrome://tracing or https://ui.perfetto.dev), with one event per zone;
+/// - a CSV file with one line per zone and step, reporting the number of calls and the total and maximum zone times.
+///
+/// Tracing is disabled by default. When disabled, a zone costs one relaxed atomic load. If a thread buffer is full
+/// (i.e., more zones are recorded within one step than the buffer capacity), the new zones are dropped and counted.
+/// Zone names must be string literals (or otherwise have static storage duration).
+class ChApi ChTraceProfiler {
+  public:
+    /// Enable/disable recording of zones (default: false).
+    static void Enable(bool val);
+
+    /// Return true if recording of zones is enabled.
+    static bool IsEnabled() { return m_enabled.load(std::memory_order_relaxed); }
+
+    /// Set the capacity (number of zones) of the per-thread buffers (default: 65536).
+    /// Only affects buffers created after this call, i.e. it should be called before enabling tracing.
+    static void SetBufferCapacity(size_t capacity);
+
+    /// Write zones to the specified file, in Chrome trace-event JSON format.
+    /// Return false if the file could not be opened.
+    static bool SetOutputChromeTrace(const std::string& filename);
+
+    /// Write a per-step summary of zones to the specified file, in CSV format.
+    /// Each line contains: step, time, zone, number of calls, total time (ms), maximum time (ms).
+    /// Return false if the file could not be opened.
+    static bool SetOutputCSV(const std::string& filename);
+
+    /// Drain the zones recorded by all threads and write them to the outputs, labeled with the given step number and
+    /// simulation time. This function must be called from a single thread, outside any parallel region.
+    static void EndStep(size_t step, double time);
+
+    /// Drain any pending zones, then finalize and close all outputs.
+    static void Close();
+
+    /// Return the total number of zones dropped because of full thread buffers.
+    static size_t GetNumDropped();
+
+    /// Record a zone executed by the calling thread (used by ChTraceZone).
+    static void Record(const char* name, int64_t start, int64_t end);
+
+    /// Return the current time, in nanoseconds, as used for zone recording.
+    static int64_t Now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+  private:
+    static std::atomic<bool> m_enabled;
+};
+
+/// Scoped profiling zone.
+/// Records its lifetime with ChTraceProfiler, if tracing is enabled at construction. Use the CH_TRACE_ZONE macro.
+class ChTraceZone {
+  public:
+    explicit ChTraceZone(const char* name) : m_name(nullptr), m_start(0) {
+        if (ChTraceProfiler::IsEnabled()) {
+            m_name = name;
+            m_start = ChTraceProfiler::Now();
+        }
+    }
+
+    ~ChTraceZone() {
+        if (m_name)
+            ChTraceProfiler::Record(m_name, m_start, ChTraceProfiler::Now());
+    }
+
+  private:
+    ChTraceZone(const ChTraceZone&) = delete;
+    ChTraceZone& operator=(const ChTraceZone&) = delete;
+
+    const char* m_name;
+    int64_t m_start;
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#ifndef CH_NO_TRACE
+#define CH_TRACE_ZONE_CONCAT_(a, b) a##b
+#define CH_TRACE_ZONE_CONCAT(a, b) CH_TRACE_ZONE_CONCAT_(a, b)
+#define CH_TRACE_ZONE(name) chrono::utils::ChTraceZone CH_TRACE_ZONE_CONCAT(ch_trace_zone_, __LINE__)(name)
+#else
+#define CH_TRACE_ZONE(name)
+#endif
+
+#endif
@@ -24,6 +24,7 @@
 //    - it is assumed that the visualization asset geometry exctly matches the
 //      contact geometry.
 //    - only a subset of contact shapes are currently supported
+//  See ChCheckpoint for a (faster and more compact) binary checkpoint format.
 //
 // WriteShapesPovray
 //  this function writes a CSV file appropriate for processing with a POV-Ray
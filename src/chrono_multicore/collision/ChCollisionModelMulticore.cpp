@@ -76,6 +76,7 @@ bool ChCollisionModelMulticore::AddSphere(std::shared_ptr<ChMaterialSurface> mat
     const ChVector<>& position = frame.GetPos();
 
     auto shape = new ChCollisionShapeMulticore(ChCollisionShape::Type::SPHERE, material);
+    shape->m_dims = {radius};
     shape->A = real3(position.x(), position.y(), position.z());
     shape->B = real3(radius, 0, 0);
     shape->C = real3(0, 0, 0);
@@ -97,6 +98,7 @@ bool ChCollisionModelMulticore::AddEllipsoid(std::shared_ptr<ChMaterialSurface>
     const ChQuaternion<>& rotation = frame.GetRot();
 
     auto shape = new ChCollisionShapeMulticore(ChCollisionShape::Type::ELLIPSOID, material);
+    shape->m_dims = {rx, ry, rz};
     shape->A = real3(position.x(), position.y(), position.z());
     shape->B = real3(rx, ry, rz);
     shape->C = real3(0, 0, 0);
@@ -118,6 +120,7 @@ bool ChCollisionModelMulticore::AddBox(std::shared_ptr<ChMaterialSurface> materi
     const ChQuaternion<>& rotation = frame.GetRot();
 
     auto shape = new ChCollisionShapeMulticore(ChCollisionShape::Type::BOX, material);
+    shape->m_dims = {rx, ry, rz};
     shape->A = real3(position.x(), position.y(), position.z());
     shape->B = real3(rx, ry, rz);
     shape->C = real3(0, 0, 0);
@@ -140,6 +143,7 @@ bool ChCollisionModelMulticore::AddRoundedBox(std::shared_ptr<ChMaterialSurface>
     const ChQuaternion<>& rotation = frame.GetRot();
 
     auto shape = new ChCollisionShapeMulticore(ChCollisionShape::Type::ROUNDEDBOX, material);
+    shape->m_dims = {rx, ry, rz, sphere_r};
     shape->A = real3(position.x(), position.y(), position.z());
     shape->B = real3(rx, ry, rz);
     shape->C = real3(sphere_r, 0, 0);
@@ -182,6 +186,7 @@ bool ChCollisionModelMulticore::AddCylinder(std::shared_ptr<ChMaterialSurface> m
     const ChQuaternion<>& rotation = frame.GetRot();
 
     auto shape = new ChCollisionShapeMulticore(ChCollisionShape::Type::CYLINDER, material);
+    shape->m_dims = {rx, rz, hy};
     shape->A = real3(position.x(), position.y(), position.z());
     shape->B = real3(rx, hy, rz);
     shape->C = real3(0, 0, 0);
@@ -202,6 +207,7 @@ bool ChCollisionModelMulticore::AddCylindricalShell(std::shared_ptr<ChMaterialSu
     const ChQuaternion<>& rotation = frame.GetRot();
 
     auto shape = new ChCollisionShapeMulticore(ChCollisionShape::Type::CYLSHELL, material);
+    shape->m_dims = {radius, hlen};
     shape->A = real3(position.x(), position.y(), position.z());
     shape->B = real3(radius, hlen, radius);
     shape->C = real3(0, 0, 0);
@@ -224,6 +230,7 @@ bool ChCollisionModelMulticore::AddRoundedCylinder(std::shared_ptr<ChMaterialSur
     const ChQuaternion<>& rotation = frame.GetRot();
 
     auto shape = new ChCollisionShapeMulticore(ChCollisionShape::Type::ROUNDEDCYL, material);
+    shape->m_dims = {rx, rz, hy, sphere_r};
     shape->A = real3(position.x(), position.y(), position.z());
     shape->B = real3(rx, hy, rz);
     shape->C = real3(sphere_r, 0, 0);
@@ -245,6 +252,7 @@ bool ChCollisionModelMulticore::AddCone(std::shared_ptr<ChMaterialSurface> mater
     const ChQuaternion<>& rotation = frame.GetRot();
 
     auto shape = new ChCollisionShapeMulticore(ChCollisionShape::Type::CONE, material);
+    shape->m_dims = {rx, rz, hy};
     shape->A = real3(position.x(), position.y(), position.z());
     shape->B = real3(rx, hy, rz);
     shape->C = real3(0, 0, 0);
@@ -287,6 +295,7 @@ bool ChCollisionModelMulticore::AddCapsule(std::shared_ptr<ChMaterialSurface> ma
     const ChQuaternion<>& rotation = frame.GetRot();
 
     auto shape = new ChCollisionShapeMulticore(ChCollisionShape::Type::CAPSULE, material);
+    shape->m_dims = {radius, hlen};
     shape->A = real3(position.x(), position.y(), position.z());
     shape->B = real3(radius, hlen, radius);
     shape->C = real3(0, 0, 0);
@@ -358,6 +367,50 @@ bool ChCollisionModelMulticore::AddTriangleMesh(std::shared_ptr<ChMaterialSurfac
     return true;
 }
 
+/// Add a height field to this model
+bool ChCollisionModelMulticore::AddHeightField(std::shared_ptr<ChMaterialSurface> material,
+                                              std::shared_ptr<geometry::ChHeightField> hfield,
+                                              const ChVector<>& pos,
+                                              const ChMatrix33<>& rot,
+                                              double sphereswept_thickness) {
+    int nx = hfield->GetNumVerticesX();
+    int ny = hfield->GetNumVerticesY();
+    if (nx < 2 || ny < 2)
+        return false;
+
+    ChFrame<> frame;
+    TransformToCOG(GetBody(), pos, rot, frame);
+    const ChVector<>& position = frame.GetPos();
+    const ChQuaternion<>& rotation = frame.GetRot();
+    quaternion R(rotation.e0(), rotation.e1(), rotation.e2(), rotation.e3());
+
+    auto vertex = [&](int i, int j) {
+        ChVector<> v = hfield->GetVertex(i, j) + position;
+        return real3(v.x(), v.y(), v.z());
+    };
+
+    // Two triangles per grid cell, split along the diagonal from (i,j) to (i+1,j+1)
+    for (int j = 0; j < ny - 1; j++) {
+        for (int i = 0; i < nx - 1; i++) {
+            auto shape1 = new ChCollisionShapeMulticore(ChCollisionShape::Type::TRIANGLE, material);
+            shape1->A = vertex(i, j);
+            shape1->B = vertex(i + 1, j);
+            shape1->C = vertex(i + 1, j + 1);
+            shape1->R = R;
+            m_shapes.push_back(std::shared_ptr<ChCollisionShape>(shape1));
+
+            auto shape2 = new ChCollisionShapeMulticore(ChCollisionShape::Type::TRIANGLE, material);
+            shape2->A = vertex(i, j);
+            shape2->B = vertex(i + 1, j + 1);
+            shape2->C = vertex(i, j + 1);
+            shape2->R = R;
+            m_shapes.push_back(std::shared_ptr<ChCollisionShape>(shape2));
+        }
+    }
+
+    return true;
+}
+
 bool ChCollisionModelMulticore::AddCopyOfAnotherModel(ChCollisionModel* another) {
     // NOT SUPPORTED
     return false;
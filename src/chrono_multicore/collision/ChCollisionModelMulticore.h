@@ -207,6 +207,17 @@ class CH_MULTICORE_API ChCollisionModelMulticore : public ChCollisionModel {
         double sphereswept_thickness = 0.0                  ///< outward sphere-swept layer (when supported)
         ) override;
 
+    /// Add a height-field surface to this collision model.
+    /// The grid cells are added as individual triangle shapes (with the same triangulation as the height field), such
+    /// that the broadphase uniform grid locates the cells overlapping other shapes.
+    virtual bool AddHeightField(                          //
+        std::shared_ptr<ChMaterialSurface> material,      ///< surface contact material
+        std::shared_ptr<geometry::ChHeightField> hfield,  ///< the height field
+        const ChVector<>& pos = ChVector<>(),             ///< origin position in model coordinates
+        const ChMatrix33<>& rot = ChMatrix33<>(1),        ///< rotation in model coordinates
+        double sphereswept_thickness = 0.0                ///< outward sphere-swept layer (not used)
+        ) override;
+
     /// Add a barrel-like shape to this collision model (main axis on Y direction).
     /// The barrel shape is made by lathing an arc of an ellipse around the vertical Y axis.
     /// The center of the ellipse is on Y=0 level, and it is offsetted by R_offset from
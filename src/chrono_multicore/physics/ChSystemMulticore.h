@@ -262,6 +262,14 @@ class CH_MULTICORE_API ChSystemMulticoreSMC : public ChSystemMulticore {
     virtual void Setup() override;
     virtual void ChangeCollisionSystem(CollisionSystemType type) override;
 
+    /// Write the system state and the contact history (used with the MultiStep tangential displacement model) to the
+    /// given binary checkpoint.
+    virtual void CheckpointOut(utils::ChCheckpoint& checkpoint) const override;
+
+    /// Restore the system state and the contact history from the given binary checkpoint.
+    /// The contact history is restored only if consistent with the current system (same number of bodies).
+    virtual void CheckpointIn(const utils::ChCheckpoint& checkpoint) override;
+
     virtual real3 GetBodyContactForce(uint body_id) const override;
     virtual real3 GetBodyContactTorque(uint body_id) const override;
     using ChSystemMulticore::GetBodyContactForce;
@@ -12,10 +12,14 @@
 // Authors: Radu Serban, Hammad Mazhar
 // =============================================================================
 
+#include <cstring>
+
 #include "chrono_multicore/physics/ChSystemMulticore.h"
 #include "chrono_multicore/solver/ChIterativeSolverMulticore.h"
 #include "chrono_multicore/collision/ChContactContainerMulticoreSMC.h"
 
+#include "chrono/utils/ChCheckpoint.h"
+
 using namespace chrono;
 using namespace chrono::collision;
 
@@ -67,6 +71,50 @@ void ChSystemMulticoreSMC::ChangeCollisionSystem(CollisionSystemType type) {
     data_manager->settings.collision.collision_envelope = 0;
 }
 
+// Copy the given array (of elements with components of given size) into a checkpoint section.
+template <typename T>
+static void WriteHistory(utils::ChCheckpoint& checkpoint,
+                         const std::string& name,
+                         const custom_vector<T>& data,
+                         size_t component_size) {
+    checkpoint.SetSection(name, data.data(), data.size() * sizeof(T), component_size);
+}
+
+// Copy a checkpoint section into the given array (only if the sizes match).
+template <typename T>
+static void ReadHistory(const utils::ChCheckpoint& checkpoint, const std::string& name, custom_vector<T>& data) {
+    size_t size;
+    auto section = checkpoint.GetSection(name, size);
+    if (section && size == data.size() * sizeof(T))
+        std::memcpy(data.data(), section, size);
+}
+
+void ChSystemMulticoreSMC::CheckpointOut(utils::ChCheckpoint& checkpoint) const {
+    ChSystemMulticore::CheckpointOut(checkpoint);
+
+    if (data_manager->settings.solver.tangential_displ_mode != ChSystemSMC::TangentialDisplacementModel::MultiStep)
+        return;
+
+    const auto& host_data = data_manager->host_data;
+    WriteHistory(checkpoint, "mcore.shear_neigh", host_data.shear_neigh, sizeof(int));
+    WriteHistory(checkpoint, "mcore.shear_disp", host_data.shear_disp, sizeof(real));
+    WriteHistory(checkpoint, "mcore.contact_relvel_init", host_data.contact_relvel_init, sizeof(real));
+    WriteHistory(checkpoint, "mcore.contact_duration", host_data.contact_duration, sizeof(real));
+}
+
+void ChSystemMulticoreSMC::CheckpointIn(const utils::ChCheckpoint& checkpoint) {
+    ChSystemMulticore::CheckpointIn(checkpoint);
+
+    if (data_manager->settings.solver.tangential_displ_mode != ChSystemSMC::TangentialDisplacementModel::MultiStep)
+        return;
+
+    auto& host_data = data_manager->host_data;
+    ReadHistory(checkpoint, "mcore.shear_neigh", host_data.shear_neigh);
+    ReadHistory(checkpoint, "mcore.shear_disp", host_data.shear_disp);
+    ReadHistory(checkpoint, "mcore.contact_relvel_init", host_data.contact_relvel_init);
+    ReadHistory(checkpoint, "mcore.contact_duration", host_data.contact_duration);
+}
+
 real3 ChSystemMulticoreSMC::GetBodyContactForce(uint body_id) const {
     int index = data_manager->host_data.ct_body_map[body_id];
 
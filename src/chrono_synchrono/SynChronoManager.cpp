@@ -9,7 +9,13 @@ namespace chrono {
 namespace synchrono {
 
 SynChronoManager::SynChronoManager(SynNodeID nid, SynAgentNum num_nodes, std::shared_ptr<SynCommunicator> communicator)
-    : m_is_ok(true), m_initialized(false), m_nid(nid), m_num_nodes(num_nodes), m_heartbeat(1e-2), m_next_sync(0.0) {
+    : m_is_ok(true),
+      m_initialized(false),
+      m_nid(nid),
+      m_num_nodes(num_nodes),
+      m_heartbeat(1e-2),
+      m_next_sync(0.0),
+      m_interest_radius(0) {
     if (communicator)
         SetCommunicator(communicator);
 
@@ -125,6 +131,20 @@ void SynChronoManager::Synchronize(double time) {
     SynMessageList messages = GatherMessages();
     m_communicator->AddOutgoingMessages(messages);
 
+    // Set the region of interest of this node, if all agents have a position
+    if (m_interest_radius > 0) {
+        std::vector<ChVector<>> positions;
+        ChVector<> pos;
+        for (auto& agent_pair : m_agents) {
+            if (!agent_pair.second->GetPosition(pos)) {
+                positions.clear();
+                break;
+            }
+            positions.push_back(pos);
+        }
+        m_communicator->SetInterest(positions, m_interest_radius);
+    }
+
     // Send the messages out to each node and receive any other messages
     m_communicator->Synchronize();
 
@@ -83,6 +83,16 @@ class SYN_API SynChronoManager {
     ///
     void SetHeartbeat(double heartbeat) { m_heartbeat = heartbeat; }
 
+    ///@brief Set the radius of the region of interest of this node (default: 0, interest management disabled)
+    /// If positive, the region of interest of this node consists of the spheres of given radius centered at the
+    /// positions of its agents and, with a communicator that supports interest management, this node only receives
+    /// messages from nodes with agents in its region of interest. The radius should therefore cover the range in
+    /// which other agents are relevant (e.g. the range of the sensors on this node). Zombies of agents outside the
+    /// region of interest are not updated. Interest management is not used if any agent on this node does not have a
+    /// position (see SynAgent::GetPosition).
+    ///
+    void SetInterestRadius(double radius) { m_interest_radius = radius; }
+
     /// @brief Should the simulation still be running?
     bool IsOk() { return m_is_ok; }
 
@@ -142,6 +152,8 @@ class SYN_API SynChronoManager {
     double m_heartbeat;  ///< Rate at which synchronization between nodes occurs
     double m_next_sync;  ///< Time at which next synchronization between nodes should occur
 
+    double m_interest_radius;  ///< Radius of the region of interest around the agents on this node
+
     std::map<SynAgentID, std::shared_ptr<SynAgent>> m_agents;        ///< Agents in the SynChrono world on this node
     std::map<SynAgentID, std::shared_ptr<SynAgent>> m_zombies;       ///< Agents in the SynChrono world not on this node
     std::map<std::shared_ptr<SynAgent>, SynMessageList> m_messages;  ///< Messages associated with each agent
@@ -90,6 +90,14 @@ class SYN_API SynAgent {
     ///@param zombie the new zombie
     virtual void RegisterZombie(std::shared_ptr<SynAgent> zombie) {}
 
+    ///@brief Get the current position of this agent, used for interest management (see SynChronoManager)
+    /// Agents without a meaningful position (e.g. environment or terrain agents) return false, in which case their
+    /// messages are sent to all nodes.
+    ///
+    ///@param pos the position of the agent (in the absolute frame)
+    ///@return true if the agent has a position
+    virtual bool GetPosition(ChVector<>& pos) { return false; }
+
     // -------------------------------------------------------------------------
 
     void SetProcessMessageCallback(std::function<void(std::shared_ptr<SynMessage>)> callback);
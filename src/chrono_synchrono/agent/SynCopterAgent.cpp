@@ -85,6 +85,14 @@ void SynCopterAgent::Update() {
     m_state->SetState(time, chassis_pose, props_poses);
 }
 
+bool SynCopterAgent::GetPosition(ChVector<>& pos) {
+    if (!m_copter)
+        return false;
+
+    pos = m_copter->GetChassis()->GetPos();
+    return true;
+}
+
 // ------------------------------------------------------------------------
 
 void SynCopterAgent::SetID(SynAgentID aid) {
@@ -76,6 +76,10 @@ class SYN_API SynCopterAgent : public SynAgent {
     ///@param messages a referenced vector containing messages to be distributed from this rank
     virtual void GatherDescriptionMessages(SynMessageList& messages) override { messages.push_back(m_description); }
 
+    ///@brief Get the current position of the chassis (not available for zombies)
+    ///
+    virtual bool GetPosition(ChVector<>& pos) override;
+
     // ------------------------------------------------------------------------
 
     ///@brief Set the zombie visualization files
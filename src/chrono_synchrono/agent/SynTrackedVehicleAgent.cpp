@@ -67,6 +67,28 @@ void SynTrackedVehicleAgent::InitializeZombie(ChSystem* system) {
 void SynTrackedVehicleAgent::SynchronizeZombie(std::shared_ptr<SynMessage> message) {
     if (auto state = std::dynamic_pointer_cast<SynTrackedVehicleStateMessage>(message)) {
         m_zombie_body->SetFrame_REF_to_abs(state->chassis.GetFrame());
+
+        if (state->has_compact) {
+            // A delta frame cannot be decoded before the corresponding keyframe was received
+            std::vector<SynPose> poses;
+            if (!state->compact.Decode(state->chassis.GetFrame(), m_zombie_keyframe, poses))
+                return;
+            if (poses.size() != m_track_shoe_list.size() + m_sprocket_list.size() + m_idler_list.size() +
+                                    m_road_wheel_list.size())
+                return;
+
+            size_t k = 0;
+            for (auto& body : m_track_shoe_list)
+                body->SetFrame_REF_to_abs(poses[k++].GetFrame());
+            for (auto& body : m_sprocket_list)
+                body->SetFrame_REF_to_abs(poses[k++].GetFrame());
+            for (auto& body : m_idler_list)
+                body->SetFrame_REF_to_abs(poses[k++].GetFrame());
+            for (auto& body : m_road_wheel_list)
+                body->SetFrame_REF_to_abs(poses[k++].GetFrame());
+            return;
+        }
+
         for (int i = 0; i < state->track_shoes.size(); i++)
             m_track_shoe_list[i]->SetFrame_REF_to_abs(state->track_shoes[i].GetFrame());
         for (int i = 0; i < state->sprockets.size(); i++)
@@ -116,6 +138,14 @@ void SynTrackedVehicleAgent::Update() {
     m_state->SetState(time, chassis, track_shoes, sprockets, idlers, road_wheels);
 }
 
+bool SynTrackedVehicleAgent::GetPosition(ChVector<>& pos) {
+    if (!m_vehicle)
+        return false;
+
+    pos = m_vehicle->GetVehiclePos();
+    return true;
+}
+
 // ------------------------------------------------------------------------
 
 void SynTrackedVehicleAgent::SetZombieVisualizationFilesFromJSON(const std::string& filename) {
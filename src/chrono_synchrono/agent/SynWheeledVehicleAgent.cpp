@@ -27,6 +27,8 @@
 
 #include "chrono_vehicle/chassis/ChRigidChassis.h"
 
+#include <algorithm>
+
 using namespace chrono::vehicle;
 
 namespace chrono {
@@ -80,8 +82,15 @@ void SynWheeledVehicleAgent::InitializeZombie(ChSystem* system) {
 void SynWheeledVehicleAgent::SynchronizeZombie(std::shared_ptr<SynMessage> message) {
     if (auto state = std::dynamic_pointer_cast<SynWheeledVehicleStateMessage>(message)) {
         m_zombie_body->SetFrame_REF_to_abs(state->chassis.GetFrame());
-        for (int i = 0; i < state->wheels.size(); i++)
-            m_wheel_list[i]->SetFrame_REF_to_abs(state->wheels[i].GetFrame());
+
+        // A delta frame cannot be decoded before the corresponding keyframe was received
+        std::vector<SynPose> wheels;
+        if (state->has_compact && !state->compact.Decode(state->chassis.GetFrame(), m_zombie_keyframe, wheels))
+            return;
+
+        const auto& poses = state->has_compact ? wheels : state->wheels;
+        for (size_t i = 0; i < std::min(poses.size(), m_wheel_list.size()); i++)
+            m_wheel_list[i]->SetFrame_REF_to_abs(poses[i].GetFrame());
     }
 }
 
@@ -114,6 +123,14 @@ void SynWheeledVehicleAgent::Update() {
     m_state->SetState(time, chassis, wheels);
 }
 
+bool SynWheeledVehicleAgent::GetPosition(ChVector<>& pos) {
+    if (!m_vehicle)
+        return false;
+
+    pos = m_vehicle->GetVehiclePos();
+    return true;
+}
+
 // ------------------------------------------------------------------------
 
 void SynWheeledVehicleAgent::SetZombieVisualizationFilesFromJSON(const std::string& filename) {
@@ -78,6 +78,20 @@ class SYN_API SynWheeledVehicleAgent : public SynAgent {
     ///@param messages a referenced vector containing messages to be distributed from this rank
     virtual void GatherDescriptionMessages(SynMessageList& messages) override { messages.push_back(m_description); }
 
+    ///@brief Get the current position of the chassis (not available for zombies)
+    ///
+    virtual bool GetPosition(ChVector<>& pos) override;
+
+    ///@brief Enable the compact encoding of the wheel poses in the state messages (default: false)
+    /// See SynCompactPoses for a description of the encoding.
+    ///
+    ///@param val whether the compact encoding is used
+    ///@param resolution quantization step for the positions relative to the chassis
+    ///@param keyframe_interval number of messages between keyframes
+    void EnableCompactEncoding(bool val, double resolution = 1e-3, int keyframe_interval = 10) {
+        m_state->EnableCompactEncoding(val, resolution, keyframe_interval);
+    }
+
     // ------------------------------------------------------------------------
 
     ///@brief Set the zombie visualization files from a JSON specification file
@@ -130,6 +144,7 @@ class SYN_API SynWheeledVehicleAgent : public SynAgent {
 
     std::shared_ptr<ChBodyAuxRef> m_zombie_body;              ///< agent's zombie body reference
     std::vector<std::shared_ptr<ChBodyAuxRef>> m_wheel_list;  ///< vector of this agent's zombie wheels
+    SynCompactPoses m_zombie_keyframe;                        ///< last keyframe received (compact encoding)
 };
 
 /// @} synchrono_agent
@@ -27,7 +27,7 @@
 namespace chrono {
 namespace synchrono {
 
-SynCommunicator::SynCommunicator() : m_initialized(false) {}
+SynCommunicator::SynCommunicator() : m_initialized(false), m_interest_set(false), m_interest_radius(0) {}
 
 SynCommunicator::~SynCommunicator() {}
 
@@ -63,6 +63,18 @@ void SynCommunicator::ProcessBuffer(std::vector<uint8_t>& data) {
     m_flatbuffers_manager.ProcessBuffer(data, m_incoming_messages);
 }
 
+void SynCommunicator::SetInterest(const std::vector<ChVector<>>& positions, double radius) {
+    m_interest_set = true;
+    m_interest_radius = radius;
+    m_interest_positions = positions;
+}
+
+void SynCommunicator::ClearInterest() {
+    m_interest_set = false;
+    m_interest_radius = 0;
+    m_interest_positions.clear();
+}
+
 // -----------------------------------------------------------------------------------------------
 
 }  // namespace synchrono
@@ -29,6 +29,8 @@
 #include "chrono_synchrono/flatbuffer/SynFlatBuffersManager.h"
 #include "chrono_synchrono/flatbuffer/message/SynMessage.h"
 
+#include "chrono/core/ChVector.h"
+
 #include <vector>
 #include <functional>
 
@@ -102,11 +104,30 @@ class SYN_API SynCommunicator {
     ///@return SynMessageList the received messages
     virtual SynMessageList& GetMessages() { return m_incoming_messages; }
 
+    ///@brief Set the region of interest of this node for the next call to Synchronize.
+    /// The region of interest is the union of the spheres with given radius centered at the specified positions
+    /// (typically the positions of the agents on this node). Communicators that support interest management only
+    /// exchange data between nodes whose agents lie in each other's regions of interest. If no region of interest is
+    /// set (or the list of positions is empty), data is exchanged with all nodes. Communicators that do not support
+    /// interest management ignore this information.
+    ///
+    ///@param positions the centers of the region of interest
+    ///@param radius the radius of interest around each position
+    void SetInterest(const std::vector<ChVector<>>& positions, double radius);
+
+    ///@brief Clear the region of interest (data will be exchanged with all nodes)
+    ///
+    void ClearInterest();
+
     // -----------------------------------------------------------------------------------------------
 
   protected:
     bool m_initialized;  ///< whether the communicator has been initialized
 
+    bool m_interest_set;                           ///< whether a region of interest was set
+    double m_interest_radius;                      ///< radius of the region of interest
+    std::vector<ChVector<>> m_interest_positions;  ///< centers of the region of interest
+
     SynMessageList m_incoming_messages;           ///< Incoming messages
     SynFlatBuffersManager m_flatbuffers_manager;  ///< flatbuffer manager for this rank
 };
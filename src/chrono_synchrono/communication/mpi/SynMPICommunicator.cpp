@@ -26,7 +26,7 @@
 namespace chrono {
 namespace synchrono {
 
-SynMPICommunicator::SynMPICommunicator(int argc, char* argv[]) {
+SynMPICommunicator::SynMPICommunicator(int argc, char* argv[]) : m_total_length(0), m_num_received(0) {
     // mpi initialization
     MPI_Init(&argc, &argv);
     // set rank
@@ -38,6 +38,11 @@ SynMPICommunicator::SynMPICommunicator(int argc, char* argv[]) {
 
     m_msg_lengths = new int[m_num_ranks];
     m_msg_displs = new int[m_num_ranks];
+
+    m_headers.resize(2 * m_num_ranks);
+    m_interest_counts.resize(m_num_ranks);
+    m_interest_displs.resize(m_num_ranks);
+    m_requests.reserve(2 * m_num_ranks);
 }
 
 SynMPICommunicator::~SynMPICommunicator() {
@@ -56,45 +61,126 @@ void SynMPICommunicator::Synchronize() {
 
     int msg_length = m_flatbuffers_manager.GetSize();
 
-    // Get the length of message from each agent
-    MPI_Allgather(&msg_length, 1, MPI_INT,    // Sending pointer, length, type
-                  m_msg_lengths, 1, MPI_INT,  // Receiving pointer, length, type
-                  MPI_COMM_WORLD);            // Receiving rank and world
+    // Get the length of message and the number of interest positions from each agent
+    int header[2] = {msg_length, m_interest_set ? (int)m_interest_positions.size() : 0};
+    MPI_Allgather(header, 2, MPI_INT,             // Sending pointer, length, type
+                  m_headers.data(), 2, MPI_INT,  // Receiving pointer, length, type
+                  MPI_COMM_WORLD);               // Receiving rank and world
 
     m_total_length = 0;
+    int total_interest = 0;
 
     // In C++17 this could just be an exclusive scan from std::
     // Didn't use std::partial_sum since we want m_total_length computed
     // m_msg_displs is needed by MPI_Gatherv
     for (int i = 0; i < m_num_ranks; i++) {
+        m_msg_lengths[i] = m_headers[2 * i];
         m_msg_displs[i] = m_total_length;
         m_total_length += m_msg_lengths[i];
+
+        // Interest data is the radius followed by the coordinates of the positions
+        int num_positions = m_headers[2 * i + 1];
+        m_interest_counts[i] = num_positions > 0 ? 1 + 3 * num_positions : 0;
+        m_interest_displs[i] = total_interest;
+        total_interest += m_interest_counts[i];
     }
 
-    // if (m_rank == 0)
-    //     std::cout << m_rank << " message length: " << m_total_length << std::endl;
+    m_all_data.resize(m_total_length);
+
+    if (total_interest == 0) {
+        // No rank uses interest management, so every rank receives all data
+        MPI_Allgatherv(m_flatbuffers_manager.GetBufferPointer(), msg_length, MPI_BYTE,  // Sending pointer, length, type
+                       m_all_data.data(), m_msg_lengths, m_msg_displs,
+                       MPI_BYTE,  // Receiving pointer, lengths, displacements, type
+                       MPI_COMM_WORLD);
+
+        m_num_received = m_num_ranks - 1;
+    } else {
+        // Exchange the regions of interest
+        std::vector<double> interest(m_interest_counts[m_rank]);
+        if (!interest.empty()) {
+            interest[0] = m_interest_radius;
+            for (size_t k = 0; k < m_interest_positions.size(); k++) {
+                interest[1 + 3 * k + 0] = m_interest_positions[k].x();
+                interest[1 + 3 * k + 1] = m_interest_positions[k].y();
+                interest[1 + 3 * k + 2] = m_interest_positions[k].z();
+            }
+        }
 
-    m_all_data.reserve(m_total_length);
+        m_all_interest.resize(total_interest);
+        MPI_Allgatherv(interest.data(), m_interest_counts[m_rank], MPI_DOUBLE,  // Sending pointer, length, type
+                       m_all_interest.data(), m_interest_counts.data(), m_interest_displs.data(),
+                       MPI_DOUBLE,  // Receiving pointer, lengths, displacements, type
+                       MPI_COMM_WORLD);
+
+        // Every rank evaluates the same send/receive relation, so data is only exchanged between interested ranks.
+        // Data from ranks that are not received is marked with a zero length.
+        m_requests.clear();
+        m_num_received = 0;
+        for (int i = 0; i < m_num_ranks; i++) {
+            if (i == m_rank)
+                continue;
+
+            if (IsInterested(m_rank, i)) {
+                m_requests.emplace_back();
+                MPI_Irecv(m_all_data.data() + m_msg_displs[i], m_msg_lengths[i], MPI_BYTE, i, 0, MPI_COMM_WORLD,
+                          &m_requests.back());
+                m_num_received++;
+            } else {
+                m_msg_lengths[i] = 0;
+            }
+
+            if (IsInterested(i, m_rank)) {
+                m_requests.emplace_back();
+                MPI_Isend(m_flatbuffers_manager.GetBufferPointer(), msg_length, MPI_BYTE, i, 0, MPI_COMM_WORLD,
+                          &m_requests.back());
+            }
+        }
 
-    MPI_Allgatherv(m_flatbuffers_manager.GetBufferPointer(), msg_length, MPI_BYTE,  // Sending pointer, length, type
-                   m_all_data.data(), m_msg_lengths, m_msg_displs,
-                   MPI_BYTE,  // Receiving pointer, lengths, displacements, type
-                   MPI_COMM_WORLD);
+        MPI_Waitall((int)m_requests.size(), m_requests.data(), MPI_STATUSES_IGNORE);
+    }
 
     m_flatbuffers_manager.Reset();
+
+    // The region of interest only applies to this synchronization
+    ClearInterest();
 }
 
 SynMessageList& SynMPICommunicator::GetMessages() {
     for (int i = 0; i < m_num_ranks; i++) {
-        if (i != m_rank) {
-            std::vector<uint8_t> data = std::vector<uint8_t>(m_all_data.data() + m_msg_displs[i],
-                                                             m_all_data.data() + m_msg_displs[i] + m_msg_lengths[i]);
-            m_flatbuffers_manager.ProcessBuffer(data, m_incoming_messages);
-        }
+        // Messages are parsed directly from the receive buffer
+        if (i != m_rank && m_msg_lengths[i] > 0)
+            m_flatbuffers_manager.ProcessBuffer(m_all_data.data() + m_msg_displs[i], m_msg_lengths[i],
+                                                m_incoming_messages);
     }
 
     return m_incoming_messages;
 }
 
+bool SynMPICommunicator::IsInterested(int receiver, int sender) const {
+    int count_r = m_interest_counts[receiver];
+    int count_s = m_interest_counts[sender];
+
+    // Ranks without a region of interest exchange data with everybody
+    if (count_r == 0 || count_s == 0)
+        return true;
+
+    const double* interest_r = m_all_interest.data() + m_interest_displs[receiver];
+    const double* interest_s = m_all_interest.data() + m_interest_displs[sender];
+    double radius2 = interest_r[0] * interest_r[0];
+
+    for (int i = 1; i < count_r; i += 3) {
+        for (int j = 1; j < count_s; j += 3) {
+            double dx = interest_s[j + 0] - interest_r[i + 0];
+            double dy = interest_s[j + 1] - interest_r[i + 1];
+            double dz = interest_s[j + 2] - interest_r[i + 2];
+            if (dx * dx + dy * dy + dz * dz <= radius2)
+                return true;
+        }
+    }
+
+    return false;
+}
+
 }  // namespace synchrono
 }  // namespace chrono
\ No newline at end of file
@@ -35,7 +35,12 @@ namespace synchrono {
 /// @{
 
 /// Derived communicator used to establish and facilitate communication between nodes.
-/// Uses the Message Passing Interface (MPI) standard
+/// Uses the Message Passing Interface (MPI) standard.
+///
+/// By default, the data of each rank is sent to all other ranks (MPI_Allgatherv). If a region of interest is set on
+/// any rank (see SynCommunicator::SetInterest), the regions of interest are exchanged first and the data of a rank is
+/// then sent (point-to-point) only to the ranks that have one of its positions in their region of interest. Ranks
+/// without a region of interest still send to and receive from all other ranks.
 class SYN_API SynMPICommunicator : public SynCommunicator {
   public:
     ///@brief Default constructor
@@ -85,17 +90,32 @@ class SYN_API SynMPICommunicator : public SynCommunicator {
     ///
     virtual int GetNumRanks() const { return m_num_ranks; }
 
+    ///@brief Get the number of ranks from which data was received during the last call to Synchronize
+    ///
+    int GetNumReceived() const { return m_num_received; }
+
     // -----------------------------------------------------------------------------------------------
 
   private:
+    ///@brief Check if the specified receiving rank is interested in the data of the sending rank
+    ///
+    bool IsInterested(int receiver, int sender) const;
+
     int m_rank;
     int m_num_ranks;
 
     int m_total_length;
+    int m_num_received;
 
     int* m_msg_lengths;
     int* m_msg_displs;
 
+    std::vector<int> m_headers;           ///< message length and number of interest positions, for each rank
+    std::vector<int> m_interest_counts;   ///< size of the interest data of each rank
+    std::vector<int> m_interest_displs;   ///< displacements of the interest data of each rank
+    std::vector<double> m_all_interest;   ///< interest data (radius and positions) of all ranks
+    std::vector<MPI_Request> m_requests;  ///< pending point-to-point requests
+
     std::vector<uint8_t> m_rank_data;
     std::vector<uint8_t> m_all_data;
 };
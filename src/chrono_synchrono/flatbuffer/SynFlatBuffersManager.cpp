@@ -21,6 +21,7 @@
 #include "chrono_synchrono/flatbuffer/SynFlatBuffersManager.h"
 
 #include "chrono_synchrono/flatbuffer/message/SynMessageFactory.h"
+#include "chrono_synchrono/utils/SynLog.h"
 
 namespace chrono {
 namespace synchrono {
@@ -32,11 +33,26 @@ SynFlatBuffersManager::SynFlatBuffersManager(int msg_length) : m_builder(msg_len
 }
 
 void SynFlatBuffersManager::ProcessBuffer(std::vector<uint8_t>& data, SynMessageList& messages) {
-    auto buffer = flatbuffers::GetSizePrefixedRoot<SynFlatBuffers::Buffer>(data.data());
+    ProcessBuffer(data.data(), data.size(), messages);
+}
+
+bool SynFlatBuffersManager::ProcessBuffer(const uint8_t* data, size_t size, SynMessageList& messages) {
+    flatbuffers::Verifier verifier(data, size);
+    if (!SynFlatBuffers::VerifySizePrefixedBufferBuffer(verifier)) {
+        SynLog() << "WARNING: SynFlatBuffersManager received an invalid buffer. Ignoring it.\n";
+        return false;
+    }
+
+    auto buffer = flatbuffers::GetSizePrefixedRoot<SynFlatBuffers::Buffer>(data);
+    if (!buffer->buffer())
+        return true;
+
     for (auto message : (*buffer->buffer())) {
         auto msg = SynMessageFactory::GenerateMessage(message);
         messages.push_back(msg);
     }
+
+    return true;
 }
 
 // Adds a SynMessage to the flatbuffer message buffer.
@@ -54,6 +54,16 @@ class SYN_API SynFlatBuffersManager {
     ///@param messages reference to message list to store the parsed messages
     void ProcessBuffer(std::vector<uint8_t>& data, SynMessageList& messages);
 
+    ///@brief Process a data buffer with the assumption it is a size prefixed SynFlatBuffers::Buffer message.
+    /// The messages are parsed directly from the given memory (e.g. a receive buffer), without copying it. The buffer
+    /// is verified first and ignored if it is not a valid SynFlatBuffers::Buffer.
+    ///
+    ///@param data pointer to the data to process
+    ///@param size size of the data (in bytes)
+    ///@param messages reference to message list to store the parsed messages
+    ///@return false if the buffer is not valid
+    bool ProcessBuffer(const uint8_t* data, size_t size, SynMessageList& messages);
+
     ///@brief Adds a SynMessage to the flatbuffer message buffer. Will call MessageFromState automatically
     ///
     ///@param message the SynMessage to add
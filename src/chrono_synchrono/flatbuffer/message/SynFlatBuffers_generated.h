@@ -26,6 +26,11 @@ struct QuaternionBuilder;
 struct Pose;
 struct PoseBuilder;
 
+struct CompactPose;
+
+struct CompactPoses;
+struct CompactPosesBuilder;
+
 namespace Approach {
 
 struct State;
@@ -382,6 +387,59 @@ template<> struct TypeTraits<SynFlatBuffers::Simulation::State> {
 bool VerifyType(flatbuffers::Verifier &verifier, const void *obj, Type type);
 bool VerifyTypeVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types);
 
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(2) CompactPose FLATBUFFERS_FINAL_CLASS {
+ private:
+  int16_t x_;
+  int16_t y_;
+  int16_t z_;
+  int16_t e0_;
+  int16_t e1_;
+  int16_t e2_;
+  int16_t e3_;
+
+ public:
+  CompactPose()
+      : x_(0),
+        y_(0),
+        z_(0),
+        e0_(0),
+        e1_(0),
+        e2_(0),
+        e3_(0) {
+  }
+  CompactPose(int16_t _x, int16_t _y, int16_t _z, int16_t _e0, int16_t _e1, int16_t _e2, int16_t _e3)
+      : x_(flatbuffers::EndianScalar(_x)),
+        y_(flatbuffers::EndianScalar(_y)),
+        z_(flatbuffers::EndianScalar(_z)),
+        e0_(flatbuffers::EndianScalar(_e0)),
+        e1_(flatbuffers::EndianScalar(_e1)),
+        e2_(flatbuffers::EndianScalar(_e2)),
+        e3_(flatbuffers::EndianScalar(_e3)) {
+  }
+  int16_t x() const {
+    return flatbuffers::EndianScalar(x_);
+  }
+  int16_t y() const {
+    return flatbuffers::EndianScalar(y_);
+  }
+  int16_t z() const {
+    return flatbuffers::EndianScalar(z_);
+  }
+  int16_t e0() const {
+    return flatbuffers::EndianScalar(e0_);
+  }
+  int16_t e1() const {
+    return flatbuffers::EndianScalar(e1_);
+  }
+  int16_t e2() const {
+    return flatbuffers::EndianScalar(e2_);
+  }
+  int16_t e3() const {
+    return flatbuffers::EndianScalar(e3_);
+  }
+};
+FLATBUFFERS_STRUCT_END(CompactPose, 14);
+
 namespace Terrain {
 namespace SCM {
 
@@ -785,6 +843,107 @@ inline flatbuffers::Offset<Pose> CreatePose(
   return builder_.Finish();
 }
 
+struct CompactPoses FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef CompactPosesBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_RESOLUTION = 4,
+    VT_KEYFRAME = 6,
+    VT_DELTA = 8,
+    VT_INDICES = 10,
+    VT_POSES = 12
+  };
+  double resolution() const {
+    return GetField<double>(VT_RESOLUTION, 0.0);
+  }
+  uint32_t keyframe() const {
+    return GetField<uint32_t>(VT_KEYFRAME, 0);
+  }
+  bool delta() const {
+    return GetField<uint8_t>(VT_DELTA, 0) != 0;
+  }
+  const flatbuffers::Vector<uint16_t> *indices() const {
+    return GetPointer<const flatbuffers::Vector<uint16_t> *>(VT_INDICES);
+  }
+  const flatbuffers::Vector<const SynFlatBuffers::CompactPose *> *poses() const {
+    return GetPointer<const flatbuffers::Vector<const SynFlatBuffers::CompactPose *> *>(VT_POSES);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<double>(verifier, VT_RESOLUTION) &&
+           VerifyField<uint32_t>(verifier, VT_KEYFRAME) &&
+           VerifyField<uint8_t>(verifier, VT_DELTA) &&
+           VerifyOffset(verifier, VT_INDICES) &&
+           verifier.VerifyVector(indices()) &&
+           VerifyOffset(verifier, VT_POSES) &&
+           verifier.VerifyVector(poses()) &&
+           verifier.EndTable();
+  }
+};
+
+struct CompactPosesBuilder {
+  typedef CompactPoses Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_resolution(double resolution) {
+    fbb_.AddElement<double>(CompactPoses::VT_RESOLUTION, resolution, 0.0);
+  }
+  void add_keyframe(uint32_t keyframe) {
+    fbb_.AddElement<uint32_t>(CompactPoses::VT_KEYFRAME, keyframe, 0);
+  }
+  void add_delta(bool delta) {
+    fbb_.AddElement<uint8_t>(CompactPoses::VT_DELTA, static_cast<uint8_t>(delta), 0);
+  }
+  void add_indices(flatbuffers::Offset<flatbuffers::Vector<uint16_t>> indices) {
+    fbb_.AddOffset(CompactPoses::VT_INDICES, indices);
+  }
+  void add_poses(flatbuffers::Offset<flatbuffers::Vector<const SynFlatBuffers::CompactPose *>> poses) {
+    fbb_.AddOffset(CompactPoses::VT_POSES, poses);
+  }
+  explicit CompactPosesBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<CompactPoses> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<CompactPoses>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<CompactPoses> CreateCompactPoses(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    double resolution = 0.0,
+    uint32_t keyframe = 0,
+    bool delta = false,
+    flatbuffers::Offset<flatbuffers::Vector<uint16_t>> indices = 0,
+    flatbuffers::Offset<flatbuffers::Vector<const SynFlatBuffers::CompactPose *>> poses = 0) {
+  CompactPosesBuilder builder_(_fbb);
+  builder_.add_resolution(resolution);
+  builder_.add_poses(poses);
+  builder_.add_indices(indices);
+  builder_.add_keyframe(keyframe);
+  builder_.add_delta(delta);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<CompactPoses> CreateCompactPosesDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    double resolution = 0.0,
+    uint32_t keyframe = 0,
+    bool delta = false,
+    const std::vector<uint16_t> *indices = nullptr,
+    const std::vector<SynFlatBuffers::CompactPose> *poses = nullptr) {
+  auto indices__ = indices ? _fbb.CreateVector<uint16_t>(*indices) : 0;
+  auto poses__ = poses ? _fbb.CreateVectorOfStructs<SynFlatBuffers::CompactPose>(*poses) : 0;
+  return SynFlatBuffers::CreateCompactPoses(
+      _fbb,
+      resolution,
+      keyframe,
+      delta,
+      indices__,
+      poses__);
+}
+
 namespace Approach {
 
 struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -1045,7 +1204,8 @@ struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
     VT_TIME = 4,
     VT_CHASSIS = 6,
-    VT_WHEELS = 8
+    VT_WHEELS = 8,
+    VT_COMPACT = 10
   };
   double time() const {
     return GetField<double>(VT_TIME, 0.0);
@@ -1056,6 +1216,9 @@ struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *wheels() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *>(VT_WHEELS);
   }
+  const SynFlatBuffers::CompactPoses *compact() const {
+    return GetPointer<const SynFlatBuffers::CompactPoses *>(VT_COMPACT);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<double>(verifier, VT_TIME) &&
@@ -1064,6 +1227,8 @@ struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyOffset(verifier, VT_WHEELS) &&
            verifier.VerifyVector(wheels()) &&
            verifier.VerifyVectorOfTables(wheels()) &&
+           VerifyOffset(verifier, VT_COMPACT) &&
+           verifier.VerifyTable(compact()) &&
            verifier.EndTable();
   }
 };
@@ -1081,6 +1246,9 @@ struct StateBuilder {
   void add_wheels(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> wheels) {
     fbb_.AddOffset(State::VT_WHEELS, wheels);
   }
+  void add_compact(flatbuffers::Offset<SynFlatBuffers::CompactPoses> compact) {
+    fbb_.AddOffset(State::VT_COMPACT, compact);
+  }
   explicit StateBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -1096,9 +1264,11 @@ inline flatbuffers::Offset<State> CreateState(
     flatbuffers::FlatBufferBuilder &_fbb,
     double time = 0.0,
     flatbuffers::Offset<SynFlatBuffers::Pose> chassis = 0,
-    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> wheels = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> wheels = 0,
+    flatbuffers::Offset<SynFlatBuffers::CompactPoses> compact = 0) {
   StateBuilder builder_(_fbb);
   builder_.add_time(time);
+  builder_.add_compact(compact);
   builder_.add_wheels(wheels);
   builder_.add_chassis(chassis);
   return builder_.Finish();
@@ -1108,13 +1278,15 @@ inline flatbuffers::Offset<State> CreateStateDirect(
     flatbuffers::FlatBufferBuilder &_fbb,
     double time = 0.0,
     flatbuffers::Offset<SynFlatBuffers::Pose> chassis = 0,
-    const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *wheels = nullptr) {
+    const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *wheels = nullptr,
+    flatbuffers::Offset<SynFlatBuffers::CompactPoses> compact = 0) {
   auto wheels__ = wheels ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*wheels) : 0;
   return SynFlatBuffers::Agent::WheeledVehicle::CreateState(
       _fbb,
       time,
       chassis,
-      wheels__);
+      wheels__,
+      compact);
 }
 
 struct Description FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -1220,7 +1392,8 @@ struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_TRACK_SHOES = 8,
     VT_SPROCKETS = 10,
     VT_IDLERS = 12,
-    VT_ROAD_WHEELS = 14
+    VT_ROAD_WHEELS = 14,
+    VT_COMPACT = 16
   };
   double time() const {
     return GetField<double>(VT_TIME, 0.0);
@@ -1240,6 +1413,9 @@ struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *road_wheels() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *>(VT_ROAD_WHEELS);
   }
+  const SynFlatBuffers::CompactPoses *compact() const {
+    return GetPointer<const SynFlatBuffers::CompactPoses *>(VT_COMPACT);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<double>(verifier, VT_TIME) &&
@@ -1257,6 +1433,8 @@ struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyOffset(verifier, VT_ROAD_WHEELS) &&
            verifier.VerifyVector(road_wheels()) &&
            verifier.VerifyVectorOfTables(road_wheels()) &&
+           VerifyOffset(verifier, VT_COMPACT) &&
+           verifier.VerifyTable(compact()) &&
            verifier.EndTable();
   }
 };
@@ -1283,6 +1461,9 @@ struct StateBuilder {
   void add_road_wheels(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> road_wheels) {
     fbb_.AddOffset(State::VT_ROAD_WHEELS, road_wheels);
   }
+  void add_compact(flatbuffers::Offset<SynFlatBuffers::CompactPoses> compact) {
+    fbb_.AddOffset(State::VT_COMPACT, compact);
+  }
   explicit StateBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -1301,9 +1482,11 @@ inline flatbuffers::Offset<State> CreateState(
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> track_shoes = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> sprockets = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> idlers = 0,
-    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> road_wheels = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> road_wheels = 0,
+    flatbuffers::Offset<SynFlatBuffers::CompactPoses> compact = 0) {
   StateBuilder builder_(_fbb);
   builder_.add_time(time);
+  builder_.add_compact(compact);
   builder_.add_road_wheels(road_wheels);
   builder_.add_idlers(idlers);
   builder_.add_sprockets(sprockets);
@@ -1319,7 +1502,8 @@ inline flatbuffers::Offset<State> CreateStateDirect(
     const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *track_shoes = nullptr,
     const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *sprockets = nullptr,
     const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *idlers = nullptr,
-    const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *road_wheels = nullptr) {
+    const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *road_wheels = nullptr,
+    flatbuffers::Offset<SynFlatBuffers::CompactPoses> compact = 0) {
   auto track_shoes__ = track_shoes ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*track_shoes) : 0;
   auto sprockets__ = sprockets ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*sprockets) : 0;
   auto idlers__ = idlers ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*idlers) : 0;
@@ -1331,7 +1515,8 @@ inline flatbuffers::Offset<State> CreateStateDirect(
       track_shoes__,
       sprockets__,
       idlers__,
-      road_wheels__);
+      road_wheels__,
+      compact);
 }
 
 struct Description FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -73,5 +73,115 @@ flatbuffers::Offset<SynFlatBuffers::Pose> SynPose::ToFlatBuffers(flatbuffers::Fl
     return fb_pose;
 }
 
+// -----------------------------------------------------------------------------
+
+static int16_t Quantize(double val) {
+    return (int16_t)std::round(ChClamp(val, -32767.0, 32767.0));
+}
+
+static SynFlatBuffers::CompactPose QuantizePose(const ChFrame<>& ref, const ChFrame<>& frame, double resolution) {
+    ChVector<> pos = ref.TransformPointParentToLocal(frame.GetPos()) / resolution;
+    ChQuaternion<> rot = ref.GetRot().GetConjugate() * frame.GetRot();
+
+    // q and -q represent the same rotation; use the one with non-negative scalar part
+    if (rot.e0() < 0)
+        rot = -rot;
+    rot *= 32767;
+
+    return SynFlatBuffers::CompactPose(Quantize(pos.x()), Quantize(pos.y()), Quantize(pos.z()),  //
+                                       Quantize(rot.e0()), Quantize(rot.e1()), Quantize(rot.e2()), Quantize(rot.e3()));
+}
+
+static SynPose DequantizePose(const ChFrame<>& ref, const SynFlatBuffers::CompactPose& pose, double resolution) {
+    ChVector<> pos = resolution * ChVector<>(pose.x(), pose.y(), pose.z());
+    ChQuaternion<> rot(pose.e0(), pose.e1(), pose.e2(), pose.e3());
+    rot.Normalize();
+
+    return SynPose(ref.TransformPointLocalToParent(pos), ref.GetRot() * rot);
+}
+
+static bool SamePose(const SynFlatBuffers::CompactPose& a, const SynFlatBuffers::CompactPose& b) {
+    return a.x() == b.x() && a.y() == b.y() && a.z() == b.z() &&  //
+           a.e0() == b.e0() && a.e1() == b.e1() && a.e2() == b.e2() && a.e3() == b.e3();
+}
+
+SynCompactPoses::SynCompactPoses() : m_resolution(0), m_keyframe(0), m_delta(false) {}
+
+SynCompactPoses::SynCompactPoses(const SynFlatBuffers::CompactPoses* poses)
+    : m_resolution(poses->resolution()), m_keyframe(poses->keyframe()), m_delta(poses->delta()) {
+    if (poses->indices())
+        m_indices.assign(poses->indices()->begin(), poses->indices()->end());
+    if (poses->poses()) {
+        m_poses.reserve(poses->poses()->size());
+        for (auto pose : (*poses->poses()))
+            m_poses.push_back(*pose);
+    }
+}
+
+void SynCompactPoses::Encode(const ChFrame<>& ref,
+                             const std::vector<SynPose>& poses,
+                             double resolution,
+                             SynCompactPoses& keyframe,
+                             bool force_keyframe) {
+    std::vector<SynFlatBuffers::CompactPose> quantized;
+    quantized.reserve(poses.size());
+    for (const auto& pose : poses)
+        quantized.push_back(QuantizePose(ref, pose.GetFrame(), resolution));
+
+    m_resolution = resolution;
+    m_indices.clear();
+
+    if (force_keyframe || keyframe.m_poses.size() != quantized.size() || keyframe.m_resolution != resolution) {
+        m_keyframe = keyframe.m_keyframe + 1;
+        m_delta = false;
+        m_poses = std::move(quantized);
+        keyframe = *this;
+        return;
+    }
+
+    // Delta frame: only include the poses that changed since the keyframe
+    m_keyframe = keyframe.m_keyframe;
+    m_delta = true;
+    m_poses.clear();
+    for (size_t i = 0; i < quantized.size(); i++) {
+        if (!SamePose(quantized[i], keyframe.m_poses[i])) {
+            m_indices.push_back((uint16_t)i);
+            m_poses.push_back(quantized[i]);
+        }
+    }
+}
+
+bool SynCompactPoses::Decode(const ChFrame<>& ref, SynCompactPoses& keyframe, std::vector<SynPose>& poses) const {
+    std::vector<SynFlatBuffers::CompactPose> merged;
+    const std::vector<SynFlatBuffers::CompactPose>* quantized = &m_poses;
+
+    if (!m_delta) {
+        keyframe = *this;
+    } else {
+        // A delta frame can only be decoded against the keyframe it refers to
+        if (keyframe.m_delta || keyframe.m_keyframe != m_keyframe || m_indices.size() != m_poses.size())
+            return false;
+        merged = keyframe.m_poses;
+        for (size_t k = 0; k < m_indices.size(); k++) {
+            if (m_indices[k] >= merged.size())
+                return false;
+            merged[m_indices[k]] = m_poses[k];
+        }
+        quantized = &merged;
+    }
+
+    poses.clear();
+    poses.reserve(quantized->size());
+    for (const auto& pose : *quantized)
+        poses.push_back(DequantizePose(ref, pose, m_resolution));
+
+    return true;
+}
+
+flatbuffers::Offset<SynFlatBuffers::CompactPoses> SynCompactPoses::ToFlatBuffers(
+    flatbuffers::FlatBufferBuilder& builder) const {
+    return SynFlatBuffers::CreateCompactPosesDirect(builder, m_resolution, m_keyframe, m_delta, &m_indices, &m_poses);
+}
+
 }  // namespace synchrono
 }  // namespace chrono
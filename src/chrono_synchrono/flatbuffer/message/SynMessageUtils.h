@@ -54,11 +54,75 @@ class SYN_API SynPose {
     flatbuffers::Offset<SynFlatBuffers::Pose> ToFlatBuffers(flatbuffers::FlatBufferBuilder& builder) const;
 
     ChFrameMoving<>& GetFrame() { return m_frame; }
+    const ChFrameMoving<>& GetFrame() const { return m_frame; }
 
   private:
     ChFrameMoving<> m_frame;
 };
 
+/// Compact encoding of a set of poses (e.g. the wheels or track components of a vehicle).
+/// Poses are expressed relative to a reference frame (typically the chassis frame) and quantized: positions to a
+/// multiple of the specified resolution (as 16 bit integers, so the positions relative to the reference frame must be
+/// within +/- 32767 * resolution) and orientations to 16 bits per quaternion component. Velocities and accelerations
+/// are not encoded.
+///
+/// A set can be a keyframe, which contains all poses, or a delta frame, which only contains the poses that changed
+/// (after quantization) since a given keyframe. Both sender and receiver keep the last keyframe: the sender encodes
+/// delta frames against it and the receiver needs it to decode them. A delta frame received without the corresponding
+/// keyframe (e.g. if the keyframe was missed) cannot be decoded; it is ignored until the next keyframe arrives.
+class SYN_API SynCompactPoses {
+  public:
+    SynCompactPoses();
+
+    ///@brief Construct from a FlatBuffers compact poses object
+    ///
+    SynCompactPoses(const SynFlatBuffers::CompactPoses* poses);
+
+    ///@brief Encode the given poses relative to the reference frame.
+    /// A keyframe is generated if requested or if the number of poses changed; in that case, it is also stored in the
+    /// provided keyframe. Otherwise, a delta frame against the provided keyframe is generated.
+    ///
+    ///@param ref the reference frame
+    ///@param poses the poses to encode (in the absolute frame)
+    ///@param resolution the quantization step for positions
+    ///@param keyframe the last keyframe generated by the sender
+    ///@param force_keyframe if true, always generate a keyframe
+    void Encode(const ChFrame<>& ref,
+                const std::vector<SynPose>& poses,
+                double resolution,
+                SynCompactPoses& keyframe,
+                bool force_keyframe);
+
+    ///@brief Decode the poses relative to the reference frame.
+    /// If this is a keyframe, it is also stored in the provided keyframe. Otherwise, it is decoded against the
+    /// provided keyframe, which must be the keyframe this delta frame refers to.
+    ///
+    ///@param ref the reference frame
+    ///@param keyframe the last keyframe received from the sender
+    ///@param poses the decoded poses (in the absolute frame)
+    ///@return false if a delta frame could not be decoded (keyframe not available)
+    bool Decode(const ChFrame<>& ref, SynCompactPoses& keyframe, std::vector<SynPose>& poses) const;
+
+    ///@brief Convert this object to a flatbuffers compact poses type
+    ///
+    flatbuffers::Offset<SynFlatBuffers::CompactPoses> ToFlatBuffers(flatbuffers::FlatBufferBuilder& builder) const;
+
+    ///@brief Check if this set is a keyframe
+    ///
+    bool IsKeyframe() const { return !m_delta; }
+
+    ///@brief Get the number of poses included in this set
+    ///
+    size_t GetNumPoses() const { return m_poses.size(); }
+
+  private:
+    double m_resolution;                               ///< quantization step for positions
+    unsigned int m_keyframe;                           ///< id of the (reference) keyframe
+    bool m_delta;                                      ///< true for a delta frame
+    std::vector<uint16_t> m_indices;                   ///< indices of included poses (delta frame only)
+    std::vector<SynFlatBuffers::CompactPose> m_poses;  ///< quantized poses
+};
+
 /// @} synchrono_flatbuffer
 
 }  // namespace synchrono
@@ -22,6 +22,8 @@
 
 #include "chrono_vehicle/utils/ChUtilsJSON.h"
 
+#include <algorithm>
+
 namespace chrono {
 namespace synchrono {
 
@@ -29,7 +31,12 @@ namespace Agent = SynFlatBuffers::Agent;
 namespace TrackedVehicle = SynFlatBuffers::Agent::TrackedVehicle;
 
 SynTrackedVehicleStateMessage::SynTrackedVehicleStateMessage(unsigned int source_id, unsigned int destination_id)
-    : SynMessage(source_id, destination_id) {}
+    : SynMessage(source_id, destination_id),
+      has_compact(false),
+      m_compact_encoding(false),
+      m_compact_resolution(1e-3),
+      m_keyframe_interval(10),
+      m_num_frames(0) {}
 
 void SynTrackedVehicleStateMessage::SetState(double time,
                                              SynPose chassis,
@@ -43,6 +50,27 @@ void SynTrackedVehicleStateMessage::SetState(double time,
     this->sprockets = sprockets;
     this->idlers = idlers;
     this->road_wheels = road_wheels;
+
+    if (m_compact_encoding) {
+        std::vector<SynPose> poses;
+        poses.reserve(track_shoes.size() + sprockets.size() + idlers.size() + road_wheels.size());
+        poses.insert(poses.end(), track_shoes.begin(), track_shoes.end());
+        poses.insert(poses.end(), sprockets.begin(), sprockets.end());
+        poses.insert(poses.end(), idlers.begin(), idlers.end());
+        poses.insert(poses.end(), road_wheels.begin(), road_wheels.end());
+
+        compact.Encode(chassis.GetFrame(), poses, m_compact_resolution, m_last_keyframe,
+                       m_num_frames % m_keyframe_interval == 0);
+        m_num_frames++;
+    }
+    has_compact = m_compact_encoding;
+}
+
+void SynTrackedVehicleStateMessage::EnableCompactEncoding(bool val, double resolution, int keyframe_interval) {
+    m_compact_encoding = val;
+    m_compact_resolution = resolution;
+    m_keyframe_interval = std::max(keyframe_interval, 1);
+    m_num_frames = 0;
 }
 
 void SynTrackedVehicleStateMessage::ConvertFromFlatBuffers(const SynFlatBuffers::Message* message) {
@@ -59,18 +87,25 @@ void SynTrackedVehicleStateMessage::ConvertFromFlatBuffers(const SynFlatBuffers:
     this->chassis = SynPose(state->chassis());
 
     this->track_shoes.clear();
+    this->sprockets.clear();
+    this->idlers.clear();
+    this->road_wheels.clear();
+
+    this->has_compact = state->compact() != nullptr;
+    if (this->has_compact) {
+        this->compact = SynCompactPoses(state->compact());
+        return;
+    }
+
     for (auto track_shoe : (*state->track_shoes()))
         this->track_shoes.emplace_back(track_shoe);
 
-    this->sprockets.clear();
     for (auto sprocket : (*state->sprockets()))
         this->sprockets.emplace_back(sprocket);
 
-    this->idlers.clear();
     for (auto idler : (*state->idlers()))
         this->idlers.emplace_back(idler);
 
-    this->road_wheels.clear();
     for (auto road_wheel : (*state->road_wheels()))
         this->road_wheels.emplace_back(road_wheel);
 }
@@ -79,6 +114,19 @@ void SynTrackedVehicleStateMessage::ConvertFromFlatBuffers(const SynFlatBuffers:
 FlatBufferMessage SynTrackedVehicleStateMessage::ConvertToFlatBuffers(flatbuffers::FlatBufferBuilder& builder) const {
     auto chassis = this->chassis.ToFlatBuffers(builder);
 
+    // With the compact encoding, the full component poses are not sent
+    if (has_compact) {
+        auto vehicle_state = TrackedVehicle::CreateStateDirect(builder, this->time, chassis,  //
+                                                               nullptr, nullptr, nullptr, nullptr,
+                                                               compact.ToFlatBuffers(builder));
+
+        auto flatbuffer_state = Agent::CreateState(builder, Agent::Type_TrackedVehicle_State, vehicle_state.Union());
+        return SynFlatBuffers::CreateMessage(builder,                           //
+                                             SynFlatBuffers::Type_Agent_State,  //
+                                             flatbuffer_state.Union(),          //
+                                             m_source_id, m_destination_id);    //
+    }
+
     std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> track_shoes;
     track_shoes.reserve(this->track_shoes.size());
     for (const auto& track_shoe : this->track_shoes)
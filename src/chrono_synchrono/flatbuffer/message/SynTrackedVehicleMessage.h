@@ -69,6 +69,16 @@ class SynTrackedVehicleStateMessage : public SynMessage {
                   std::vector<SynPose> idlers,
                   std::vector<SynPose> road_wheels);
 
+    ///@brief Enable the compact encoding of the track component poses (default: false)
+    /// If enabled, the poses of the track shoes, sprockets, idlers and road wheels are sent quantized relative to the
+    /// chassis, as keyframes every keyframe_interval messages and as delta frames against the last keyframe in between
+    /// (see SynCompactPoses).
+    ///
+    ///@param val whether the compact encoding is used
+    ///@param resolution quantization step for the component positions relative to the chassis
+    ///@param keyframe_interval number of messages between keyframes
+    void EnableCompactEncoding(bool val, double resolution = 1e-3, int keyframe_interval = 10);
+
     // -------------------------------------------------------------------------------
 
     SynPose chassis;                   ///< vehicle's chassis pose
@@ -76,6 +86,18 @@ class SynTrackedVehicleStateMessage : public SynMessage {
     std::vector<SynPose> sprockets;    ///< vector of vehicle's sprockets
     std::vector<SynPose> idlers;       ///< vector of vehicle's idlers
     std::vector<SynPose> road_wheels;  ///< vector of vehicle's road wheels
+
+    /// If the compact encoding is used, the component vectors of a received message are empty and the poses of the
+    /// track shoes, sprockets, idlers and road wheels (in this order) are available in compact form only.
+    bool has_compact;         ///< whether the component poses are encoded in compact form
+    SynCompactPoses compact;  ///< compact encoding of the component poses
+
+  private:
+    bool m_compact_encoding;          ///< use the compact encoding when sending
+    double m_compact_resolution;      ///< quantization step for positions
+    int m_keyframe_interval;          ///< number of messages between keyframes
+    int m_num_frames;                 ///< number of encoded messages
+    SynCompactPoses m_last_keyframe;  ///< last keyframe sent
 };
 
 /// Description class that holds description information for a SynTrackedVehicle
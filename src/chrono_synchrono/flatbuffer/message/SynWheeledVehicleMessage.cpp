@@ -22,6 +22,8 @@
 
 #include "chrono_vehicle/utils/ChUtilsJSON.h"
 
+#include <algorithm>
+
 namespace chrono {
 namespace synchrono {
 
@@ -29,12 +31,31 @@ namespace Agent = SynFlatBuffers::Agent;
 namespace WheeledVehicle = SynFlatBuffers::Agent::WheeledVehicle;
 
 SynWheeledVehicleStateMessage::SynWheeledVehicleStateMessage(unsigned int source_id, unsigned int destination_id)
-    : SynMessage(source_id, destination_id) {}
+    : SynMessage(source_id, destination_id),
+      has_compact(false),
+      m_compact_encoding(false),
+      m_compact_resolution(1e-3),
+      m_keyframe_interval(10),
+      m_num_frames(0) {}
 
 void SynWheeledVehicleStateMessage::SetState(double time, SynPose chassis, std::vector<SynPose> wheels) {
     this->time = time;
     this->chassis = chassis;
     this->wheels = wheels;
+
+    if (m_compact_encoding) {
+        compact.Encode(chassis.GetFrame(), wheels, m_compact_resolution, m_last_keyframe,
+                       m_num_frames % m_keyframe_interval == 0);
+        m_num_frames++;
+    }
+    has_compact = m_compact_encoding;
+}
+
+void SynWheeledVehicleStateMessage::EnableCompactEncoding(bool val, double resolution, int keyframe_interval) {
+    m_compact_encoding = val;
+    m_compact_resolution = resolution;
+    m_keyframe_interval = std::max(keyframe_interval, 1);
+    m_num_frames = 0;
 }
 
 void SynWheeledVehicleStateMessage::ConvertFromFlatBuffers(const SynFlatBuffers::Message* message) {
@@ -52,24 +73,37 @@ void SynWheeledVehicleStateMessage::ConvertFromFlatBuffers(const SynFlatBuffers:
     chassis = SynPose(state->chassis());
 
     wheels.clear();
-    for (auto wheel : (*state->wheels()))
-        wheels.emplace_back(wheel);
+    if (state->wheels()) {
+        for (auto wheel : (*state->wheels()))
+            wheels.emplace_back(wheel);
+    }
+
+    has_compact = state->compact() != nullptr;
+    if (has_compact)
+        compact = SynCompactPoses(state->compact());
 }
 
 /// Generate FlatBuffers message from this message's state
 FlatBufferMessage SynWheeledVehicleStateMessage::ConvertToFlatBuffers(flatbuffers::FlatBufferBuilder& builder) const {
     auto flatbuffer_chassis = this->chassis.ToFlatBuffers(builder);
 
+    // With the compact encoding, the full wheel poses are not sent
     std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> flatbuffer_wheels;
-    flatbuffer_wheels.reserve(this->wheels.size());
-    for (const auto& wheel : this->wheels)
-        flatbuffer_wheels.push_back(wheel.ToFlatBuffers(builder));
+    flatbuffers::Offset<SynFlatBuffers::CompactPoses> flatbuffer_compact = 0;
+    if (has_compact) {
+        flatbuffer_compact = compact.ToFlatBuffers(builder);
+    } else {
+        flatbuffer_wheels.reserve(this->wheels.size());
+        for (const auto& wheel : this->wheels)
+            flatbuffer_wheels.push_back(wheel.ToFlatBuffers(builder));
+    }
 
     auto vehicle_type = Agent::Type_WheeledVehicle_State;
-    auto vehicle_state = WheeledVehicle::CreateStateDirect(builder,             //
-                                                           this->time,          //
-                                                           flatbuffer_chassis,  //
-                                                           &flatbuffer_wheels)
+    auto vehicle_state = WheeledVehicle::CreateStateDirect(builder,                                     //
+                                                           this->time,                                  //
+                                                           flatbuffer_chassis,                          //
+                                                           has_compact ? nullptr : &flatbuffer_wheels,  //
+                                                           flatbuffer_compact)
                              .Union();
 
     auto flatbuffer_state = Agent::CreateState(builder, vehicle_type, vehicle_state);
@@ -61,10 +61,29 @@ class SYN_API SynWheeledVehicleStateMessage : public SynMessage {
     ///@param wheels vector of the vehicle's wheel poses
     void SetState(double time, SynPose chassis, std::vector<SynPose> wheels);
 
+    ///@brief Enable the compact encoding of the wheel poses (default: false)
+    /// If enabled, wheel poses are sent quantized relative to the chassis, as keyframes every keyframe_interval
+    /// messages and as delta frames against the last keyframe in between (see SynCompactPoses).
+    ///
+    ///@param val whether the compact encoding is used
+    ///@param resolution quantization step for the wheel positions relative to the chassis
+    ///@param keyframe_interval number of messages between keyframes
+    void EnableCompactEncoding(bool val, double resolution = 1e-3, int keyframe_interval = 10);
+
     // -------------------------------------------------------------------------------
 
     SynPose chassis;              ///< vehicle's chassis pose
-    std::vector<SynPose> wheels;  ///< vector of vehicle's wheels
+    std::vector<SynPose> wheels;  ///< vector of vehicle's wheels (empty if the compact encoding is used)
+
+    bool has_compact;         ///< whether the wheel poses are encoded in compact form
+    SynCompactPoses compact;  ///< compact encoding of the wheel poses
+
+  private:
+    bool m_compact_encoding;          ///< use the compact encoding when sending
+    double m_compact_resolution;      ///< quantization step for positions
+    int m_keyframe_interval;          ///< number of messages between keyframes
+    int m_num_frames;                 ///< number of encoded messages
+    SynCompactPoses m_last_keyframe;  ///< last keyframe sent
 };
 
 // ------------------------------------------------------------------------------------
@@ -22,6 +22,7 @@
 
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 #include "chrono_vehicle/ChWorldFrame.h"
 #include "chrono_vehicle/ChVehicle.h"
@@ -113,6 +114,7 @@ void ChVehicle::SetOutput(ChVehicleOutput::Type type,
 // Advance the state of the system.
 // ---------------------------------------------------------------------------- -
 void ChVehicle::Advance(double step) {
+    CH_TRACE_ZONE("ChVehicle::Advance");
     if (m_output && m_system->GetChTime() >= m_next_output_time) {
         Output(m_output_frame, *m_output_db);
         m_next_output_time += m_output_step;
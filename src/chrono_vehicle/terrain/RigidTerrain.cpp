@@ -279,7 +279,7 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChMa
                                                             double hMax,
                                                             double sweep_sphere_radius,
                                                             bool visualization) {
-    auto patch = chrono_types::make_shared<MeshPatch>();
+    auto patch = chrono_types::make_shared<HeightFieldPatch>();
     AddPatch(patch, position, material);
 
     // Read the image file (request only 1 channel) and extract number of pixels.
@@ -317,6 +317,9 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChMa
     // Initialize the array of accumulators (number of adjacent faces to a vertex)
     std::vector<int> accumulators(n_verts, 0);
 
+    // Vertex heights, in the same order as the mesh vertices
+    std::vector<double> heights(n_verts);
+
     // Readability aliases
     std::vector<ChVector<> >& vertices = patch->m_trimesh->getCoordsVertices();
     std::vector<ChVector<> >& normals = patch->m_trimesh->getCoordsNormals();
@@ -334,6 +337,7 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChMa
             double x = ix * dx - 0.5 * length;
             // Map gray level to vertex height
             double z = hMin + hmap.Gray(ix, iy) * h_scale;
+            heights[iv] = z;
             // Set vertex location
             vertices[iv] = ChWorldFrame::FromISO(ChVector<>(x, y, z));
             // Initialize vertex normal to (0, 0, 0).
@@ -383,11 +387,18 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChMa
         normals[in] = ChWorldFrame::FromISO(normals[in] / (double)accumulators[in]);
     }
 
+    // Create the height field (same grid and triangulation as the mesh, in an ISO frame).
+    patch->m_hfield = chrono_types::make_shared<geometry::ChHeightField>(nv_x, nv_y, length, width, heights);
+
     // Create contact geometry.
-    patch->m_body->GetCollisionModel()->ClearModel();
-    patch->m_body->GetCollisionModel()->AddTriangleMesh(material, patch->m_trimesh, true, false, VNULL, ChMatrix33<>(1),
-                                                        sweep_sphere_radius);
-    patch->m_body->GetCollisionModel()->BuildModel();
+    // Use the height field if supported by the collision system, otherwise fall back on the triangular mesh.
+    auto model = patch->m_body->GetCollisionModel();
+    model->ClearModel();
+    if (!model->AddHeightField(material, patch->m_hfield, VNULL, ChMatrix33<>(ChWorldFrame::Rotation().transpose()),
+                               sweep_sphere_radius)) {
+        model->AddTriangleMesh(material, patch->m_trimesh, true, false, VNULL, ChMatrix33<>(1), sweep_sphere_radius);
+    }
+    model->BuildModel();
 
     // Create the visualization asset.
     if (visualization) {
@@ -515,7 +526,8 @@ void RigidTerrain::Initialize() {
 // -----------------------------------------------------------------------------
 // Functions for obtaining the terrain height, normal, and coefficient of
 // friction  at the specified location.
-// This is done by casting vertical rays into each patch collision model.
+// This is done by casting vertical rays into each patch collision model (or,
+// for a height-map patch, directly into its height field).
 // -----------------------------------------------------------------------------
 double RigidTerrain::GetHeight(const ChVector<>& loc) const {
     double height;
@@ -599,6 +611,26 @@ bool RigidTerrain::MeshPatch::FindPoint(const ChVector<>& loc, double& height, C
     return result.hit;
 }
 
+bool RigidTerrain::HeightFieldPatch::FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const {
+    ChVector<> from = loc + (m_radius + 1000) * ChWorldFrame::Vertical();
+    ChVector<> to = loc - (m_radius + 1000) * ChWorldFrame::Vertical();
+
+    // Intersect the vertical ray with the height field, in the (ISO) frame of the height field.
+    // This only visits the grid cells below the given location.
+    ChVector<> from_loc = ChWorldFrame::ToISO(m_body->TransformPointParentToLocal(from));
+    ChVector<> to_loc = ChWorldFrame::ToISO(m_body->TransformPointParentToLocal(to));
+    ChVector<> point;
+    ChVector<> nrm;
+    double fraction;
+    if (!m_hfield->RayHit(from_loc, to_loc, point, nrm, fraction))
+        return false;
+
+    height = ChWorldFrame::Height(m_body->TransformPointLocalToParent(ChWorldFrame::FromISO(point)));
+    normal = m_body->TransformDirectionLocalToParent(ChWorldFrame::FromISO(nrm));
+
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // Export all patch meshes
 // -----------------------------------------------------------------------------
@@ -24,6 +24,7 @@
 
 #include "chrono/assets/ChColor.h"
 #include "chrono/assets/ChColorAsset.h"
+#include "chrono/geometry/ChHeightField.h"
 #include "chrono/geometry/ChTriangleMeshConnected.h"
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChSystem.h"
@@ -50,7 +51,7 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     enum class PatchType {
         BOX,        ///< rectangular box
         MESH,       ///< triangular mesh (from a Wavefront OBJ file)
-        HEIGHT_MAP  ///< triangular mesh (generated from a gray-scale BMP height-map)
+        HEIGHT_MAP  ///< height field (generated from a gray-scale BMP height-map)
     };
 
     /// Definition of a patch in a rigid terrain model.
@@ -124,6 +125,8 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
 
     /// Add a terrain patch represented by a height-field map.
     /// The height map is specified through a BMP gray-scale image.
+    /// The patch uses a height-field contact shape (if supported by the collision system; otherwise, a triangular mesh)
+    /// and a triangular mesh for visualization. Height and normal queries on this patch use the height field directly.
     std::shared_ptr<Patch> AddPatch(
         std::shared_ptr<ChMaterialSurface> material,  ///< [in] contact material
         const ChCoordsys<>& position,                 ///< [in] patch location and orientation
@@ -203,6 +206,12 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         virtual void ExportMeshWavefront(const std::string& out_dir) override;
     };
 
+    /// Patch represented as a height field (with a mesh for visualization).
+    struct CH_VEHICLE_API HeightFieldPatch : public MeshPatch {
+        std::shared_ptr<geometry::ChHeightField> m_hfield;  ///< associated height field (in ISO frame)
+        virtual bool FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const override;
+    };
+
     ChSystem* m_system;
     int m_num_patches;
     std::vector<std::shared_ptr<Patch>> m_patches;
@@ -17,10 +17,12 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 #include <limits>
 #include <queue>
+#include <string>
 #include <unordered_set>
 
 #include "chrono_vehicle/cuda/hello.cuh"
@@ -30,9 +32,11 @@
 
 #include "chrono/assets/ChBoxShape.h"
 #include "chrono/assets/ChTexture.h"
+#include "chrono/parallel/ChOpenMP.h"
 #include "chrono/physics/ChMaterialSurfaceNSC.h"
 #include "chrono/physics/ChMaterialSurfaceSMC.h"
 #include "chrono/utils/ChConvexHull.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 #include "chrono_vehicle/ChVehicleModelData.h"
 #include "chrono_vehicle/terrain/SCMDeformableTerrain.h"
@@ -172,6 +176,11 @@ void SCMDeformableTerrain::SetBulldozingParameters(
   m_ground->m_erosion_propagations = erosion_propagations;
 }
 
+// Enable/disable analytic ray casting for the moving patch bodies.
+void SCMDeformableTerrain::EnableAnalyticRayCasting(bool val) {
+  m_ground->m_analytic_raycast = val;
+}
+
 void SCMDeformableTerrain::SetTestHeight(double offset) {
   m_ground->m_test_offset_up = offset;
 }
@@ -385,6 +394,7 @@ SCMDeformableSoil::SCMDeformableSoil(ChSystem *system, bool visualization_mesh)
   m_test_offset_down = 0.5;
 
   m_moving_patch = false;
+  m_analytic_raycast = false;
 }
 
 // Initialize the terrain as a flat grid
@@ -725,10 +735,9 @@ ChVector<> SCMDeformableSoil::GetInitNormal(const ChVector2<int> &loc) const {
 // Get the terrain height (relative to the SCM plane) at the specified grid
 // vertex.
 double SCMDeformableSoil::GetHeight(const ChVector2<int> &loc) const {
-  // First query the hash-map
-  auto p = m_grid_map.find(loc);
-  if (p != m_grid_map.end())
-    return p->second.level;
+  // First query the grid of modified nodes
+  if (auto nr = m_grid_map.Find(loc))
+    return nr->level;
 
   // Else return undeformed height
   return GetInitHeight(loc);
@@ -936,6 +945,384 @@ bool SCMDeformableSoil::RayOBBtest(const MovingPatchInfo &p,
   return true;
 }
 
+// -----------------------------------------------------------------------------
+// Implementation of the tiled storage for grid node records
+// -----------------------------------------------------------------------------
+
+SCMDeformableSoil::NodeGrid::Tile *
+SCMDeformableSoil::NodeGrid::GetTile(const ChVector2<int> &loc, int &index,
+                                     bool create) {
+  // Note: arithmetic shift provides floor division also for negative indices
+  ChVector2<int> key(loc.x() >> tile_bits, loc.y() >> tile_bits);
+  index = (loc.x() & tile_mask) + ((loc.y() & tile_mask) << tile_bits);
+
+  auto t = m_tiles.find(key);
+  if (t != m_tiles.end())
+    return t->second.get();
+  if (!create)
+    return nullptr;
+  Tile *tile = new Tile;
+  m_tiles.insert(std::make_pair(key, std::unique_ptr<Tile>(tile)));
+  return tile;
+}
+
+const SCMDeformableSoil::NodeGrid::Tile *
+SCMDeformableSoil::NodeGrid::GetTile(const ChVector2<int> &loc,
+                                     int &index) const {
+  ChVector2<int> key(loc.x() >> tile_bits, loc.y() >> tile_bits);
+  index = (loc.x() & tile_mask) + ((loc.y() & tile_mask) << tile_bits);
+
+  auto t = m_tiles.find(key);
+  return (t != m_tiles.end()) ? t->second.get() : nullptr;
+}
+
+SCMDeformableSoil::NodeRecord *
+SCMDeformableSoil::NodeGrid::Find(const ChVector2<int> &loc) {
+  int index;
+  Tile *tile = GetTile(loc, index, false);
+  if (!tile || !tile->used[index])
+    return nullptr;
+  return &tile->records[index];
+}
+
+const SCMDeformableSoil::NodeRecord *
+SCMDeformableSoil::NodeGrid::Find(const ChVector2<int> &loc) const {
+  int index;
+  const Tile *tile = GetTile(loc, index);
+  if (!tile || !tile->used[index])
+    return nullptr;
+  return &tile->records[index];
+}
+
+SCMDeformableSoil::NodeRecord &
+SCMDeformableSoil::NodeGrid::Get(const ChVector2<int> &loc) {
+  NodeRecord *nr = Find(loc);
+  if (!nr)
+    throw ChException("SCM grid node (" + std::to_string(loc.x()) + ", " +
+                      std::to_string(loc.y()) + ") was not recorded");
+  return *nr;
+}
+
+const SCMDeformableSoil::NodeRecord &
+SCMDeformableSoil::NodeGrid::Get(const ChVector2<int> &loc) const {
+  const NodeRecord *nr = Find(loc);
+  if (!nr)
+    throw ChException("SCM grid node (" + std::to_string(loc.x()) + ", " +
+                      std::to_string(loc.y()) + ") was not recorded");
+  return *nr;
+}
+
+SCMDeformableSoil::NodeRecord &
+SCMDeformableSoil::NodeGrid::Insert(const ChVector2<int> &loc,
+                                    const NodeRecord &nr) {
+  int index;
+  Tile *tile = GetTile(loc, index, true);
+  if (!tile->used[index]) {
+    tile->records[index] = nr;
+    tile->used[index] = true;
+    m_num_nodes++;
+  }
+  return tile->records[index];
+}
+
+SCMDeformableSoil::NodeRecord &
+SCMDeformableSoil::NodeGrid::Set(const ChVector2<int> &loc,
+                                 const NodeRecord &nr) {
+  int index;
+  Tile *tile = GetTile(loc, index, true);
+  if (!tile->used[index]) {
+    tile->used[index] = true;
+    m_num_nodes++;
+  }
+  tile->records[index] = nr;
+  return tile->records[index];
+}
+
+// -----------------------------------------------------------------------------
+// Implementation of the analytic ray caster
+// -----------------------------------------------------------------------------
+
+static ChVector<> ComponentMin(const ChVector<> &a, const ChVector<> &b) {
+  return ChVector<>(std::min(a.x(), b.x()), std::min(a.y(), b.y()),
+                    std::min(a.z(), b.z()));
+}
+
+static ChVector<> ComponentMax(const ChVector<> &a, const ChVector<> &b) {
+  return ChVector<>(std::max(a.x(), b.x()), std::max(a.y(), b.y()),
+                    std::max(a.z(), b.z()));
+}
+
+// Collect the collision shapes of all moving patch bodies and build the BVH.
+bool SCMDeformableSoil::RayCaster::Update(
+    const std::vector<MovingPatchInfo> &patches, const ChCoordsys<> &plane) {
+  m_shapes.clear();
+  m_nodes.clear();
+
+  for (const auto &p : patches) {
+    // Bodies with disabled collision are not present in the collision system
+    if (!p.m_body->GetCollide())
+      continue;
+
+    auto model = p.m_body->GetCollisionModel();
+    ChCoordsys<> csys = model->GetContactable()->GetCsysForCollisionModel();
+
+    for (int index = 0; index < model->GetNumShapes(); index++) {
+      // Dimensions as specified when the shape was added (without envelope)
+      const std::vector<double> &dims = model->GetShape(index)->GetDimensions();
+      if (dims.empty())
+        return false;
+
+      Shape shape;
+      shape.contactable = model->GetContactable();
+      switch (model->GetShape(index)->GetType()) {
+      case collision::ChCollisionShape::Type::SPHERE:
+        shape.type = ShapeType::SPHERE;
+        shape.dims = ChVector<>(dims[0]);
+        break;
+      case collision::ChCollisionShape::Type::BOX:
+        shape.type = ShapeType::BOX;
+        shape.dims = ChVector<>(dims[0], dims[1], dims[2]);
+        break;
+      case collision::ChCollisionShape::Type::CYLINDER:
+        // Cylinder axis along the shape Y axis
+        shape.type = ShapeType::CYLINDER;
+        shape.dims = ChVector<>(dims[0], dims[2], dims[1]);
+        break;
+      case collision::ChCollisionShape::Type::CYLSHELL:
+        // A ray cast into the collision system treats the shell as a solid
+        shape.type = ShapeType::CYLINDER;
+        shape.dims = ChVector<>(dims[0], dims[1], dims[0]);
+        break;
+      default:
+        return false;
+      }
+
+      // Express the shape frame in the SCM frame
+      ChCoordsys<> shape_csys = model->GetShapePos(index);
+      ChVector<> abs_pos = csys.TransformPointLocalToParent(shape_csys.pos);
+      ChQuaternion<> abs_rot = csys.rot * shape_csys.rot;
+      shape.pos = plane.TransformPointParentToLocal(abs_pos);
+      shape.rot = ChMatrix33<>(plane.rot.GetConjugate() * abs_rot);
+
+      // Bounding box in SCM frame
+      ChVector<> ext = shape.dims;
+      if (shape.type != ShapeType::SPHERE) {
+        const auto &R = shape.rot;
+        ext = ChVector<>(std::abs(R(0, 0)) * shape.dims.x() +
+                             std::abs(R(0, 1)) * shape.dims.y() +
+                             std::abs(R(0, 2)) * shape.dims.z(),
+                         std::abs(R(1, 0)) * shape.dims.x() +
+                             std::abs(R(1, 1)) * shape.dims.y() +
+                             std::abs(R(1, 2)) * shape.dims.z(),
+                         std::abs(R(2, 0)) * shape.dims.x() +
+                             std::abs(R(2, 1)) * shape.dims.y() +
+                             std::abs(R(2, 2)) * shape.dims.z());
+      }
+      shape.aabb_min = shape.pos - ext;
+      shape.aabb_max = shape.pos + ext;
+
+      m_shapes.push_back(shape);
+    }
+  }
+
+  if (!m_shapes.empty()) {
+    m_nodes.resize(1);
+    Build(0, 0, (int)m_shapes.size());
+  }
+
+  return true;
+}
+
+// Recursively build the BVH subtree for the given range of shapes, splitting
+// at the median shape center along the longest horizontal extent.
+void SCMDeformableSoil::RayCaster::Build(int node, int first, int count) {
+  ChVector<> aabb_min(+std::numeric_limits<double>::max());
+  ChVector<> aabb_max(-std::numeric_limits<double>::max());
+  ChVector<> c_min(+std::numeric_limits<double>::max());
+  ChVector<> c_max(-std::numeric_limits<double>::max());
+  for (int i = first; i < first + count; i++) {
+    aabb_min = ComponentMin(aabb_min, m_shapes[i].aabb_min);
+    aabb_max = ComponentMax(aabb_max, m_shapes[i].aabb_max);
+    c_min = ComponentMin(c_min, m_shapes[i].pos);
+    c_max = ComponentMax(c_max, m_shapes[i].pos);
+  }
+
+  m_nodes[node].aabb_min = aabb_min;
+  m_nodes[node].aabb_max = aabb_max;
+
+  if (count <= 2) {
+    m_nodes[node].child = -1;
+    m_nodes[node].first_shape = first;
+    m_nodes[node].num_shapes = count;
+    return;
+  }
+
+  int axis = (c_max.x() - c_min.x() >= c_max.y() - c_min.y()) ? 0 : 1;
+  int half = count / 2;
+  std::nth_element(m_shapes.begin() + first, m_shapes.begin() + first + half,
+                   m_shapes.begin() + first + count,
+                   [axis](const Shape &a, const Shape &b) {
+                     return a.pos[axis] < b.pos[axis];
+                   });
+
+  // Note: resizing the node list invalidates references to existing nodes
+  int child = (int)m_nodes.size();
+  m_nodes.resize(child + 2);
+  m_nodes[node].child = child;
+  m_nodes[node].first_shape = first;
+  m_nodes[node].num_shapes = 0;
+
+  Build(child, first, half);
+  Build(child + 1, first + half, count - half);
+}
+
+// Intersect a batch of rays with the collision shapes, traversing the BVH once
+// for the bounding box of the batch.
+void SCMDeformableSoil::RayCaster::Cast(RayBatch &batch, double length) const {
+  // Pad the batch with copies of the first ray and initialize the results
+  for (int i = batch.n; i < batch_size; i++) {
+    batch.x[i] = batch.x[0];
+    batch.y[i] = batch.y[0];
+    batch.z[i] = batch.z[0];
+  }
+  for (int i = 0; i < batch_size; i++) {
+    batch.t[i] = std::numeric_limits<double>::infinity();
+    batch.contactable[i] = nullptr;
+  }
+
+  if (m_nodes.empty())
+    return;
+
+  // Bounding box of all ray segments in the batch
+  ChVector<> b_min(batch.x[0], batch.y[0], batch.z[0]);
+  ChVector<> b_max(batch.x[0], batch.y[0], batch.z[0]);
+  for (int i = 1; i < batch.n; i++) {
+    b_min = ComponentMin(b_min, ChVector<>(batch.x[i], batch.y[i], batch.z[i]));
+    b_max = ComponentMax(b_max, ChVector<>(batch.x[i], batch.y[i], batch.z[i]));
+  }
+  b_max.z() += length;
+
+  int stack[64];
+  int top = 0;
+  stack[top++] = 0;
+  while (top > 0) {
+    const Node &node = m_nodes[stack[--top]];
+    if (node.aabb_min.x() > b_max.x() || node.aabb_max.x() < b_min.x() ||
+        node.aabb_min.y() > b_max.y() || node.aabb_max.y() < b_min.y() ||
+        node.aabb_min.z() > b_max.z() || node.aabb_max.z() < b_min.z())
+      continue;
+    if (node.num_shapes > 0) {
+      for (int i = node.first_shape; i < node.first_shape + node.num_shapes;
+           i++)
+        Intersect(m_shapes[i], batch, length);
+    } else {
+      stack[top++] = node.child;
+      stack[top++] = node.child + 1;
+    }
+  }
+}
+
+// Intersect a batch of vertical rays with a collision shape.
+// For each ray, the entry and exit distances are calculated without branching,
+// then the closest hit in the batch is updated.
+void SCMDeformableSoil::RayCaster::Intersect(const Shape &shape,
+                                             RayBatch &batch,
+                                             double length) const {
+  const double inf = std::numeric_limits<double>::infinity();
+  double t_in[batch_size];
+  double t_out[batch_size];
+
+  // Ray origins relative to the shape center (in SCM frame)
+  double px[batch_size];
+  double py[batch_size];
+  double pz[batch_size];
+  for (int i = 0; i < batch_size; i++) {
+    px[i] = batch.x[i] - shape.pos.x();
+    py[i] = batch.y[i] - shape.pos.y();
+    pz[i] = batch.z[i] - shape.pos.z();
+  }
+
+  switch (shape.type) {
+  case ShapeType::SPHERE: {
+    double r2 = shape.dims.x() * shape.dims.x();
+    for (int i = 0; i < batch_size; i++) {
+      double disc = r2 - px[i] * px[i] - py[i] * py[i];
+      double s = std::sqrt(std::max(disc, 0.0));
+      t_in[i] = (disc >= 0) ? -pz[i] - s : inf;
+      t_out[i] = (disc >= 0) ? -pz[i] + s : -inf;
+    }
+    break;
+  }
+  case ShapeType::BOX: {
+    // Ray direction in shape frame is the last row of the rotation matrix.
+    // Use a large value for the inverse of a zero direction component (as in
+    // the ray-OBB test).
+    const auto &R = shape.rot;
+    double oo[3];
+    for (int j = 0; j < 3; j++)
+      oo[j] = (R(2, j) == 0) ? 1e10 : 1.0 / R(2, j);
+    for (int i = 0; i < batch_size; i++) {
+      double tmin = -inf;
+      double tmax = +inf;
+      for (int j = 0; j < 3; j++) {
+        double o = R(0, j) * px[i] + R(1, j) * py[i] + R(2, j) * pz[i];
+        double t1 = (-shape.dims[j] - o) * oo[j];
+        double t2 = (+shape.dims[j] - o) * oo[j];
+        tmin = std::max(tmin, std::min(t1, t2));
+        tmax = std::min(tmax, std::max(t1, t2));
+      }
+      t_in[i] = tmin;
+      t_out[i] = tmax;
+    }
+    break;
+  }
+  case ShapeType::CYLINDER: {
+    // Cylinder with axis along the shape Y axis and (possibly) elliptical
+    // cross-section; scale the X and Z shape directions to a unit circle.
+    const auto &R = shape.rot;
+    double ox = 1 / shape.dims.x();
+    double oz = 1 / shape.dims.z();
+    double dx = R(2, 0) * ox;
+    double dz = R(2, 2) * oz;
+    double ooy = (R(2, 1) == 0) ? 1e10 : 1.0 / R(2, 1);
+    double a = dx * dx + dz * dz;
+    bool axial = (a < 1e-12);  // ray parallel to cylinder axis
+    for (int i = 0; i < batch_size; i++) {
+      double cx = (R(0, 0) * px[i] + R(1, 0) * py[i] + R(2, 0) * pz[i]) * ox;
+      double cy = R(0, 1) * px[i] + R(1, 1) * py[i] + R(2, 1) * pz[i];
+      double cz = (R(0, 2) * px[i] + R(1, 2) * py[i] + R(2, 2) * pz[i]) * oz;
+      // Lateral surface
+      double b = cx * dx + cz * dz;
+      double c = cx * cx + cz * cz - 1;
+      double disc = b * b - a * c;
+      double s = std::sqrt(std::max(disc, 0.0));
+      double tc_in = axial ? (c <= 0 ? -inf : inf)
+                           : (disc >= 0 ? (-b - s) / a : inf);
+      double tc_out = axial ? (c <= 0 ? inf : -inf)
+                            : (disc >= 0 ? (-b + s) / a : -inf);
+      // End caps
+      double t1 = (-shape.dims.y() - cy) * ooy;
+      double t2 = (+shape.dims.y() - cy) * ooy;
+      t_in[i] = std::max(tc_in, std::min(t1, t2));
+      t_out[i] = std::min(tc_out, std::max(t1, t2));
+    }
+    break;
+  }
+  }
+
+  // Update the closest hits (a ray starting inside the shape hits at its
+  // origin)
+  for (int i = 0; i < batch_size; i++) {
+    double t = std::max(t_in[i], 0.0);
+    bool hit = (t_in[i] <= t_out[i]) && (t_out[i] >= 0) && (t <= length) &&
+               (t < batch.t[i]);
+    batch.t[i] = hit ? t : batch.t[i];
+    batch.contactable[i] = hit ? shape.contactable : batch.contactable[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 // Offsets for the 8 neighbors of a grid vertex
 static const std::vector<ChVector2<int>> neighbors8{
     ChVector2<int>(-1, -1), // SW
@@ -957,6 +1344,7 @@ static const std::vector<ChVector2<int>> neighbors4{
 
 // Reset the list of forces, and fills it with forces from a soil contact model.
 void SCMDeformableSoil::ComputeInternalForces() {
+  CH_TRACE_ZONE("SCMDeformableSoil::ComputeInternalForces");
 
   wrapper();
 
@@ -968,7 +1356,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
   // Reset quantities at grid nodes modified over previous step
   // (required for bulldozing effects and for proper visualization coloring)
   for (const auto &ij : m_modified_nodes) {
-    auto &nr = m_grid_map.at(ij);
+    auto &nr = m_grid_map.Get(ij);
     nr.sigma = 0;
     nr.sinkage_elastic = 0;
     nr.step_plastic_flow = 0;
@@ -1039,19 +1427,95 @@ void SCMDeformableSoil::ComputeInternalForces() {
 
   int nthreads = GetSystem()->GetNumThreadsChrono();
 
+  // Ray-cast hit at a grid node, as recorded by a worker thread
+  struct ThreadHitRecord {
+    ChVector2<int> ij; // grid node
+    double z;          // node height at time of ray casting
+    HitRecord record;  // hit information
+  };
+
+  // Per-thread hit buffers.
+  // The grid map is not modified during the parallel ray casting phase, so it
+  // serves as a read-only height snapshot and can be queried without
+  // synchronization. Each thread records its hits in its own buffer; new node
+  // records and hits are inserted after the loop, in thread order.
+  std::vector<std::vector<ThreadHitRecord>> thread_hits(nthreads);
+  int num_ray_casts = 0;
+
+  // Use the analytic ray caster if requested and if all collision shapes of
+  // the moving patch bodies are supported
+  bool analytic = m_moving_patch && m_analytic_raycast &&
+                  m_ray_caster.Update(m_patches, m_plane);
+  const int batch_size = RayCaster::batch_size;
+
   // Loop through all moving patches (user-defined or default one)
   for (auto &p : m_patches) {
+    if (analytic) {
+      // Loop through batches of consecutive vertices in the patch range
+      int num_batches = ((int)p.m_range.size() + batch_size - 1) / batch_size;
+#pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
+      for (int kb = 0; kb < num_batches; kb++) {
+        RayCaster::RayBatch batch;
+        ChVector2<int> batch_ij[batch_size];
+        double batch_z[batch_size];
+        batch.n = 0;
+
+        int k_end =
+            std::min((kb + 1) * batch_size, (int)p.m_range.size());
+        for (int k = kb * batch_size; k < k_end; k++) {
+          ChVector2<int> ij = p.m_range[k];
+
+          double x = ij.x() * m_delta;
+          double y = ij.y() * m_delta;
+          double z = GetHeight(ij);
+
+          // Ray-OBB test (quick rejection)
+          ChVector<> vertex_abs =
+              m_plane.TransformPointLocalToParent(ChVector<>(x, y, z));
+          ChVector<> from =
+              vertex_abs + m_Z * (m_test_offset_up - m_test_offset_down);
+          if (!RayOBBtest(p, from, m_Z))
+            continue;
+
+          // Add ray (expressed in the SCM frame) to the current batch
+          batch_ij[batch.n] = ij;
+          batch_z[batch.n] = z;
+          batch.x[batch.n] = x;
+          batch.y[batch.n] = y;
+          batch.z[batch.n] = z + m_test_offset_up - m_test_offset_down;
+          batch.n++;
+        }
+
+        if (batch.n == 0)
+          continue;
+
+        // Intersect the batch of rays with the patch collision shapes
+        m_ray_caster.Cast(batch, m_test_offset_down);
+        num_ray_casts += batch.n;
+
+        for (int i = 0; i < batch.n; i++) {
+          if (!batch.contactable[i])
+            continue;
+          ChVector<> hit_point(batch.x[i], batch.y[i], batch.z[i] + batch.t[i]);
+          HitRecord record = {batch.contactable[i],
+                              m_plane.TransformPointLocalToParent(hit_point),
+                              -1};
+          thread_hits[ChOMP::GetThreadNum()].push_back(
+              {batch_ij[i], batch_z[i], record});
+        }
+      }
+      continue;
+    }
+
     // Loop through all vertices in the patch range
-#pragma omp parallel for num_threads(nthreads)
+#pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
     for (int k = 0; k < p.m_range.size(); k++) {
       ChVector2<int> ij = p.m_range[k];
 
       // Move from (i, j) to (x, y, z) representation in the world frame
       double x = ij.x() * m_delta;
       double y = ij.y() * m_delta;
-      double z;
-#pragma omp critical(SCM_ray_casting)
-      z = GetHeight(ij);
+      double z = GetHeight(ij);
 
       ChVector<> vertex_abs =
           m_plane.TransformPointLocalToParent(ChVector<>(x, y, z));
@@ -1067,28 +1531,31 @@ void SCMDeformableSoil::ComputeInternalForces() {
 
       // Cast ray into collision system
       GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-#pragma omp atomic
-      m_num_ray_casts++;
+      num_ray_casts++;
 
       if (mrayhit_result.hit) {
-#pragma omp critical(SCM_ray_casting)
-        {
-          // If this is the first hit from this node, initialize the node record
-          if (m_grid_map.find(ij) == m_grid_map.end()) {
-            m_grid_map.insert(
-                std::make_pair(ij, NodeRecord(z, z, GetInitNormal(ij))));
-          }
-
-          // Add to our map of hits to process
-          HitRecord record = {mrayhit_result.hitModel->GetContactable(),
-                              mrayhit_result.abs_hitPoint, -1};
-          hits.insert(std::make_pair(ij, record));
-          m_num_ray_hits++;
-        }
+        HitRecord record = {mrayhit_result.hitModel->GetContactable(),
+                            mrayhit_result.abs_hitPoint, -1};
+        thread_hits[ChOMP::GetThreadNum()].push_back({ij, z, record});
       }
     }
   }
 
+  // Merge the per-thread hit buffers
+  for (const auto &buffer : thread_hits) {
+    for (const auto &h : buffer) {
+      // If this is the first hit from this node, initialize the node record
+      if (!m_grid_map.Find(h.ij))
+        m_grid_map.Insert(h.ij, NodeRecord(h.z, h.z, GetInitNormal(h.ij)));
+
+      // Add to our map of hits to process
+      hits.insert(std::make_pair(h.ij, h.record));
+      m_num_ray_hits++;
+    }
+  }
+
+  m_num_ray_casts = num_ray_casts;
+
   m_timer_ray_casting.stop();
 
   // --------------------
@@ -1194,7 +1661,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
   for (auto &h : hits) {
     ChVector2<> ij = h.first;
 
-    auto &nr = m_grid_map.at(ij); // node record
+    auto &nr = m_grid_map.Get(ij); // node record
     const double &ca =
         nr.normal
             .z(); // cosine of angle between local normal and SCM plane vertical
@@ -1370,7 +1837,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
       // boundary
       double tot_step_flow = 0;
       for (const auto &ij : p.nodes) {      // for each node in contact patch
-        const auto &nr = m_grid_map.at(ij); //   get node record
+        const auto &nr = m_grid_map.Get(ij); // get node record
         if (nr.sigma <= 0)                  //   if node not touched
           continue;                         //     skip (not in effective patch)
         tot_step_flow +=
@@ -1380,11 +1847,10 @@ void SCMDeformableSoil::ComputeInternalForces() {
               ij + neighbors4[k]; //     neighbor node coordinates
           ////if (!CheckMeshBounds(nbr_ij))                     //     if
           /// neighbor out of bounds /    continue; //       skip neighbor
-          if (m_grid_map.find(nbr_ij) ==
-              m_grid_map.end())        //     if neighbor not yet recorded
+          auto nbr_nr = m_grid_map.Find(nbr_ij);
+          if (!nbr_nr)                 //     if neighbor not yet recorded
             p_boundary.insert(nbr_ij); //       set neighbor as boundary
-          else if (m_grid_map.at(nbr_ij).sigma <=
-                   0)                  //     if neighbor not touched
+          else if (nbr_nr->sigma <= 0) //     if neighbor not touched
             p_boundary.insert(nbr_ij); //       set neighbor as boundary
         }
       }
@@ -1397,14 +1863,13 @@ void SCMDeformableSoil::ComputeInternalForces() {
       // with erosion)
       for (const auto &ij : p_boundary) {              // for each node in bndry
         m_modified_nodes.push_back(ij);                //   mark as modified
-        if (m_grid_map.find(ij) == m_grid_map.end()) { //   if not yet recorded
-          double z = GetInitHeight(ij);                //     undeformed height
-          const ChVector<> &n = GetInitNormal(ij);     //     terrain normal
-          m_grid_map.insert(std::make_pair(
-              ij, NodeRecord(z, z, n)));  //     add new node record
-          m_modified_nodes.push_back(ij); //     mark as modified
-        }                                 //
-        auto &nr = m_grid_map.at(ij);     //   node record
+        if (!m_grid_map.Find(ij)) {                   //   if not yet recorded
+          double z = GetInitHeight(ij);               //     undeformed height
+          const ChVector<> &n = GetInitNormal(ij);    //     terrain normal
+          m_grid_map.Insert(ij, NodeRecord(z, z, n)); //     add new node record
+          m_modified_nodes.push_back(ij);             //     mark as modified
+        }                                             //
+        auto &nr = m_grid_map.Get(ij);                //   node record
         nr.erosion = true;                //   add to erosion domain
         AddMaterialToNode(diff, nr);      //   add raise amount
       }
@@ -1432,20 +1897,19 @@ void SCMDeformableSoil::ComputeInternalForces() {
           ////if (!CheckMeshBounds(nbr_ij))                       //   if out of
           /// bounds /    continue;                                       //
           /// ignore neighbor
-          if (m_grid_map.find(nbr_ij) ==
-              m_grid_map.end()) { //   if neighbor not yet recorded
+          auto nbr_rec = m_grid_map.Find(nbr_ij);
+          if (!nbr_rec) { //   if neighbor not yet recorded
             double z = GetInitHeight(
                 nbr_ij); //     undeformed height at neighbor location
             const ChVector<> &n = GetInitNormal(
                 nbr_ij);            //     terrain normal at neighbor location
             NodeRecord nr(z, z, n); //     create new record
             nr.erosion = true;      //     include in erosion domain
-            m_grid_map.insert(
-                std::make_pair(nbr_ij, nr));    //     add new node record
+            m_grid_map.Insert(nbr_ij, nr);      //     add new node record
             front.insert(nbr_ij);               //     add neighbor to new front
             m_modified_nodes.push_back(nbr_ij); //     mark as modified
           } else { //   if neighbor previously recorded
-            NodeRecord &nr = m_grid_map.at(nbr_ij); //     get existing record
+            NodeRecord &nr = *nbr_rec;          //     get existing record
             if (!nr.erosion && nr.sigma <= 0) { //     if neighbor not touched
               nr.erosion = true;    //       include in erosion domain
               front.insert(nbr_ij); //       add neighbor to new front
@@ -1465,15 +1929,30 @@ void SCMDeformableSoil::ComputeInternalForces() {
     // (3) Erosion algorithm on domain
     m_timer_bulldozing_erosion.start();
 
+    // Cache the records of all nodes in the erosion domain and of their
+    // recorded neighbors (record addresses are stable in the node grid and no
+    // new nodes are recorded during erosion).
+    struct ErosionNode {
+      NodeRecord *nr;     // node record
+      NodeRecord *nbr[4]; // neighbor records (nullptr if not recorded)
+    };
+    std::vector<ErosionNode> erosion_nodes;
+    erosion_nodes.reserve(erosion_domain.size());
+    for (const auto &ij : erosion_domain) {
+      ErosionNode en;
+      en.nr = &m_grid_map.Get(ij);
+      for (int k = 0; k < 4; k++)
+        en.nbr[k] = m_grid_map.Find(ij + neighbors4[k]);
+      erosion_nodes.push_back(en);
+    }
+
     for (int iter = 0; iter < m_erosion_iterations; iter++) {
-      for (const auto &ij : erosion_domain) {
-        auto &nr = m_grid_map.at(ij);
+      for (auto &en : erosion_nodes) {
+        auto &nr = *en.nr;
         for (int k = 0; k < 4; k++) {
-          ChVector2<int> nbr_ij = ij + neighbors4[k];
-          auto rec = m_grid_map.find(nbr_ij);
-          if (rec == m_grid_map.end())
+          if (!en.nbr[k])
             continue;
-          auto &nbr_nr = rec->second;
+          auto &nbr_nr = *en.nbr[k];
 
           // (3.1) Flow remaining material to neighbor
           double diff = 0.5 * (nr.massremainder - nbr_nr.massremainder) /
@@ -1520,8 +1999,8 @@ void SCMDeformableSoil::ComputeInternalForces() {
     for (const auto &ij : m_modified_nodes) {
       if (!CheckMeshBounds(ij))           // if node outside mesh
         continue;                         //   do nothing
-      const auto &nr = m_grid_map.at(ij); // grid node record
-      int iv = GetMeshVertexIndex(ij);    // mesh vertex index
+      const auto &nr = m_grid_map.Get(ij); // grid node record
+      int iv = GetMeshVertexIndex(ij);     // mesh vertex index
       UpdateMeshVertexCoordinates(ij, iv,
                                   nr); // update vertex coordinates and color
       modified_vertices.push_back(
@@ -1663,14 +2142,14 @@ std::vector<SCMDeformableTerrain::NodeLevel>
 SCMDeformableSoil::GetModifiedNodes(bool all_nodes) const {
   std::vector<SCMDeformableTerrain::NodeLevel> nodes;
   if (all_nodes) {
-    for (const auto &nr : m_grid_map) {
-      nodes.push_back(std::make_pair(nr.first, nr.second.level));
-    }
+    nodes.reserve(m_grid_map.GetNumNodes());
+    m_grid_map.ForEach([&nodes](const ChVector2<int> &ij, const NodeRecord &nr) {
+      nodes.push_back(std::make_pair(ij, nr.level));
+    });
   } else {
     for (const auto &ij : m_modified_nodes) {
-      auto rec = m_grid_map.find(ij);
-      assert(rec != m_grid_map.end());
-      nodes.push_back(std::make_pair(ij, rec->second.level));
+      const auto &nr = m_grid_map.Get(ij);
+      nodes.push_back(std::make_pair(ij, nr.level));
     }
   }
   return nodes;
@@ -1684,8 +2163,8 @@ void SCMDeformableSoil::SetModifiedNodes(
     const std::vector<SCMDeformableTerrain::NodeLevel> &nodes) {
   for (const auto &n : nodes) {
     // Modify existing entry in grid map or insert new one
-    m_grid_map[n.first] = SCMDeformableSoil::NodeRecord(n.second, n.second,
-                                                        GetInitNormal(n.first));
+    m_grid_map.Set(n.first, SCMDeformableSoil::NodeRecord(
+                                n.second, n.second, GetInitNormal(n.first)));
   }
 
   // Update visualization
@@ -1694,8 +2173,8 @@ void SCMDeformableSoil::SetModifiedNodes(
       auto ij = n.first;                  // grid location
       if (!CheckMeshBounds(ij))           // if outside mesh
         continue;                         //   do nothing
-      const auto &nr = m_grid_map.at(ij); // grid node record
-      int iv = GetMeshVertexIndex(ij);    // mesh vertex index
+      const auto &nr = m_grid_map.Get(ij); // grid node record
+      int iv = GetMeshVertexIndex(ij);     // mesh vertex index
       UpdateMeshVertexCoordinates(ij, iv,
                                   nr); // update vertex coordinates and color
       if (!m_trimesh_shape->IsWireframe())        // if not in wireframe mode
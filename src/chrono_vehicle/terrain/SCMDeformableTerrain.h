@@ -20,9 +20,11 @@
 #ifndef SCM_DEFORMABLE_TERRAIN_H
 #define SCM_DEFORMABLE_TERRAIN_H
 
+#include <memory>
 #include <string>
 #include <ostream>
 #include <unordered_map>
+#include <vector>
 
 #include "chrono/assets/ChColorAsset.h"
 #include "chrono/assets/ChTriangleMeshShape.h"
@@ -144,6 +146,14 @@ class CH_VEHICLE_API SCMDeformableTerrain : public ChTerrain {
                         const ChVector<>& OOBB_dims     ///< [in] OOBB dimensions
     );
 
+    /// Enable/disable analytic ray casting (default: false).
+    /// If enabled, and if moving patches are defined, the vertical rays at the SCM grid nodes are intersected directly
+    /// with the collision shapes of the moving patch bodies, instead of being cast into the collision system. Only
+    /// collision shapes of type sphere, box, cylinder, and cylindrical shell are supported; if any patch body has other
+    /// collision shapes, ray casting falls back on the collision system. Note that, with analytic ray casting, the SCM
+    /// terrain interacts only with the moving patch bodies.
+    void EnableAnalyticRayCasting(bool val);
+
     /// Class to be used as a callback interface for location-dependent soil parameters.
     /// A derived class must implement Set() and set *all* soil parameters (no defaults are provided).
     class CH_VEHICLE_API SoilParametersCallback {
@@ -365,6 +375,125 @@ class CH_VEHICLE_API SCMDeformableSoil : public ChLoadContainer {
         std::size_t operator()(const ChVector2<int>& p) const { return p.x() * 31 + p.y(); }
     };
 
+    // Dense tiled storage for the records of modified grid nodes.
+    // Grid nodes are grouped in square tiles of contiguous records, allocated on first touch. A node lookup requires
+    // a single hash-map query on the (much smaller) set of tiles, neighboring nodes are almost always in the same tile,
+    // and only one bit of bookkeeping is used per node. Addresses of node records remain valid for the lifetime of the
+    // grid, so they can be cached (e.g., for repeated sweeps over a set of nodes and their neighbors).
+    class NodeGrid {
+      public:
+        NodeGrid() : m_num_nodes(0) {}
+
+        // Return the record of the specified node (nullptr if the node was not yet recorded).
+        NodeRecord* Find(const ChVector2<int>& loc);
+        const NodeRecord* Find(const ChVector2<int>& loc) const;
+
+        // Return the record of the specified node (which must have been recorded).
+        // Throw a ChException if the node was not recorded.
+        NodeRecord& Get(const ChVector2<int>& loc);
+        const NodeRecord& Get(const ChVector2<int>& loc) const;
+
+        // Insert the given record for the specified node, if not already recorded.
+        // Return the record of the node (existing or newly inserted).
+        NodeRecord& Insert(const ChVector2<int>& loc, const NodeRecord& nr);
+
+        // Set (insert or overwrite) the record of the specified node.
+        NodeRecord& Set(const ChVector2<int>& loc, const NodeRecord& nr);
+
+        // Return the number of recorded nodes.
+        size_t GetNumNodes() const { return m_num_nodes; }
+
+        // Invoke the given function, with arguments (grid location, node record), for all recorded nodes.
+        template <typename Function>
+        void ForEach(Function f) const {
+            for (const auto& t : m_tiles) {
+                ChVector2<int> origin(t.first.x() * tile_size, t.first.y() * tile_size);
+                for (int k = 0; k < tile_size * tile_size; k++) {
+                    if (t.second->used[k])
+                        f(origin + ChVector2<int>(k & tile_mask, k >> tile_bits), t.second->records[k]);
+                }
+            }
+        }
+
+      private:
+        static const int tile_bits = 5;  // tiles of 32x32 grid nodes
+        static const int tile_size = 1 << tile_bits;
+        static const int tile_mask = tile_size - 1;
+
+        struct Tile {
+            Tile() : records(tile_size * tile_size), used(tile_size * tile_size, false) {}
+            std::vector<NodeRecord> records;  // node records, ordered by rows
+            std::vector<bool> used;           // flags for recorded nodes
+        };
+
+        // Return the tile containing the specified node and the index of the node in that tile.
+        // If the tile does not exist, return nullptr or create it, as requested.
+        Tile* GetTile(const ChVector2<int>& loc, int& index, bool create);
+        const Tile* GetTile(const ChVector2<int>& loc, int& index) const;
+
+        std::unordered_map<ChVector2<int>, std::unique_ptr<Tile>, CoordHash> m_tiles;  // allocated tiles
+        size_t m_num_nodes;                                                           // number of recorded nodes
+    };
+
+    // Analytic ray caster for the collision shapes of the moving patch bodies.
+    // At each step, the supported collision shapes are expressed in the SCM frame and organized in a bounding volume
+    // hierarchy over their extents. Vertical rays are processed in batches of neighboring grid nodes: the hierarchy is
+    // traversed once per batch and all rays in a batch are intersected with a given shape in fixed-width loops, which
+    // the compiler can vectorize.
+    class RayCaster {
+      public:
+        static const int batch_size = 4;  // number of rays in a batch
+
+        // Batch of vertical rays (in SCM frame), from (x, y, z) to (x, y, z + length).
+        struct RayBatch {
+            int n;                  // number of active rays in batch
+            double x[batch_size];   // x coordinates of ray origins
+            double y[batch_size];   // y coordinates of ray origins
+            double z[batch_size];   // z coordinates of ray origins
+            double t[batch_size];   // output: distance to closest hit (infinity if no hit)
+            ChContactable* contactable[batch_size];  // output: hit object
+        };
+
+        // Collect the collision shapes of all moving patch bodies and build the bounding volume hierarchy.
+        // Return false if a body has an unsupported collision shape.
+        bool Update(const std::vector<MovingPatchInfo>& patches, const ChCoordsys<>& plane);
+
+        // Intersect the given batch of rays, of specified length, with the collision shapes.
+        void Cast(RayBatch& batch, double length) const;
+
+      private:
+        enum class ShapeType { SPHERE, BOX, CYLINDER };
+
+        // Collision shape, expressed in the SCM frame.
+        struct Shape {
+            ShapeType type;
+            ChContactable* contactable;  // owner of the collision shape
+            ChVector<> pos;              // shape origin
+            ChMatrix33<> rot;            // shape orientation (shape to SCM frame)
+            ChVector<> dims;             // sphere radius, box half-dimensions, or cylinder radii and half-length
+            ChVector<> aabb_min;         // lower corner of bounding box
+            ChVector<> aabb_max;         // upper corner of bounding box
+        };
+
+        // Node of the bounding volume hierarchy (leaf if num_shapes > 0).
+        struct Node {
+            ChVector<> aabb_min;  // lower corner of bounding box
+            ChVector<> aabb_max;  // upper corner of bounding box
+            int child;            // index of first child (second child follows it)
+            int first_shape;      // index of first shape in leaf
+            int num_shapes;       // number of shapes in leaf
+        };
+
+        // Recursively build the subtree rooted at the specified node, for the given range of shapes.
+        void Build(int node, int first, int count);
+
+        // Intersect the given batch of rays with a collision shape.
+        void Intersect(const Shape& shape, RayBatch& batch, double length) const;
+
+        std::vector<Shape> m_shapes;  // collision shapes, ordered by leaf
+        std::vector<Node> m_nodes;    // nodes of the hierarchy (root is first)
+    };
+
     // Get the initial undeformed terrain height (relative to the SCM plane) at the specified grid node.
     double GetInitHeight(const ChVector2<int>& loc) const;
 
@@ -467,12 +596,15 @@ class CH_VEHICLE_API SCMDeformableSoil : public ChLoadContainer {
 
     ChMatrixDynamic<> m_heights;  // (base) grid heights (when initializing from height-field map)
 
-    std::unordered_map<ChVector2<int>, NodeRecord, CoordHash> m_grid_map;  // modified grid nodes (persistent)
-    std::vector<ChVector2<int>> m_modified_nodes;                          // modified grid nodes (current)
+    NodeGrid m_grid_map;                           // modified grid nodes (persistent)
+    std::vector<ChVector2<int>> m_modified_nodes;  // modified grid nodes (current)
 
     std::vector<MovingPatchInfo> m_patches;  // set of active moving patches
     bool m_moving_patch;                     // user-specified moving patches?
 
+    bool m_analytic_raycast;  // use analytic ray casting for the moving patch bodies?
+    RayCaster m_ray_caster;   // analytic ray caster
+
     double m_test_offset_down;  // offset for ray start
     double m_test_offset_up;    // offset for ray end
 
@@ -19,6 +19,8 @@
 //
 // =============================================================================
 
+#include "chrono/utils/ChTraceProfiler.h"
+
 #include "chrono_vehicle/ChSubsysDefs.h"
 #include "chrono_vehicle/tracked_vehicle/ChTrackedVehicle.h"
 
@@ -75,6 +77,7 @@ void ChTrackedVehicle::Synchronize(double time,
                                    const ChDriver::Inputs& driver_inputs,
                                    const TerrainForces& shoe_forces_left,
                                    const TerrainForces& shoe_forces_right) {
+    CH_TRACE_ZONE("ChTrackedVehicle::Synchronize");
     // Let the driveline combine driver inputs if needed.
     double braking_left, braking_right;
     m_driveline->CombineDriverInputs(driver_inputs, braking_left, braking_right);
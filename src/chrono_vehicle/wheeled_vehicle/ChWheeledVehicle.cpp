@@ -18,6 +18,8 @@
 
 #include <fstream>
 
+#include "chrono/utils/ChTraceProfiler.h"
+
 #include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicle.h"
 
 #include "chrono_thirdparty/rapidjson/document.h"
@@ -73,6 +75,7 @@ void ChWheeledVehicle::InitializePowertrain(std::shared_ptr<ChPowertrain> powert
 // to the terrain system.
 // -----------------------------------------------------------------------------
 void ChWheeledVehicle::Synchronize(double time, const ChDriver::Inputs& driver_inputs, const ChTerrain& terrain) {
+    CH_TRACE_ZONE("ChWheeledVehicle::Synchronize");
     double powertrain_torque = 0;
     if (m_powertrain) {
         // Extract the torque from the powertrain.
@@ -28,6 +28,7 @@
 
 #include "chrono/ChConfig.h"
 #include "chrono/core/ChStream.h"
+#include "chrono/utils/ChCheckpoint.h"
 #include "chrono/utils/ChUtilsCreators.h"
 #include "chrono/utils/ChUtilsGenerators.h"
 #include "chrono/utils/ChUtilsInputOutput.h"
@@ -185,7 +186,7 @@ const std::string out_dir = GetChronoOutputPath() + "CRATER_NSC";
 
 const std::string pov_dir = out_dir + "/POVRAY";
 const std::string height_file = out_dir + "/height.dat";
-const std::string checkpoint_file = out_dir + "/settled.dat";
+const std::string checkpoint_file = out_dir + "/settled.chk";
 
 int out_fps_settling = 120;
 int out_fps_dropping = 1200;
@@ -445,7 +446,7 @@ int main(int argc, char* argv[]) {
 
         // Create the falling ball, the granular material, and the container from the checkpoint file.
         cout << "Read checkpoint data from " << checkpoint_file;
-        utils::ReadCheckpoint(msystem, checkpoint_file);
+        utils::ReadCheckpointBinary(msystem, checkpoint_file);
         cout << "  done.  Read " << msystem->Get_bodylist().size() << " bodies." << endl;
 
         // Move the falling ball just above the granular material with a velocity
@@ -513,7 +514,7 @@ int main(int argc, char* argv[]) {
             // Create a checkpoint from the current state.
             if (problem == ProblemPhase::SETTLING && intermediate_checkpoints) {
                 cout << "     Write checkpoint data " << flush;
-                utils::WriteCheckpoint(msystem, checkpoint_file);
+                utils::WriteCheckpointBinary(msystem, checkpoint_file, utils::ChCheckpoint::Compression::ZLIB);
                 cout << msystem->Get_bodylist().size() << " bodies" << endl;
             }
 
@@ -563,7 +564,7 @@ int main(int argc, char* argv[]) {
     // Create a checkpoint from the last state
     if (problem == ProblemPhase::SETTLING) {
         cout << "Write checkpoint data to " << checkpoint_file;
-        utils::WriteCheckpoint(msystem, checkpoint_file);
+        utils::WriteCheckpointBinary(msystem, checkpoint_file, utils::ChCheckpoint::Compression::ZLIB);
         cout << "  done.  Wrote " << msystem->Get_bodylist().size() << " bodies." << endl;
     }
 
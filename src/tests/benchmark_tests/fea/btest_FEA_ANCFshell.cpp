@@ -17,6 +17,9 @@
 // Note that the MKL Pardiso and Mumps solvers are set to lock the sparsity
 // pattern, but not to use the sparsity pattern learner.
 //
+// The MINRES tests are also run with the batched evaluation of element
+// internal forces disabled (NoBatch), for comparison.
+//
 // =============================================================================
 
 #include "chrono/ChConfig.h"
@@ -67,6 +70,7 @@ class ANCFshell : public utils::ChBenchmarkTest {
     ANCFshell(SolverType solver_type);
 
     ChSystemSMC* m_system;
+    std::shared_ptr<ChMesh> m_mesh;
 };
 
 template <int N>
@@ -75,6 +79,12 @@ class ANCFshell_MINRES : public ANCFshell<N> {
     ANCFshell_MINRES() : ANCFshell<N>(SolverType::MINRES) {}
 };
 
+template <int N>
+class ANCFshell_MINRES_NoBatch : public ANCFshell<N> {
+  public:
+    ANCFshell_MINRES_NoBatch() : ANCFshell<N>(SolverType::MINRES) { this->m_mesh->SetElementBatching(false); }
+};
+
 template <int N>
 class ANCFshell_SparseQR : public ANCFshell<N> {
   public:
@@ -199,6 +209,7 @@ ANCFshell<N>::ANCFshell(SolverType solver_type) {
     // Create mesh nodes and elements
     auto mesh = chrono_types::make_shared<ChMesh>();
     m_system->Add(mesh);
+    m_mesh = mesh;
 
     auto vis_surf = chrono_types::make_shared<ChVisualizationFEAmesh>(*mesh);
     vis_surf->SetFEMdataType(ChVisualizationFEAmesh::E_PLOT_SURFACE);
@@ -278,6 +289,11 @@ CH_BM_SIMULATION_LOOP(ANCFshell16_MINRES, ANCFshell_MINRES<16>, NUM_SKIP_STEPS,
 CH_BM_SIMULATION_LOOP(ANCFshell32_MINRES, ANCFshell_MINRES<32>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 CH_BM_SIMULATION_LOOP(ANCFshell64_MINRES, ANCFshell_MINRES<64>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 
+CH_BM_SIMULATION_LOOP(ANCFshell08_MINRES_NoBatch, ANCFshell_MINRES_NoBatch<8>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell16_MINRES_NoBatch, ANCFshell_MINRES_NoBatch<16>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell32_MINRES_NoBatch, ANCFshell_MINRES_NoBatch<32>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell64_MINRES_NoBatch, ANCFshell_MINRES_NoBatch<64>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
 CH_BM_SIMULATION_LOOP(ANCFshell08_SparseQR, ANCFshell_SparseQR<8>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 CH_BM_SIMULATION_LOOP(ANCFshell16_SparseQR, ANCFshell_SparseQR<16>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 CH_BM_SIMULATION_LOOP(ANCFshell32_SparseQR, ANCFshell_SparseQR<32>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
@@ -0,0 +1,170 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Kernel benchmark for the calculation of ChMesh internal forces as a function
+// of the number of elements, for different element types.
+// Results are written in JSON format to btest_FEA_mesh_forces.json.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChBuilderBeam.h"
+#include "chrono/fea/ChContinuumMaterial.h"
+#include "chrono/fea/ChElementHexa_8.h"
+#include "chrono/fea/ChElementShellANCF.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// =============================================================================
+
+enum class ElementType { CABLE_ANCF, BEAM_EULER, SHELL_ANCF, HEXA_8 };
+
+template <ElementType ELEMENT>
+class MeshForcesKernel : public utils::ChBenchmarkKernel {
+  public:
+    MeshForcesKernel() : m_sys(nullptr) {}
+    ~MeshForcesKernel() { delete m_sys; }
+
+    virtual void Setup(int size) override;
+    virtual void Execute() override;
+    virtual void Report(benchmark::State& st) override;
+
+  private:
+    void CreateShellPlate(int n);
+    void CreateHexaColumn(int n);
+
+    ChSystemSMC* m_sys;
+    std::shared_ptr<ChMesh> m_mesh;
+    ChVectorDynamic<> m_R;
+};
+
+template <ElementType ELEMENT>
+void MeshForcesKernel<ELEMENT>::Setup(int size) {
+    m_sys = new ChSystemSMC();
+    m_mesh = chrono_types::make_shared<ChMesh>();
+    m_sys->Add(m_mesh);
+
+    switch (ELEMENT) {
+        case ElementType::CABLE_ANCF: {
+            auto section = chrono_types::make_shared<ChBeamSectionCable>();
+            section->SetDiameter(0.01);
+            section->SetYoungModulus(1e8);
+            ChBuilderCableANCF builder;
+            builder.BuildBeam(m_mesh, section, size, ChVector<>(0, 0, 0), ChVector<>(1, 0, 0));
+            break;
+        }
+        case ElementType::BEAM_EULER: {
+            auto section = chrono_types::make_shared<ChBeamSectionEulerAdvanced>();
+            section->SetAsRectangularSection(0.01, 0.01);
+            section->SetYoungModulus(2e11);
+            ChBuilderBeamEuler builder;
+            builder.BuildBeam(m_mesh, section, size, ChVector<>(0, 0, 0), ChVector<>(1, 0, 0), ChVector<>(0, 1, 0));
+            break;
+        }
+        case ElementType::SHELL_ANCF:
+            CreateShellPlate(static_cast<int>(std::ceil(std::sqrt(size))));
+            break;
+        case ElementType::HEXA_8:
+            CreateHexaColumn(size);
+            break;
+    }
+
+    // Initialize the mesh elements
+    m_sys->DoFullAssembly();
+
+    m_R.setZero(m_sys->GetNcoords_w());
+}
+
+template <ElementType ELEMENT>
+void MeshForcesKernel<ELEMENT>::CreateShellPlate(int n) {
+    double length = 1;
+    double thickness = 0.01;
+    auto mat = chrono_types::make_shared<ChMaterialShellANCF>(500, 2.1e7, 0.3);
+
+    double dx = length / n;
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    for (int j = 0; j <= n; j++) {
+        for (int i = 0; i <= n; i++) {
+            auto node = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(i * dx, j * dx, 0), ChVector<>(0, 0, 1));
+            m_mesh->AddNode(node);
+            nodes.push_back(node);
+        }
+    }
+
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < n; i++) {
+            int k = j * (n + 1) + i;
+            auto element = chrono_types::make_shared<ChElementShellANCF>();
+            element->SetNodes(nodes[k], nodes[k + 1], nodes[k + n + 2], nodes[k + n + 1]);
+            element->SetDimensions(dx, dx);
+            element->AddLayer(thickness, 0, mat);
+            element->SetAlphaDamp(0.0);
+            element->SetGravityOn(false);
+            m_mesh->AddElement(element);
+        }
+    }
+}
+
+template <ElementType ELEMENT>
+void MeshForcesKernel<ELEMENT>::CreateHexaColumn(int n) {
+    double h = 0.1;
+    auto mat = chrono_types::make_shared<ChContinuumElastic>(1e7, 0.3, 1000);
+
+    std::shared_ptr<ChNodeFEAxyz> lower[4];
+    for (int k = 0; k <= n; k++) {
+        std::shared_ptr<ChNodeFEAxyz> upper[4] = {
+            chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(0, k * h, 0)),
+            chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(0, k * h, h)),
+            chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(h, k * h, h)),
+            chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(h, k * h, 0))};
+        for (int i = 0; i < 4; i++)
+            m_mesh->AddNode(upper[i]);
+
+        if (k > 0) {
+            auto element = chrono_types::make_shared<ChElementHexa_8>();
+            element->SetNodes(lower[0], lower[1], lower[2], lower[3], upper[0], upper[1], upper[2], upper[3]);
+            element->SetMaterial(mat);
+            m_mesh->AddElement(element);
+        }
+
+        for (int i = 0; i < 4; i++)
+            lower[i] = upper[i];
+    }
+}
+
+template <ElementType ELEMENT>
+void MeshForcesKernel<ELEMENT>::Execute() {
+    m_mesh->IntLoadResidual_F(m_mesh->GetOffset_w(), m_R, 1.0);
+}
+
+template <ElementType ELEMENT>
+void MeshForcesKernel<ELEMENT>::Report(benchmark::State& st) {
+    st.counters["Elements"] = m_mesh->GetNelements();
+    st.counters["DOFs"] = m_mesh->GetDOF_w();
+    st.SetItemsProcessed(st.iterations() * m_mesh->GetNelements());
+}
+
+// =============================================================================
+
+CH_BM_KERNEL(MeshForcesCableANCF, MeshForcesKernel<ElementType::CABLE_ANCF>, 64, 16384, 4)
+CH_BM_KERNEL(MeshForcesBeamEuler, MeshForcesKernel<ElementType::BEAM_EULER>, 64, 16384, 4)
+CH_BM_KERNEL(MeshForcesShellANCF, MeshForcesKernel<ElementType::SHELL_ANCF>, 64, 16384, 4)
+CH_BM_KERNEL(MeshForcesHexa8, MeshForcesKernel<ElementType::HEXA_8>, 64, 16384, 4)
+
+CH_BM_MAIN_JSON("btest_FEA_mesh_forces.json")
@@ -0,0 +1,118 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Kernel benchmark for the ChSolverSparseLU factorization as a function of the
+// problem size (number of DOFs).
+//
+// The system matrix is obtained from a square plate of ANCF shell elements.
+// Two variants are benchmarked:
+// - full factorization (symbolic and numeric) of the current matrix;
+// - matrix assembly and numeric factorization only, reusing the cached
+//   sparsity pattern and symbolic analysis.
+// Results are written in JSON format to btest_FEA_sparseLU.json.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/fea/ChElementShellANCF.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// =============================================================================
+
+template <bool CACHE_PATTERN>
+class SparseLUKernel : public utils::ChBenchmarkKernel {
+  public:
+    SparseLUKernel() : m_sys(nullptr) {}
+    ~SparseLUKernel() { delete m_sys; }
+
+    virtual void Setup(int size) override;
+    virtual void Execute() override;
+    virtual void Report(benchmark::State& st) override;
+
+  private:
+    ChSystemSMC* m_sys;
+    std::shared_ptr<ChSolverSparseLU> m_solver;
+};
+
+template <bool CACHE_PATTERN>
+void SparseLUKernel<CACHE_PATTERN>::Setup(int size) {
+    m_sys = new ChSystemSMC();
+
+    m_solver = chrono_types::make_shared<ChSolverSparseLU>();
+    m_solver->CacheSparsityPattern(CACHE_PATTERN);
+    m_sys->SetSolver(m_solver);
+
+    // Create a square plate with size x size ANCF shell elements, fixed along one edge
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    m_sys->Add(mesh);
+
+    auto mat = chrono_types::make_shared<ChMaterialShellANCF>(500, 2.1e7, 0.3);
+    double dx = 1.0 / size;
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    for (int j = 0; j <= size; j++) {
+        for (int i = 0; i <= size; i++) {
+            auto node = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(i * dx, j * dx, 0), ChVector<>(0, 0, 1));
+            node->SetFixed(i == 0);
+            mesh->AddNode(node);
+            nodes.push_back(node);
+        }
+    }
+    for (int j = 0; j < size; j++) {
+        for (int i = 0; i < size; i++) {
+            int k = j * (size + 1) + i;
+            auto element = chrono_types::make_shared<ChElementShellANCF>();
+            element->SetNodes(nodes[k], nodes[k + 1], nodes[k + size + 2], nodes[k + size + 1]);
+            element->SetDimensions(dx, dx);
+            element->AddLayer(0.01, 0, mat);
+            element->SetAlphaDamp(0.0);
+            element->SetGravityOn(false);
+            mesh->AddElement(element);
+        }
+    }
+
+    // Load the system matrix and perform a first factorization
+    m_sys->DoStaticLinear();
+    m_solver->ResetTimers();
+}
+
+template <bool CACHE_PATTERN>
+void SparseLUKernel<CACHE_PATTERN>::Execute() {
+    if (CACHE_PATTERN)
+        m_solver->Setup(*m_sys->GetSystemDescriptor());
+    else
+        m_solver->SetupCurrent();
+}
+
+template <bool CACHE_PATTERN>
+void SparseLUKernel<CACHE_PATTERN>::Report(benchmark::State& st) {
+    auto num_it = st.iterations();
+    st.counters["DOFs"] = static_cast<double>(m_solver->GetMatrix().rows());
+    st.counters["NNZ"] = static_cast<double>(m_solver->GetMatrix().nonZeros());
+    st.counters["LS_Setup_assembly"] = m_solver->GetTimeSetup_Assembly() * 1e3 / num_it;
+    st.counters["LS_Setup_call"] = m_solver->GetTimeSetup_SolverCall() * 1e3 / num_it;
+}
+
+// =============================================================================
+
+CH_BM_KERNEL(SparseLU_Factorize, SparseLUKernel<false>, 4, 64, 2)
+CH_BM_KERNEL(SparseLU_CachedPattern, SparseLUKernel<true>, 4, 64, 2)
+
+CH_BM_MAIN_JSON("btest_FEA_sparseLU.json")
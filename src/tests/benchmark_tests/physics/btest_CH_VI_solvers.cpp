@@ -0,0 +1,104 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Kernel benchmark for the iterative VI solvers (PSOR, colored PSOR, APGD, BB) as
+// a function of the number of (frictional contact) constraints.
+//
+// A layer of spheres resting on a fixed box is simulated for a few steps, after
+// which the solver is repeatedly invoked, with a fixed number of iterations, on
+// the problem currently loaded in the system descriptor.
+// Results are written in JSON format to btest_CH_VI_solvers.json.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChIterativeSolverVI.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+#define NUM_ITERATIONS 50
+
+template <ChSolver::Type SOLVER>
+class SolverKernel : public utils::ChBenchmarkKernel {
+  public:
+    SolverKernel() : m_sys(nullptr) {}
+    ~SolverKernel() { delete m_sys; }
+
+    virtual void Setup(int size) override;
+    virtual void Execute() override;
+    virtual void Report(benchmark::State& st) override;
+
+  private:
+    ChSystemNSC* m_sys;
+    std::shared_ptr<ChIterativeSolverVI> m_solver;
+};
+
+template <ChSolver::Type SOLVER>
+void SolverKernel<SOLVER>::Setup(int size) {
+    m_sys = new ChSystemNSC();
+    m_sys->Set_G_acc(ChVector<>(0, 0, -9.81));
+    m_sys->SetSolverType(SOLVER);
+    m_solver = std::static_pointer_cast<ChIterativeSolverVI>(m_sys->GetSolver());
+    m_solver->SetMaxIterations(NUM_ITERATIONS);
+    m_solver->SetTolerance(0);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.5f);
+
+    // Create a square layer of spheres, with each sphere in contact with the ground
+    double radius = 0.5;
+    int n = static_cast<int>(std::ceil(std::sqrt(size)));
+    for (int i = 0; i < size; i++) {
+        auto ball = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, mat);
+        ball->SetPos(ChVector<>(2.2 * radius * (i % n), 2.2 * radius * (i / n), radius));
+        m_sys->AddBody(ball);
+    }
+
+    double length = 2.2 * radius * n;
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(length + 1, length + 1, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(length / 2, length / 2, -0.5));
+    ground->SetBodyFixed(true);
+    m_sys->AddBody(ground);
+
+    // Simulate a few steps so that contacts are established and the solver problem is loaded
+    for (int i = 0; i < 5; i++)
+        m_sys->DoStepDynamics(1e-3);
+}
+
+template <ChSolver::Type SOLVER>
+void SolverKernel<SOLVER>::Execute() {
+    m_solver->Solve(*m_sys->GetSystemDescriptor());
+}
+
+template <ChSolver::Type SOLVER>
+void SolverKernel<SOLVER>::Report(benchmark::State& st) {
+    st.counters["Constraints"] = m_sys->GetSystemDescriptor()->CountActiveConstraints();
+    st.counters["Iterations"] = m_solver->GetIterations();
+    st.SetItemsProcessed(st.iterations() * m_solver->GetIterations());
+}
+
+// =============================================================================
+
+CH_BM_KERNEL(SolverPSOR, SolverKernel<ChSolver::Type::PSOR>, 64, 16384, 4)
+CH_BM_KERNEL(SolverPSORcolored, SolverKernel<ChSolver::Type::PSOR_COLORED>, 64, 16384, 4)
+CH_BM_KERNEL(SolverAPGD, SolverKernel<ChSolver::Type::APGD>, 64, 16384, 4)
+CH_BM_KERNEL(SolverBB, SolverKernel<ChSolver::Type::BARZILAIBORWEIN>, 64, 16384, 4)
+
+CH_BM_MAIN_JSON("btest_CH_VI_solvers.json")
@@ -0,0 +1,102 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Kernel benchmark for the Bullet collision detection (broadphase and
+// narrowphase) as a function of the number of bodies.
+//
+// The bodies (spheres or boxes) are arranged in a cubic lattice with spacing
+// slightly smaller than their size, so that each body overlaps its neighbors.
+// Results are written in JSON format to btest_CH_collision.json.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+enum class ShapeType { SPHERE, BOX };
+
+template <ShapeType SHAPE>
+class CollisionKernel : public utils::ChBenchmarkKernel {
+  public:
+    CollisionKernel() : m_sys(nullptr), m_timer_broad(0), m_timer_narrow(0), m_num_calls(0) {}
+    ~CollisionKernel() { delete m_sys; }
+
+    virtual void Setup(int size) override;
+    virtual void Execute() override;
+    virtual void Report(benchmark::State& st) override;
+
+  private:
+    ChSystemNSC* m_sys;
+    double m_timer_broad;
+    double m_timer_narrow;
+    int m_num_calls;
+};
+
+template <ShapeType SHAPE>
+void CollisionKernel<SHAPE>::Setup(int size) {
+    m_sys = new ChSystemNSC();
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    int n = static_cast<int>(std::ceil(std::cbrt(size)));
+    double spacing = 0.95;
+    for (int i = 0; i < size; i++) {
+        ChVector<> pos(spacing * (i % n), spacing * ((i / n) % n), spacing * (i / (n * n)));
+        std::shared_ptr<ChBody> body;
+        switch (SHAPE) {
+            case ShapeType::SPHERE:
+                body = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+                break;
+            case ShapeType::BOX:
+                body = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, false, true, mat);
+                body->SetRot(Q_from_AngZ(0.1 * (i % 7)));
+                break;
+        }
+        body->SetPos(pos);
+        m_sys->AddBody(body);
+    }
+
+    // Synchronize collision models and perform a first collision detection
+    m_sys->ComputeCollisions();
+}
+
+template <ShapeType SHAPE>
+void CollisionKernel<SHAPE>::Execute() {
+    auto coll_sys = m_sys->GetCollisionSystem();
+    coll_sys->ResetTimers();
+    coll_sys->Run();
+    m_timer_broad += coll_sys->GetTimerCollisionBroad();
+    m_timer_narrow += coll_sys->GetTimerCollisionNarrow();
+    m_num_calls++;
+}
+
+template <ShapeType SHAPE>
+void CollisionKernel<SHAPE>::Report(benchmark::State& st) {
+    st.counters["CD_Broad"] = 1e3 * m_timer_broad / m_num_calls;
+    st.counters["CD_Narrow"] = 1e3 * m_timer_narrow / m_num_calls;
+    st.counters["Contacts"] = m_sys->GetNcontacts();
+}
+
+// =============================================================================
+
+CH_BM_KERNEL(CollisionSpheres, CollisionKernel<ShapeType::SPHERE>, 64, 32768, 8)
+CH_BM_KERNEL(CollisionBoxes, CollisionKernel<ShapeType::BOX>, 64, 32768, 8)
+
+CH_BM_MAIN_JSON("btest_CH_collision.json")
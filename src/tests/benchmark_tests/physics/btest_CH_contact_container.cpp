@@ -0,0 +1,117 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Kernel benchmark for the NSC and SMC contact containers as a function of the
+// number of contacts.
+//
+// A fixed set of collision pairs (between consecutive bodies in a row of
+// spheres) is inserted in the contact container of the system, as done by the
+// collision system at each step. For SMC, the contact forces are also loaded
+// in a residual vector.
+// Results are written in JSON format to btest_CH_contact_container.json.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainer.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+template <typename SYSTEM, typename MATERIAL, bool LOAD_FORCES>
+class ContactContainerKernel : public utils::ChBenchmarkKernel {
+  public:
+    ContactContainerKernel() : m_sys(nullptr) {}
+    ~ContactContainerKernel() { delete m_sys; }
+
+    virtual void Setup(int size) override;
+    virtual void Execute() override;
+    virtual void Report(benchmark::State& st) override;
+
+  private:
+    SYSTEM* m_sys;
+    std::shared_ptr<MATERIAL> m_mat;
+    std::vector<collision::ChCollisionInfo> m_pairs;
+    ChVectorDynamic<> m_R;
+};
+
+template <typename SYSTEM, typename MATERIAL, bool LOAD_FORCES>
+void ContactContainerKernel<SYSTEM, MATERIAL, LOAD_FORCES>::Setup(int size) {
+    m_sys = new SYSTEM();
+    m_mat = chrono_types::make_shared<MATERIAL>();
+
+    // Create a row of slightly interpenetrating spheres
+    double radius = 0.5;
+    double penetration = 1e-3;
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int i = 0; i <= size; i++) {
+        auto body = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, m_mat);
+        body->SetPos(ChVector<>(i * (2 * radius - penetration), 0, 0));
+        m_sys->AddBody(body);
+        bodies.push_back(body);
+    }
+    m_sys->Setup();
+    m_sys->Update();
+
+    // Create the collision pairs
+    m_pairs.resize(size);
+    for (int i = 0; i < size; i++) {
+        auto& cinfo = m_pairs[i];
+        cinfo.modelA = bodies[i]->GetCollisionModel().get();
+        cinfo.modelB = bodies[i + 1]->GetCollisionModel().get();
+        cinfo.vN = ChVector<>(1, 0, 0);
+        cinfo.vpA = bodies[i]->GetPos() + radius * cinfo.vN;
+        cinfo.vpB = bodies[i + 1]->GetPos() - radius * cinfo.vN;
+        cinfo.distance = -penetration;
+        cinfo.eff_radius = radius / 2;
+    }
+
+    m_R.setZero(m_sys->GetNcoords_w());
+}
+
+template <typename SYSTEM, typename MATERIAL, bool LOAD_FORCES>
+void ContactContainerKernel<SYSTEM, MATERIAL, LOAD_FORCES>::Execute() {
+    auto container = m_sys->GetContactContainer();
+    container->BeginAddContact();
+    for (const auto& cinfo : m_pairs)
+        container->AddContact(cinfo, m_mat, m_mat);
+    container->EndAddContact();
+
+    if (LOAD_FORCES)
+        container->IntLoadResidual_F(0, m_R, 1.0);
+}
+
+template <typename SYSTEM, typename MATERIAL, bool LOAD_FORCES>
+void ContactContainerKernel<SYSTEM, MATERIAL, LOAD_FORCES>::Report(benchmark::State& st) {
+    st.counters["Contacts"] = m_sys->GetContactContainer()->GetNcontacts();
+    st.SetItemsProcessed(st.iterations() * m_pairs.size());
+}
+
+// =============================================================================
+
+using ContactsNSC = ContactContainerKernel<ChSystemNSC, ChMaterialSurfaceNSC, false>;
+using ContactsSMC = ContactContainerKernel<ChSystemSMC, ChMaterialSurfaceSMC, false>;
+using ContactsForcesSMC = ContactContainerKernel<ChSystemSMC, ChMaterialSurfaceSMC, true>;
+
+CH_BM_KERNEL(ContactContainerNSC, ContactsNSC, 256, 262144, 8)
+CH_BM_KERNEL(ContactContainerSMC, ContactsSMC, 256, 262144, 8)
+CH_BM_KERNEL(ContactContainerForcesSMC, ContactsForcesSMC, 256, 262144, 8)
+
+CH_BM_MAIN_JSON("btest_CH_contact_container.json")
@@ -13,6 +13,8 @@
 // =============================================================================
 //
 // Benchmark test for contact simulation using NSC contact.
+// The mixer is simulated with the sequential PSOR solver and with the
+// multithreaded graph-colored PSOR solver (PSOR_COLORED).
 //
 // =============================================================================
 
@@ -33,7 +35,7 @@ using namespace chrono;
 
 // =============================================================================
 
-template <int N>
+template <int N, ChSolver::Type SOLVER = ChSolver::Type::PSOR>
 class MixerTestNSC : public utils::ChBenchmarkTest {
   public:
     MixerTestNSC();
@@ -49,8 +51,10 @@ class MixerTestNSC : public utils::ChBenchmarkTest {
     double m_step;
 };
 
-template <int N>
-MixerTestNSC<N>::MixerTestNSC() : m_system(new ChSystemNSC()), m_step(0.02) {
+template <int N, ChSolver::Type SOLVER>
+MixerTestNSC<N, SOLVER>::MixerTestNSC() : m_system(new ChSystemNSC()), m_step(0.02) {
+    m_system->SetSolverType(SOLVER);
+
     auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
 
     for (int bi = 0; bi < N; bi++) {
@@ -106,8 +110,8 @@ MixerTestNSC<N>::MixerTestNSC() : m_system(new ChSystemNSC()), m_step(0.02) {
     m_system->AddLink(motor);
 }
 
-template <int N>
-void MixerTestNSC<N>::SimulateVis() {
+template <int N, ChSolver::Type SOLVER>
+void MixerTestNSC<N, SOLVER>::SimulateVis() {
 #ifdef CHRONO_IRRLICHT
     irrlicht::ChIrrApp application(m_system, L"Rigid contacts", irr::core::dimension2d<irr::u32>(800, 600));
     application.AddTypicalLogo();
@@ -135,6 +139,11 @@ void MixerTestNSC<N>::SimulateVis() {
 CH_BM_SIMULATION_LOOP(MixerNSC032, MixerTestNSC<32>,  NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 CH_BM_SIMULATION_LOOP(MixerNSC064, MixerTestNSC<64>,  NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 
+using MixerTestNSC032_colored = MixerTestNSC<32, ChSolver::Type::PSOR_COLORED>;
+using MixerTestNSC064_colored = MixerTestNSC<64, ChSolver::Type::PSOR_COLORED>;
+CH_BM_SIMULATION_LOOP(MixerNSC032_PSORcolored, MixerTestNSC032_colored, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(MixerNSC064_PSORcolored, MixerTestNSC064_colored, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
@@ -0,0 +1,153 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Benchmark test for the scaling of SCM ray casting with the number of threads.
+//
+// A set of rigid wheels (cylinders) roll over a fine SCM grid, each wheel being
+// tracked by its own moving patch. The same model is simulated using different
+// numbers of Chrono threads, with ray casting performed either in the collision
+// system or with the SCM analytic ray caster; in addition to the usual system
+// timers, the time spent in SCM ray casting is reported.
+//
+// =============================================================================
+
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/terrain/SCMDeformableTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// =============================================================================
+
+double size = 20.0;   // terrain patch dimension
+double delta = 0.02;  // SCM grid spacing
+int num_wheels = 4;   // number of wheels in each direction
+
+// =============================================================================
+
+template <int NTHREADS, bool ANALYTIC>
+class ScmRaycastTest : public utils::ChBenchmarkTest {
+  public:
+    ScmRaycastTest();
+    ~ScmRaycastTest();
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override;
+
+    void ResetRaycastTimer() { m_timer_raycast = 0; }
+    double GetTimerRaycast() const { return m_timer_raycast; }
+    int GetNumRayCasts() const { return m_terrain->GetNumRayCasts(); }
+
+  private:
+    ChSystemSMC* m_system;
+    SCMDeformableTerrain* m_terrain;
+
+    double m_step;
+    double m_timer_raycast;  // cumulative SCM ray casting time (ms)
+};
+
+template <int NTHREADS, bool ANALYTIC>
+ScmRaycastTest<NTHREADS, ANALYTIC>::ScmRaycastTest() : m_step(1e-3), m_timer_raycast(0) {
+    m_system = new ChSystemSMC();
+    m_system->Set_G_acc(ChVector<>(0, 0, -9.81));
+    m_system->SetNumThreads(NTHREADS);
+
+    // Create the SCM terrain
+    m_terrain = new SCMDeformableTerrain(m_system);
+    m_terrain->SetSoilParameters(2e6,   // Bekker Kphi
+                                 0,     // Bekker Kc
+                                 1.1,   // Bekker n exponent
+                                 0,     // Mohr cohesive limit (Pa)
+                                 30,    // Mohr friction limit (degrees)
+                                 0.01,  // Janosi shear coefficient (m)
+                                 2e8,   // Elastic stiffness (Pa/m), before plastic yield
+                                 3e4    // Damping (Pa s/m), proportional to negative vertical speed (optional)
+    );
+
+    // Create the wheels, initially rolling in the X direction, and a moving patch for each of them
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    double radius = 0.5;
+    double width = 0.4;
+    double speed = 2.0;
+    double spacing = 0.8 * size / num_wheels;
+    for (int ix = 0; ix < num_wheels; ix++) {
+        for (int iy = 0; iy < num_wheels; iy++) {
+            auto wheel = chrono_types::make_shared<ChBodyEasyCylinder>(radius, width, 500, false, true, mat);
+            wheel->SetPos(ChVector<>(-0.4 * size + ix * spacing, -0.4 * size + (iy + 0.5) * spacing, radius));
+            wheel->SetPos_dt(ChVector<>(speed, 0, 0));
+            wheel->SetWvel_par(ChVector<>(0, speed / radius, 0));
+            m_system->Add(wheel);
+
+            m_terrain->AddMovingPatch(wheel, ChVector<>(0, 0, 0),
+                                      ChVector<>(2 * radius + 0.2, width + 0.2, 2 * radius + 0.2));
+        }
+    }
+
+    m_terrain->EnableAnalyticRayCasting(ANALYTIC);
+    m_terrain->Initialize(size, size, delta);
+}
+
+template <int NTHREADS, bool ANALYTIC>
+ScmRaycastTest<NTHREADS, ANALYTIC>::~ScmRaycastTest() {
+    delete m_terrain;
+    delete m_system;
+}
+
+template <int NTHREADS, bool ANALYTIC>
+void ScmRaycastTest<NTHREADS, ANALYTIC>::ExecuteStep() {
+    m_system->DoStepDynamics(m_step);
+    m_timer_raycast += m_terrain->GetTimerRayCasting();
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 200  // number of steps for hot start (1e-3 * 200 = 0.2s)
+#define NUM_SIM_STEPS 500   // number of simulation steps for each benchmark (1e-3 * 500 = 0.5s)
+#define REPEATS 5
+
+// Define and register a test with the specified number of threads and ray casting method.
+// In addition to the system timers, report the SCM ray casting time and the number of rays cast at the last step.
+#define CH_BM_SCM_RAYCAST(TEST_NAME, NTHREADS, ANALYTIC)                                        \
+    using TEST_NAME = chrono::utils::ChBenchmarkFixture<ScmRaycastTest<NTHREADS, ANALYTIC>, 0>; \
+    BENCHMARK_DEFINE_F(TEST_NAME, SimulateOnce)(benchmark::State & st) {                        \
+        Reset(NUM_SKIP_STEPS);                                                                  \
+        m_test->ResetRaycastTimer();                                                            \
+        while (st.KeepRunning()) {                                                              \
+            m_test->Simulate(NUM_SIM_STEPS);                                                    \
+        }                                                                                       \
+        Report(st);                                                                             \
+        st.counters["SCM_RayCasting"] = m_test->GetTimerRaycast();                              \
+        st.counters["SCM_NumRays"] = m_test->GetNumRayCasts();                                  \
+    }                                                                                           \
+    BENCHMARK_REGISTER_F(TEST_NAME, SimulateOnce)                                               \
+        ->Unit(benchmark::kMillisecond)                                                         \
+        ->Iterations(1)                                                                         \
+        ->Repetitions(REPEATS);
+
+CH_BM_SCM_RAYCAST(ScmRaycast_1, 1, false);
+CH_BM_SCM_RAYCAST(ScmRaycast_2, 2, false);
+CH_BM_SCM_RAYCAST(ScmRaycast_4, 4, false);
+CH_BM_SCM_RAYCAST(ScmRaycast_8, 8, false);
+CH_BM_SCM_RAYCAST(ScmRaycast_16, 16, false);
+
+CH_BM_SCM_RAYCAST(ScmRaycastAnalytic_1, 1, true);
+CH_BM_SCM_RAYCAST(ScmRaycastAnalytic_2, 2, true);
+CH_BM_SCM_RAYCAST(ScmRaycastAnalytic_4, 4, true);
+CH_BM_SCM_RAYCAST(ScmRaycastAnalytic_8, 8, true);
+CH_BM_SCM_RAYCAST(ScmRaycastAnalytic_16, 16, true);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Unit test for ChFunction_Recorder
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono/core/ChMathematics.h"
+#include "chrono/motion_functions/ChFunction_Recorder.h"
+
+using namespace chrono;
+
+// Reference piecewise-linear interpolation
+static double Interpolate(const std::vector<double>& xp, const std::vector<double>& yp, double x) {
+    if (x <= xp.front())
+        return yp.front();
+    if (x >= xp.back())
+        return yp.back();
+    size_t i = 0;
+    while (xp[i + 1] < x)
+        i++;
+    return yp[i] + (yp[i + 1] - yp[i]) * (x - xp[i]) / (xp[i + 1] - xp[i]);
+}
+
+TEST(ChFunctionRecorderTest, insertion) {
+    ChFunction_Recorder fun;
+    fun.AddPoint(2, 20);
+    fun.AddPoint(0, 0);
+    fun.AddPoint(3, 30);
+    fun.AddPoint(1, 10);
+    fun.AddPoint(2, 25);  // overwrite
+
+    const auto& points = fun.GetPoints();
+    ASSERT_EQ(points.size(), 4);
+    for (size_t i = 0; i < points.size(); i++)
+        ASSERT_EQ(points[i].x, (double)i);
+    ASSERT_EQ(points[2].y, 25);
+
+    ASSERT_DOUBLE_EQ(fun.Get_y(-1), 0);
+    ASSERT_DOUBLE_EQ(fun.Get_y(0.5), 5);
+    ASSERT_DOUBLE_EQ(fun.Get_y(2), 25);
+    ASSERT_DOUBLE_EQ(fun.Get_y(2.5), 27.5);
+    ASSERT_DOUBLE_EQ(fun.Get_y(1.5), 17.5);
+    ASSERT_DOUBLE_EQ(fun.Get_y(4), 30);
+}
+
+TEST(ChFunctionRecorderTest, lookup) {
+    // Non-uniformly spaced table
+    std::vector<double> xp;
+    std::vector<double> yp;
+    for (int i = 0; i < 200; i++) {
+        double x = i + 0.4 * std::sin(0.7 * i);
+        xp.push_back(x);
+        yp.push_back(std::cos(0.1 * x));
+    }
+
+    // Query points (unsorted, some outside the range)
+    ChVectorDynamic<> xq(500);
+    for (int k = 0; k < xq.size(); k++)
+        xq(k) = -5 + 210 * ChRandom();
+
+    for (int grid = 0; grid < 3; grid++) {
+        ChFunction_Recorder fun;
+        for (int i = 199; i >= 0; i--)
+            fun.AddPoint(xp[i], yp[i]);
+        if (grid > 0)
+            fun.EnableGridIndex(true, grid == 1 ? 0 : 17);
+
+        for (int k = 0; k < xq.size(); k++)
+            ASSERT_NEAR(fun.Get_y(xq(k)), Interpolate(xp, yp, xq(k)), 1e-12);
+
+        // Batch evaluation, at unsorted and sorted points
+        ChVectorDynamic<> yq;
+        fun.Get_y(xq, yq);
+        for (int k = 0; k < xq.size(); k++)
+            ASSERT_NEAR(yq(k), Interpolate(xp, yp, xq(k)), 1e-12);
+
+        ChVectorDynamic<> xs = xq;
+        std::sort(xs.data(), xs.data() + xs.size());
+        fun.Get_y(xs, yq);
+        for (int k = 0; k < xs.size(); k++)
+            ASSERT_NEAR(yq(k), Interpolate(xp, yp, xs(k)), 1e-12);
+
+        // Evaluation at the table points
+        for (size_t i = 0; i < xp.size(); i++)
+            ASSERT_NEAR(fun.Get_y(xp[i]), yp[i], 1e-12);
+    }
+}
@@ -0,0 +1,114 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Unit test for the closest-point queries on ChBezierCurve
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono/core/ChBezierCurve.h"
+#include "chrono/core/ChMathematics.h"
+
+using namespace chrono;
+
+// Spiral path with several loops
+static std::shared_ptr<ChBezierCurve> CreatePath(int num_points) {
+    std::vector<ChVector<>> points;
+    for (int i = 0; i < num_points; i++) {
+        double a = 0.02 * i;
+        double r = 50 + 0.1 * i;
+        points.push_back(ChVector<>(r * std::cos(a), r * std::sin(a), 0.5 * std::sin(0.1 * i)));
+    }
+    return chrono_types::make_shared<ChBezierCurve>(points);
+}
+
+// Brute-force closest distance, by dense sampling of all intervals
+static double ClosestDistance(const ChBezierCurve& path, const ChVector<>& loc) {
+    double d2 = 1e30;
+    for (size_t i = 0; i < path.getNumPoints() - 1; i++) {
+        for (int k = 0; k <= 100; k++)
+            d2 = std::min(d2, (path.eval(i, k / 100.0) - loc).Length2());
+    }
+    return std::sqrt(d2);
+}
+
+TEST(ChBezierCurveTest, closest_point) {
+    auto path = CreatePath(2000);
+
+    std::vector<ChVector<>> locs;
+    for (int k = 0; k < 50; k++)
+        locs.push_back(ChVector<>(300 * (ChRandom() - 0.5), 300 * (ChRandom() - 0.5), 10 * (ChRandom() - 0.5)));
+
+    std::vector<size_t> intervals;
+    std::vector<double> params;
+    std::vector<ChVector<>> points;
+    path->findClosestPoints(locs, intervals, params, points, 4);
+
+    for (size_t k = 0; k < locs.size(); k++) {
+        size_t i;
+        double t;
+        ChVector<> point;
+        ASSERT_TRUE(path->findClosestPoint(locs[k], i, t, point));
+        ASSERT_EQ(i, intervals[k]);
+        ASSERT_EQ(t, params[k]);
+        ASSERT_EQ(point, points[k]);
+        ASSERT_NEAR((path->eval(i, t) - point).Length(), 0, 1e-12);
+
+        // The point found must not be farther than the best sampled point
+        double dist = (point - locs[k]).Length();
+        ASSERT_LT(dist, ClosestDistance(*path, locs[k]) + 1e-6);
+
+        // No points closer than the closest one
+        ASSERT_FALSE(path->findClosestPoint(locs[k], i, t, point, 0.99 * dist));
+    }
+}
+
+TEST(ChBezierCurveTest, tracker) {
+    auto path = CreatePath(2000);
+    ChBezierCurveTracker tracker(path);
+
+    // Start on the innermost loop, then jump to a location close to the outer loop
+    ChVector<> loc1 = path->eval(100, 0.3) + ChVector<>(0.2, 0, 0);
+    ChVector<> loc2 = path->eval(1800, 0.6) + ChVector<>(0, 0.2, 0);
+
+    ChVector<> point;
+    tracker.reset(loc1);
+    tracker.calcClosestPoint(loc1, point);
+    ASSERT_LT((point - loc1).Length(), ClosestDistance(*path, loc1) + 1e-6);
+
+    // Without re-acquisition, the tracker follows the path locally and cannot reach the outer loop
+    tracker.calcClosestPoint(loc2, point);
+    ASSERT_GT((point - loc2).Length(), 10.0);
+
+    // With re-acquisition, the tracker jumps to the closest part of the path
+    tracker.setReacquireTolerance(1.0);
+    tracker.calcClosestPoint(loc2, point);
+    ASSERT_LT((point - loc2).Length(), ClosestDistance(*path, loc2) + 1e-6);
+}
+
+TEST(ChBezierCurveTest, empty_path) {
+    auto path = chrono_types::make_shared<ChBezierCurve>();
+
+    size_t i = 7;
+    double t = 0.5;
+    ChVector<> point;
+    ASSERT_FALSE(path->findClosestPoint(ChVector<>(1, 2, 3), i, t, point));
+
+    // Resetting a tracker on a path without intervals falls back to the start of the path
+    ChBezierCurveTracker tracker(path);
+    tracker.reset(ChVector<>(1, 2, 3));
+}
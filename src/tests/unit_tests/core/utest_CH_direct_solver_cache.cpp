@@ -0,0 +1,154 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Unit test for the sparsity pattern cache of direct sparse solvers.
+// A problem with stiffness blocks is solved repeatedly with a solver caching
+// the sparsity pattern and the assembly scatter map, and with a new solver
+// which assembles the matrix from scratch. The solutions must match after
+// changing the matrix values with the same pattern, after changing the pattern
+// with the same problem structure (a stiffness block connecting different
+// variables), and after adding a stiffness block.
+//
+// =============================================================================
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChKblockGeneric.h"
+#include "chrono/solver/ChSystemDescriptor.h"
+#include "chrono/solver/ChVariablesGeneric.h"
+
+using namespace chrono;
+
+// Sparse LU solver reporting whether the cached sparsity pattern was reused at the last Setup.
+class CachingSolver : public ChSolverSparseLU {
+  public:
+    CachingSolver() { CacheSparsityPattern(true); }
+    bool PatternReused() const { return !m_pattern_changed; }
+};
+
+class DirectSolverCacheTest : public ::testing::Test {
+  protected:
+    DirectSolverCacheTest();
+
+    // Add a stiffness block connecting the specified variables.
+    void AddKblock(int i, int j);
+
+    // Insert all variables and stiffness blocks in the system descriptor.
+    void Rebuild();
+
+    // Set the stiffness block values and the variable forces (depending on the given seed).
+    void SetValues(double seed);
+
+    // Solve with the caching solver and with a new solver, and compare the solutions.
+    void Compare(bool expect_reuse);
+
+    ChSystemDescriptor descriptor;
+    std::vector<std::unique_ptr<ChVariablesGeneric>> variables;
+    std::vector<std::unique_ptr<ChKblockGeneric>> kblocks;
+    CachingSolver solver;
+};
+
+DirectSolverCacheTest::DirectSolverCacheTest() {
+    for (int i = 0; i < 10; i++) {
+        variables.push_back(std::unique_ptr<ChVariablesGeneric>(new ChVariablesGeneric(3)));
+        variables.back()->GetMass().setIdentity();
+        variables.back()->GetMass() *= 10;
+        variables.back()->GetInvMass().setIdentity();
+        variables.back()->GetInvMass() *= 0.1;
+    }
+    for (int i = 0; i < 9; i++)
+        AddKblock(i, i + 1);
+    Rebuild();
+}
+
+void DirectSolverCacheTest::AddKblock(int i, int j) {
+    kblocks.push_back(std::unique_ptr<ChKblockGeneric>(new ChKblockGeneric));
+    kblocks.back()->SetVariables({variables[i].get(), variables[j].get()});
+}
+
+void DirectSolverCacheTest::Rebuild() {
+    descriptor.BeginInsertion();
+    for (auto& v : variables)
+        descriptor.InsertVariables(v.get());
+    for (auto& k : kblocks)
+        descriptor.InsertKblock(k.get());
+    descriptor.EndInsertion();
+}
+
+void DirectSolverCacheTest::SetValues(double seed) {
+    for (size_t k = 0; k < kblocks.size(); k++) {
+        auto K = kblocks[k]->Get_K();
+        for (int r = 0; r < K.rows(); r++) {
+            for (int c = 0; c <= r; c++) {
+                K(r, c) = 0.1 * std::sin(seed + k + 2.0 * r + 3.0 * c);
+                K(c, r) = K(r, c);
+            }
+        }
+    }
+    for (size_t i = 0; i < variables.size(); i++) {
+        for (int j = 0; j < 3; j++)
+            variables[i]->Get_fb()(j) = std::cos(seed + 3.0 * i + j);
+    }
+}
+
+void DirectSolverCacheTest::Compare(bool expect_reuse) {
+    ChVectorDynamic<> x_cached;
+    ASSERT_TRUE(solver.Setup(descriptor));
+    solver.Solve(descriptor);
+    descriptor.FromUnknownsToVector(x_cached);
+    ASSERT_EQ(solver.PatternReused(), expect_reuse);
+
+    ChVectorDynamic<> x_ref;
+    ChSolverSparseLU solver_ref;
+    ASSERT_TRUE(solver_ref.Setup(descriptor));
+    solver_ref.Solve(descriptor);
+    descriptor.FromUnknownsToVector(x_ref);
+
+    ASSERT_EQ(x_cached.size(), x_ref.size());
+    ASSERT_GT(x_ref.norm(), 0);
+    ASSERT_LT((x_cached - x_ref).norm(), 1e-12 * x_ref.norm());
+}
+
+TEST_F(DirectSolverCacheTest, values_and_pattern) {
+    // First call records the sparsity pattern and the scatter map
+    SetValues(1);
+    Compare(false);
+
+    // New values, same sparsity pattern: the cache is reused
+    SetValues(2);
+    Compare(true);
+    SetValues(3);
+    Compare(true);
+
+    // Stiffness block connecting different variables (same problem structure): the cache must be rebuilt
+    kblocks[0]->SetVariables({variables[0].get(), variables[5].get()});
+    descriptor.UpdateCountsAndOffsets();
+    SetValues(4);
+    Compare(false);
+    SetValues(5);
+    Compare(true);
+
+    // Additional stiffness block (new problem structure): the cache must be rebuilt
+    AddKblock(2, 7);
+    Rebuild();
+    SetValues(6);
+    Compare(false);
+    SetValues(7);
+    Compare(true);
+}
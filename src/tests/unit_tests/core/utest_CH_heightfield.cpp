@@ -0,0 +1,222 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Tests for the height-field geometry and the height-field collision shape.
+//
+// =============================================================================
+
+#include <cmath>
+#include <functional>
+#include <limits>
+
+#include "gtest/gtest.h"
+
+#include "chrono/collision/ChCollisionSystem.h"
+#include "chrono/core/ChMathematics.h"
+#include "chrono/geometry/ChHeightField.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+using namespace chrono::geometry;
+
+const int nx = 41;
+const int ny = 31;
+const double size_x = 8;
+const double size_y = 6;
+
+// Height field with the node heights given by the specified function
+ChHeightField CreateHeightField(std::function<double(double, double)> f) {
+    std::vector<double> heights(nx * ny);
+    for (int j = 0; j < ny; j++) {
+        for (int i = 0; i < nx; i++) {
+            double x = i * size_x / (nx - 1) - size_x / 2;
+            double y = j * size_y / (ny - 1) - size_y / 2;
+            heights[i + nx * j] = f(x, y);
+        }
+    }
+    return ChHeightField(nx, ny, size_x, size_y, heights);
+}
+
+double Bumps(double x, double y) {
+    return 0.3 * std::sin(1.3 * x) * std::cos(0.7 * y) + 0.1 * std::sin(5.0 * x + 3.0 * y);
+}
+
+// Intersection of a segment with the height field, testing all triangles
+bool RayHitAll(const ChHeightField& hf, const ChVector<>& from, const ChVector<>& to, double& fraction) {
+    ChVector<> dir = to - from;
+    bool hit = false;
+    fraction = std::numeric_limits<double>::max();
+    for (int j = 0; j < ny - 1; j++) {
+        for (int i = 0; i < nx - 1; i++) {
+            ChVector<> v[4] = {hf.GetVertex(i, j), hf.GetVertex(i + 1, j), hf.GetVertex(i + 1, j + 1),
+                               hf.GetVertex(i, j + 1)};
+            for (int k = 0; k < 2; k++) {
+                const ChVector<>& v0 = v[0];
+                const ChVector<>& v1 = v[1 + k];
+                const ChVector<>& v2 = v[2 + k];
+                ChMatrix33<> A;
+                A.Set_A_axis(v1 - v0, v2 - v0, -dir);
+                // barycentric coordinates and segment parameter
+                ChVector<> sol = ChMatrix33<>(A.inverse()) * (from - v0);
+                if (sol.x() >= 0 && sol.y() >= 0 && sol.x() + sol.y() <= 1 && sol.z() >= 0 && sol.z() <= 1 &&
+                    sol.z() < fraction) {
+                    fraction = sol.z();
+                    hit = true;
+                }
+            }
+        }
+    }
+    return hit;
+}
+
+TEST(ChHeightField, plane) {
+    auto hf = CreateHeightField([](double x, double y) { return 0.2 * x - 0.1 * y + 1; });
+    ASSERT_NEAR(hf.GetSpacingX(), 0.2, 1e-12);
+    ASSERT_NEAR(hf.GetMinHeight(), 1 - 0.8 - 0.3, 1e-12);
+    ASSERT_NEAR(hf.GetMaxHeight(), 1 + 0.8 + 0.3, 1e-12);
+
+    ChVector<> n_exact = ChVector<>(-0.2, 0.1, 1).GetNormalized();
+    for (int k = 0; k < 100; k++) {
+        double x = (ChRandom() - 0.5) * size_x;
+        double y = (ChRandom() - 0.5) * size_y;
+        double h;
+        ChVector<> n;
+        ASSERT_TRUE(hf.GetHeight(x, y, h, n));
+        ASSERT_NEAR(h, 0.2 * x - 0.1 * y + 1, 1e-12);
+        ASSERT_NEAR((n - n_exact).Length(), 0, 1e-12);
+    }
+
+    // Points on the grid boundary are inside, points beyond are outside
+    double h;
+    ChVector<> n;
+    ASSERT_TRUE(hf.GetHeight(size_x / 2, size_y / 2, h, n));
+    ASSERT_NEAR(h, 0.2 * size_x / 2 - 0.1 * size_y / 2 + 1, 1e-12);
+    ASSERT_FALSE(hf.GetHeight(size_x / 2 + 1e-6, 0, h, n));
+    ASSERT_FALSE(hf.GetHeight(0, -size_y / 2 - 1e-6, h, n));
+}
+
+TEST(ChHeightField, queries) {
+    auto hf = CreateHeightField(Bumps);
+
+    // Vertical rays hit the surface at the interpolated height
+    for (int k = 0; k < 200; k++) {
+        double x = (ChRandom() - 0.5) * size_x;
+        double y = (ChRandom() - 0.5) * size_y;
+        double h;
+        ChVector<> n;
+        ASSERT_TRUE(hf.GetHeight(x, y, h, n));
+        ASSERT_GT(n.z(), 0);
+
+        ChVector<> point;
+        ChVector<> normal;
+        double fraction;
+        ASSERT_TRUE(hf.RayHit(ChVector<>(x, y, 10), ChVector<>(x, y, -10), point, normal, fraction));
+        ASSERT_NEAR(point.z(), h, 1e-10);
+        ASSERT_NEAR((normal - n).Length(), 0, 1e-10);
+    }
+
+    // Slanted rays (possibly starting or ending outside the grid) find the closest intersection
+    int num_hits = 0;
+    for (int k = 0; k < 200; k++) {
+        ChVector<> from((ChRandom() - 0.5) * 1.5 * size_x, (ChRandom() - 0.5) * 1.5 * size_y, 0.5 + ChRandom());
+        ChVector<> to((ChRandom() - 0.5) * 1.5 * size_x, (ChRandom() - 0.5) * 1.5 * size_y, -0.5 - ChRandom());
+        ChVector<> point;
+        ChVector<> normal;
+        double fraction;
+        double fraction_all;
+        bool hit = hf.RayHit(from, to, point, normal, fraction);
+        bool hit_all = RayHitAll(hf, from, to, fraction_all);
+        ASSERT_EQ(hit, hit_all);
+        if (hit) {
+            ASSERT_NEAR(fraction, fraction_all, 1e-10);
+            ASSERT_NEAR((point - (from + fraction * (to - from))).Length(), 0, 1e-10);
+            num_hits++;
+        }
+    }
+    ASSERT_GT(num_hits, 0);
+
+    // Rays missing the grid
+    ChVector<> point;
+    ChVector<> normal;
+    double fraction;
+    ASSERT_FALSE(hf.RayHit(ChVector<>(size_x, 0, 1), ChVector<>(size_x, 0, -1), point, normal, fraction));
+    ASSERT_FALSE(hf.RayHit(ChVector<>(0, 0, 10), ChVector<>(0, 0, 5), point, normal, fraction));
+}
+
+// Create a fixed body with a height-field collision shape
+std::shared_ptr<ChBody> CreateGround(ChSystem& system,
+                                     std::shared_ptr<ChHeightField> hf,
+                                     std::shared_ptr<ChMaterialSurface> material,
+                                     double envelope) {
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->SetEnvelope(envelope);
+    ground->GetCollisionModel()->ClearModel();
+    EXPECT_TRUE(ground->GetCollisionModel()->AddHeightField(material, hf));
+    ground->GetCollisionModel()->BuildModel();
+    system.AddBody(ground);
+    return ground;
+}
+
+TEST(ChHeightField, rayhit) {
+    ChSystemNSC system;
+    auto hf = chrono_types::make_shared<ChHeightField>(CreateHeightField(Bumps));
+    auto material = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    CreateGround(system, hf, material, 0);
+
+    // Ray casting in the collision system
+    for (int k = 0; k < 50; k++) {
+        double x = (ChRandom() - 0.5) * size_x;
+        double y = (ChRandom() - 0.5) * size_y;
+        double h;
+        ChVector<> n;
+        ASSERT_TRUE(hf->GetHeight(x, y, h, n));
+
+        collision::ChCollisionSystem::ChRayhitResult result;
+        system.GetCollisionSystem()->RayHit(ChVector<>(x, y, 10), ChVector<>(x, y, -10), result);
+        ASSERT_TRUE(result.hit);
+        ASSERT_NEAR(result.abs_hitPoint.z(), h, 1e-4);
+        ASSERT_NEAR((result.abs_hitNormal - n).Length(), 0, 1e-4);
+    }
+}
+
+TEST(ChHeightField, collision) {
+    ChSystemNSC system;
+    system.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto hf = chrono_types::make_shared<ChHeightField>(CreateHeightField(Bumps));
+    auto material = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    material->SetFriction(0.8f);
+    CreateGround(system, hf, material, 0.03);
+
+    // A box dropped on the surface comes to rest on it
+    double hx = 0.2;
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(2 * hx, 2 * hx, 2 * hx, 1000, true, true, material);
+    box->SetPos(ChVector<>(1.1, -0.4, 1.5));
+    system.AddBody(box);
+
+    while (system.GetChTime() < 2)
+        system.DoStepDynamics(1e-3);
+
+    ASSERT_GT(system.GetNcontacts(), 0);
+    ASSERT_LT(std::abs(box->GetPos_dt().z()), 0.05);
+
+    double h;
+    ChVector<> n;
+    ASSERT_TRUE(hf->GetHeight(box->GetPos().x(), box->GetPos().y(), h, n));
+    ASSERT_GT(box->GetPos().z() - h, 0.5 * hx);
+    ASSERT_LT(box->GetPos().z() - h, 2 * hx);
+}
@@ -0,0 +1,124 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Unit test for the tracing profiler: zones recorded concurrently by several
+// threads are exported to the per-step CSV summary and to the Chrome trace.
+//
+// =============================================================================
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/utils/ChTraceProfiler.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+static void RecordZones(int num_zones) {
+    for (int i = 0; i < num_zones; i++) {
+        CH_TRACE_ZONE("outer");
+        {
+            CH_TRACE_ZONE("inner");
+        }
+    }
+}
+
+TEST(ChTraceProfiler, export) {
+    const int num_threads = 4;
+    const int num_zones = 100;
+
+    ASSERT_TRUE(ChTraceProfiler::SetOutputCSV("trace_profiler.csv"));
+    ASSERT_TRUE(ChTraceProfiler::SetOutputChromeTrace("trace_profiler.json"));
+
+    // Zones are not recorded while tracing is disabled
+    RecordZones(num_zones);
+    ChTraceProfiler::Enable(true);
+    ChTraceProfiler::EndStep(0, 0.0);
+
+    // Record zones from several threads in each of two steps
+    for (unsigned int step = 1; step <= 2; step++) {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < num_threads; i++)
+            threads.push_back(std::thread(RecordZones, num_zones));
+        for (auto& t : threads)
+            t.join();
+        ChTraceProfiler::EndStep(step, step * 0.1);
+    }
+
+    ChTraceProfiler::Enable(false);
+    ChTraceProfiler::Close();
+    ASSERT_EQ(ChTraceProfiler::GetNumDropped(), size_t(0));
+
+    // Check the per-step CSV summary
+    std::ifstream csv("trace_profiler.csv");
+    std::string line;
+    std::getline(csv, line);
+    ASSERT_EQ(line, "step,time,zone,calls,total_ms,max_ms");
+    int num_lines = 0;
+    while (std::getline(csv, line)) {
+        std::istringstream iss(line);
+        std::string step, time, zone, calls;
+        std::getline(iss, step, ',');
+        std::getline(iss, time, ',');
+        std::getline(iss, zone, ',');
+        std::getline(iss, calls, ',');
+        ASSERT_TRUE(step == "1" || step == "2");
+        ASSERT_TRUE(zone == "inner" || zone == "outer");
+        ASSERT_EQ(std::stoi(calls), num_threads * num_zones);
+        num_lines++;
+    }
+    ASSERT_EQ(num_lines, 4);
+
+    // Check the number of events in the Chrome trace (all zones and the two step markers)
+    std::ifstream json("trace_profiler.json");
+    std::stringstream buffer;
+    buffer << json.rdbuf();
+    std::string trace = buffer.str();
+    int num_events = 0;
+    for (size_t pos = trace.find("\"ph\":"); pos != std::string::npos; pos = trace.find("\"ph\":", pos + 1))
+        num_events++;
+    ASSERT_EQ(num_events, 2 * 2 * num_threads * num_zones + 3);
+    ASSERT_EQ(trace.substr(trace.size() - 4), "\n]}\n");
+}
+
+TEST(ChTraceProfiler, escaping) {
+    ASSERT_TRUE(ChTraceProfiler::SetOutputCSV("trace_profiler_esc.csv"));
+    ASSERT_TRUE(ChTraceProfiler::SetOutputChromeTrace("trace_profiler_esc.json"));
+
+    ChTraceProfiler::Enable(true);
+    {
+        CH_TRACE_ZONE("zone \"a\", b\\c");
+    }
+    ChTraceProfiler::EndStep(1, 0.5);
+    ChTraceProfiler::Enable(false);
+    ChTraceProfiler::Close();
+
+    // The zone name is quoted in the CSV file, with embedded quotes doubled
+    std::ifstream csv("trace_profiler_esc.csv");
+    std::string line;
+    std::getline(csv, line);
+    std::getline(csv, line);
+    ASSERT_EQ(line.substr(0, 26), "1,0.5,\"zone \"\"a\"\", b\\c\",1,");
+
+    // Quotes and backslashes are escaped in the Chrome trace
+    std::ifstream json("trace_profiler_esc.json");
+    std::stringstream buffer;
+    buffer << json.rdbuf();
+    ASSERT_NE(buffer.str().find("\"name\":\"zone \\\"a\\\", b\\\\c\""), std::string::npos);
+}
@@ -0,0 +1,186 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Tests for the connectivity utilities and the binary mesh files of
+// ChTriangleMeshConnected.
+//
+// =============================================================================
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+using namespace chrono;
+using namespace chrono::geometry;
+
+const int n = 20;
+
+// Triangulated n x n grid, with all triangles disconnected (each triangle has its own 3 vertexes)
+ChTriangleMeshConnected DisconnectedGrid() {
+    ChTriangleMeshConnected mesh;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            ChVector<> p00(i, j, 0.01 * i * j);
+            ChVector<> p10(i + 1, j, 0.01 * (i + 1) * j);
+            ChVector<> p01(i, j + 1, 0.01 * i * (j + 1));
+            ChVector<> p11(i + 1, j + 1, 0.01 * (i + 1) * (j + 1));
+            mesh.addTriangle(p00, p10, p11);
+            mesh.addTriangle(p00, p11, p01);
+        }
+    }
+    return mesh;
+}
+
+// Reference (quadratic) implementation of the vertex merging
+std::vector<int> MergeReference(const std::vector<ChVector<>>& vertices, double tolerance) {
+    std::vector<ChVector<>> processed;
+    std::vector<int> new_indexes(vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        new_indexes[i] = -1;
+        for (size_t j = 0; j < processed.size(); j++) {
+            if ((vertices[i] - processed[j]).Length2() < tolerance) {
+                new_indexes[i] = (int)j;
+                break;
+            }
+        }
+        if (new_indexes[i] < 0) {
+            processed.push_back(vertices[i]);
+            new_indexes[i] = (int)processed.size() - 1;
+        }
+    }
+    return new_indexes;
+}
+
+TEST(ChTriangleMeshConnected, repair) {
+    auto mesh = DisconnectedGrid();
+    // Perturb the vertexes (below the merge distance)
+    for (size_t i = 0; i < mesh.m_vertices.size(); i++)
+        mesh.m_vertices[i] += ChVector<>(1e-5 * std::sin(1.0 * i), 1e-5 * std::cos(2.0 * i), 0);
+
+    auto faces = mesh.m_face_v_indices;
+    auto new_indexes = MergeReference(mesh.m_vertices, 1e-8);
+
+    int nmerged = mesh.RepairDuplicateVertexes(1e-8);
+    ASSERT_EQ(nmerged, 6 * n * n - (n + 1) * (n + 1));
+    ASSERT_EQ(mesh.m_vertices.size(), (n + 1) * (n + 1));
+    for (size_t i = 0; i < faces.size(); i++) {
+        ASSERT_EQ(mesh.m_face_v_indices[i].x(), new_indexes[faces[i].x()]);
+        ASSERT_EQ(mesh.m_face_v_indices[i].y(), new_indexes[faces[i].y()]);
+        ASSERT_EQ(mesh.m_face_v_indices[i].z(), new_indexes[faces[i].z()]);
+    }
+
+    // With the default tolerance, only coincident vertexes are merged
+    auto mesh2 = DisconnectedGrid();
+    mesh2.m_vertices[0] += ChVector<>(1e-5, 0, 0);
+    ASSERT_EQ(mesh2.RepairDuplicateVertexes(), 6 * n * n - (n + 1) * (n + 1) - 1);
+}
+
+TEST(ChTriangleMeshConnected, connectivity) {
+    auto mesh = DisconnectedGrid();
+    mesh.RepairDuplicateVertexes();
+
+    // Neighbor map: only the sides on the grid boundary are free
+    std::vector<std::array<int, 4>> tri_map;
+    ASSERT_FALSE(mesh.ComputeNeighbouringTriangleMap(tri_map));
+    ASSERT_EQ(tri_map.size(), 2 * n * n);
+    int num_free = 0;
+    for (int it = 0; it < (int)tri_map.size(); it++) {
+        ASSERT_EQ(tri_map[it][0], it);
+        for (int ie = 1; ie < 4; ie++) {
+            if (tri_map[it][ie] == -1) {
+                num_free++;
+                continue;
+            }
+            // The neighbor must list this triangle as one of its neighbors
+            const auto& nbr = tri_map[tri_map[it][ie]];
+            ASSERT_TRUE(nbr[1] == it || nbr[2] == it || nbr[3] == it);
+        }
+    }
+    ASSERT_EQ(num_free, 4 * n);
+
+    // Winged edges
+    std::map<std::pair<int, int>, std::pair<int, int>> winged_edges;
+    ASSERT_FALSE(mesh.ComputeWingedEdges(winged_edges, true));
+    ASSERT_EQ(winged_edges.size(), 2 * n * (n + 1) + n * n);
+    winged_edges.clear();
+    ASSERT_FALSE(mesh.ComputeWingedEdges(winged_edges, false));
+    ASSERT_EQ(winged_edges.size(), 2 * n * (n + 1) + n * n - 4 * n);
+    for (const auto& e : winged_edges) {
+        ASSERT_LT(e.first.first, e.first.second);
+        ASSERT_NE(e.second.second, -1);
+    }
+
+    // An interior edge shared by three triangles
+    mesh.m_vertices.push_back(ChVector<>(0.5, 0.5, 1));
+    auto face = mesh.m_face_v_indices[0];
+    mesh.m_face_v_indices.push_back(ChVector<int>(face.y(), face.z(), (int)mesh.m_vertices.size() - 1));
+    ASSERT_TRUE(mesh.ComputeNeighbouringTriangleMap(tri_map));
+    winged_edges.clear();
+    ASSERT_TRUE(mesh.ComputeWingedEdges(winged_edges, true));
+}
+
+TEST(ChTriangleMeshConnected, binary_cache) {
+    auto mesh = DisconnectedGrid();
+    mesh.RepairDuplicateVertexes();
+    mesh.m_colors.push_back(ChVector<float>(1, 0, 0));
+
+    // Binary mesh files
+    ASSERT_TRUE(mesh.WriteBinaryMesh("utest_trimesh.chmesh", 42));
+    ChTriangleMeshConnected mesh_bin;
+    ASSERT_FALSE(mesh_bin.LoadBinaryMesh("utest_trimesh.chmesh", 43));
+    ASSERT_TRUE(mesh_bin.LoadBinaryMesh("utest_trimesh.chmesh", 42));
+    ASSERT_EQ(mesh_bin.m_vertices, mesh.m_vertices);
+    ASSERT_EQ(mesh_bin.m_colors, mesh.m_colors);
+    ASSERT_EQ(mesh_bin.m_face_v_indices, mesh.m_face_v_indices);
+    ASSERT_TRUE(mesh_bin.m_normals.empty());
+
+    // Cached OBJ loading
+    std::vector<ChTriangleMeshConnected> meshes = {mesh};
+    ChTriangleMeshConnected::WriteWavefront("utest_trimesh.obj", meshes);
+    std::remove("utest_trimesh.obj.chmesh");
+
+    ChTriangleMeshConnected mesh_obj;
+    ASSERT_TRUE(mesh_obj.LoadWavefrontMesh("utest_trimesh.obj", false, false));
+
+    ChTriangleMeshConnected mesh1;
+    ASSERT_TRUE(mesh1.LoadWavefrontMeshCached("utest_trimesh.obj", false, false));
+    ASSERT_TRUE(std::ifstream("utest_trimesh.obj.chmesh").good());
+    ChTriangleMeshConnected mesh2;
+    ASSERT_TRUE(mesh2.LoadWavefrontMeshCached("utest_trimesh.obj", false, false));
+    ASSERT_EQ(mesh2.GetFileName(), "utest_trimesh.obj");
+    ASSERT_EQ(mesh1.m_vertices, mesh_obj.m_vertices);
+    ASSERT_EQ(mesh2.m_vertices, mesh_obj.m_vertices);
+    ASSERT_EQ(mesh2.m_face_v_indices, mesh_obj.m_face_v_indices);
+
+    // A modified OBJ file invalidates the cache
+    {
+        std::ofstream obj("utest_trimesh.obj", std::ios::app);
+        obj << "v 100 100 100" << std::endl;
+    }
+    ChTriangleMeshConnected mesh3;
+    ASSERT_TRUE(mesh3.LoadWavefrontMeshCached("utest_trimesh.obj", false, false));
+    ASSERT_EQ(mesh3.m_vertices.size(), mesh_obj.m_vertices.size() + 1);
+
+    // A truncated binary mesh file is rejected
+    std::ofstream("utest_trimesh.chmesh", std::ios::binary) << "CHMESH";
+    ASSERT_FALSE(mesh_bin.LoadBinaryMesh("utest_trimesh.chmesh", 42));
+
+    std::remove("utest_trimesh.chmesh");
+    std::remove("utest_trimesh.obj");
+    std::remove("utest_trimesh.obj.chmesh");
+}
@@ -0,0 +1,157 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Test for the batched evaluation of ANCF shell element internal forces.
+// Two identical meshes of ANCF shell elements (with different numbers of
+// layers, fiber angles, and structural damping) are simulated, one with and
+// one without element batching. The internal forces for a deformed
+// configuration and the nodal positions after a number of steps must match.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/fea/ChElementShellANCF.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+const int num_x = 6;             // number of elements in x direction
+const int num_y = 2;             // number of elements in y direction
+const double tol_force = 1e-10;  // relative tolerance for internal forces
+const double tol_pos = 1e-10;    // tolerance for node positions
+
+// Create a system with a plate of ANCF shell elements, fixed along one edge.
+ChSystemSMC* CreateSystem(bool batching, std::shared_ptr<ChMesh>& mesh) {
+    auto sys = new ChSystemSMC;
+    sys->Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto solver = chrono_types::make_shared<ChSolverSparseQR>();
+    sys->SetSolver(solver);
+
+    mesh = chrono_types::make_shared<ChMesh>();
+    mesh->SetElementBatching(batching);
+    sys->Add(mesh);
+
+    auto mat1 = chrono_types::make_shared<ChMaterialShellANCF>(500, 2.1e7, 0.3);
+    auto mat2 = chrono_types::make_shared<ChMaterialShellANCF>(1000, ChVector<>(1e7, 5e6, 5e6),
+                                                               ChVector<>(0.3, 0.3, 0.3),
+                                                               ChVector<>(3e6, 3e6, 3e6));
+
+    double dx = 1.0 / num_x;
+    double dy = 0.5 / num_y;
+
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    for (int j = 0; j <= num_y; j++) {
+        for (int i = 0; i <= num_x; i++) {
+            auto node = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(i * dx, j * dy, 0), ChVector<>(0, 0, 1));
+            node->SetFixed(i == 0);
+            mesh->AddNode(node);
+            nodes.push_back(node);
+        }
+    }
+
+    for (int j = 0; j < num_y; j++) {
+        for (int i = 0; i < num_x; i++) {
+            int k = j * (num_x + 1) + i;
+            int e = j * num_x + i;
+            auto element = chrono_types::make_shared<ChElementShellANCF>();
+            element->SetNodes(nodes[k], nodes[k + 1], nodes[k + num_x + 2], nodes[k + num_x + 1]);
+            element->SetDimensions(dx, dy);
+            // Elements with 1, 2, or 3 layers
+            element->AddLayer(0.01, 0, mat1);
+            if (e % 3 > 0)
+                element->AddLayer(0.005, 30 * CH_C_DEG_TO_RAD, mat2);
+            if (e % 3 > 1)
+                element->AddLayer(0.005, -45 * CH_C_DEG_TO_RAD, mat1);
+            element->SetAlphaDamp(0.01 * (e % 2));
+            element->SetGravityOn(e % 2 == 0);
+            mesh->AddElement(element);
+        }
+    }
+
+    sys->SetTimestepperType(ChTimestepper::Type::HHT);
+    auto stepper = std::static_pointer_cast<ChTimestepperHHT>(sys->GetTimestepper());
+    stepper->SetAlpha(0.0);
+    stepper->SetMaxiters(100);
+    stepper->SetAbsTolerances(1e-08);
+    stepper->SetMode(ChTimestepperHHT::POSITION);
+    stepper->SetScaling(false);
+    sys->DoFullAssembly();
+
+    return sys;
+}
+
+// Perturb the node states of the given mesh.
+void Deform(std::shared_ptr<ChMesh> mesh) {
+    for (unsigned int i = 0; i < mesh->GetNnodes(); i++) {
+        auto node = std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh->GetNode(i));
+        if (node->GetFixed())
+            continue;
+        node->SetPos(node->GetPos() + 0.001 * ChVector<>(std::sin(i), std::cos(2.0 * i), std::sin(3.0 * i)));
+        node->SetD((node->GetD() + 0.005 * ChVector<>(std::cos(i), std::sin(i), 0)).GetNormalized());
+        node->SetPos_dt(ChVector<>(0.1 * std::cos(i), 0.2 * std::sin(i), 0.3));
+        node->SetD_dt(ChVector<>(0.01, 0.02 * std::cos(i), 0));
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::shared_ptr<ChMesh> mesh_s;
+    std::shared_ptr<ChMesh> mesh_b;
+    ChSystemSMC* sys_s = CreateSystem(false, mesh_s);
+    ChSystemSMC* sys_b = CreateSystem(true, mesh_b);
+
+    bool passed = true;
+
+    // Compare internal forces in a deformed configuration (two consecutive evaluations, to also check the EAS
+    // parameters cached in the elements)
+    Deform(mesh_s);
+    Deform(mesh_b);
+    for (int k = 0; k < 2; k++) {
+        int n = sys_s->GetNcoords_w();
+        ChVectorDynamic<> R_s = ChVectorDynamic<>::Zero(n);
+        ChVectorDynamic<> R_b = ChVectorDynamic<>::Zero(n);
+        mesh_s->IntLoadResidual_F(mesh_s->GetOffset_w(), R_s, 1.0);
+        mesh_b->IntLoadResidual_F(mesh_b->GetOffset_w(), R_b, 1.0);
+
+        double err = (R_b - R_s).lpNorm<Eigen::Infinity>() / R_s.lpNorm<Eigen::Infinity>();
+        std::cout << "Internal forces, evaluation " << k << "   relative error: " << err << std::endl;
+        passed &= (err < tol_force);
+    }
+
+    // Compare node positions after a number of steps
+    for (int i = 0; i < 20; i++) {
+        sys_s->DoStepDynamics(1e-3);
+        sys_b->DoStepDynamics(1e-3);
+    }
+
+    double err = 0;
+    for (unsigned int i = 0; i < mesh_s->GetNnodes(); i++) {
+        auto node_s = std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh_s->GetNode(i));
+        auto node_b = std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh_b->GetNode(i));
+        err = std::max(err, (node_b->GetPos() - node_s->GetPos()).Length());
+    }
+    std::cout << "Node positions after 20 steps   max error: " << err << std::endl;
+    passed &= (err < tol_pos);
+
+    delete sys_s;
+    delete sys_b;
+
+    std::cout << (passed ? "PASSED" : "FAILED") << std::endl;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,161 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Test for the ChMesh element coloring.
+// The internal force, gravity, and mass-matrix residual contributions of a
+// plate of ANCF shell elements, loaded in parallel over the element colors,
+// are compared against the same quantities computed with a single thread.
+// The coloring must be refreshed after a change in the mesh topology, and
+// elements of the same color must never share a node.
+//
+// =============================================================================
+
+#include <cmath>
+#include <set>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/fea/ChElementShellANCF.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+const int num_elements = 8;      // number of elements in each direction
+const double tolerance = 1e-10;  // relative tolerance for residual comparison
+
+// Add a row of num_elements ANCF shell elements to the given mesh, with the bottom edge at y = j * dx.
+// Return the nodes on the top edge.
+std::vector<std::shared_ptr<ChNodeFEAxyzD>> AddRow(std::shared_ptr<ChMesh> mesh,
+                                                   const std::vector<std::shared_ptr<ChNodeFEAxyzD>>& bottom,
+                                                   int j) {
+    auto mat = chrono_types::make_shared<ChMaterialShellANCF>(500, 2.1e7, 0.3);
+    double dx = 1.0 / num_elements;
+
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> top;
+    for (int i = 0; i <= num_elements; i++) {
+        // Perturb the node positions so that the internal forces are not zero
+        ChVector<> pos(i * dx + 0.01 * std::sin(i + j), (j + 1) * dx, 0.01 * std::cos(i * j));
+        auto node = chrono_types::make_shared<ChNodeFEAxyzD>(pos, ChVector<>(0, 0, 1));
+        node->SetPos_dt(ChVector<>(0.1 * i, 0, 0.1 * j));
+        mesh->AddNode(node);
+        top.push_back(node);
+    }
+
+    for (int i = 0; i < num_elements; i++) {
+        auto element = chrono_types::make_shared<ChElementShellANCF>();
+        element->SetNodes(bottom[i], bottom[i + 1], top[i + 1], top[i]);
+        element->SetDimensions(dx, dx);
+        element->AddLayer(0.01, 0, mat);
+        element->SetAlphaDamp(0.05);
+        mesh->AddElement(element);
+    }
+
+    return top;
+}
+
+// Compare the mesh residual contributions evaluated with one and with multiple threads.
+bool CheckResiduals(ChSystemSMC& sys, std::shared_ptr<ChMesh> mesh) {
+    int n = sys.GetNcoords_w();
+    ChVectorDynamic<> w(n);
+    for (int i = 0; i < n; i++)
+        w(i) = std::sin(1.0 + i);
+
+    ChVectorDynamic<> R1 = ChVectorDynamic<>::Zero(n);
+    ChVectorDynamic<> R4 = ChVectorDynamic<>::Zero(n);
+
+    sys.SetNumThreads(1);
+    mesh->IntLoadResidual_F(mesh->GetOffset_w(), R1, 0.5);
+    mesh->IntLoadResidual_Mv(mesh->GetOffset_w(), R1, w, 2.0);
+
+    sys.SetNumThreads(4);
+    mesh->IntLoadResidual_F(mesh->GetOffset_w(), R4, 0.5);
+    mesh->IntLoadResidual_Mv(mesh->GetOffset_w(), R4, w, 2.0);
+
+    double err = (R4 - R1).lpNorm<Eigen::Infinity>() / R1.lpNorm<Eigen::Infinity>();
+    std::cout << "  elements: " << mesh->GetNelements() << "  colors: " << mesh->GetNumElementColors()
+              << "  relative error: " << err << std::endl;
+
+    return R1.lpNorm<Eigen::Infinity>() > 0 && err < tolerance;
+}
+
+// Check that the coloring has the expected number of colors, covers all elements, and that no two elements of the
+// same color share a node.
+bool CheckColoring(std::shared_ptr<ChMesh> mesh, unsigned int num_colors) {
+    if (mesh->GetNumElementColors() != num_colors)
+        return false;
+
+    size_t num_colored = 0;
+    for (unsigned int color = 0; color < num_colors; color++) {
+        std::set<ChNodeFEAbase*> nodes;
+        for (auto ie : mesh->GetElementColorGroup(color)) {
+            auto element = mesh->GetElement(ie);
+            for (int in = 0; in < element->GetNnodes(); in++) {
+                if (!nodes.insert(element->GetNodeN(in).get()).second) {
+                    std::cout << "  node shared by elements of color " << color << std::endl;
+                    return false;
+                }
+            }
+        }
+        num_colored += mesh->GetElementColorGroup(color).size();
+    }
+
+    return num_colored == mesh->GetNelements();
+}
+
+int main(int argc, char* argv[]) {
+    ChSystemSMC sys;
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseQR>());
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    // Create a plate of num_elements x num_elements shell elements, fixed along one edge
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    for (int i = 0; i <= num_elements; i++) {
+        auto node = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(i * 1.0 / num_elements, 0, 0),
+                                                              ChVector<>(0, 0, 1));
+        node->SetFixed(true);
+        mesh->AddNode(node);
+        nodes.push_back(node);
+    }
+    for (int j = 0; j < num_elements; j++)
+        nodes = AddRow(mesh, nodes, j);
+
+    sys.DoFullAssembly();
+
+    // A structured quadrilateral mesh requires exactly 4 colors with a row-major greedy coloring
+    std::cout << "Initial mesh" << std::endl;
+    bool passed = true;
+    passed &= CheckResiduals(sys, mesh);
+    passed &= CheckColoring(mesh, 4);
+
+    // Remove the elements and add them back in column-major order; the coloring must be updated (a column-major
+    // greedy coloring also requires exactly 4 colors)
+    std::cout << "Modified mesh" << std::endl;
+    std::vector<std::shared_ptr<ChElementBase>> elements = mesh->GetElements();
+    mesh->ClearElements();
+    for (int i = 0; i < num_elements; i++) {
+        for (int j = 0; j < num_elements; j++)
+            mesh->AddElement(elements[j * num_elements + i]);
+    }
+    sys.DoFullAssembly();
+    passed &= CheckResiduals(sys, mesh);
+    passed &= (mesh->GetNelements() == elements.size());
+    passed &= CheckColoring(mesh, 4);
+
+    std::cout << (passed ? "PASSED" : "FAILED") << std::endl;
+    return passed ? 0 : 1;
+}
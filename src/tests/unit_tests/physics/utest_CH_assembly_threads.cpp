@@ -0,0 +1,151 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Test for the parallel processing of bodies and links in a ChAssembly.
+//
+// A chain of pendulums, connected through revolute joints and spring-dampers,
+// is simulated with a single thread and with multiple Chrono threads. Since
+// bodies and links are processed in parallel only in passes where they write
+// their own data, the two simulations must produce identical results.
+// A second test drives a set of rotational motors with a single, shared
+// recorder function, which is then evaluated concurrently.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/motion_functions/ChFunction_Recorder.h"
+#include "chrono/physics/ChLinkMotorRotationSpeed.h"
+#include "chrono/physics/ChLinkTSDA.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+static std::vector<ChVector<>> SimulateChain(int num_threads) {
+    int num_links = 100;
+    double length = 0.5;
+
+    ChSystemNSC system;
+    system.Set_G_acc(ChVector<>(0, 0, -9.81));
+    system.SetNumThreads(num_threads);
+    system.SetParallelAssembly(num_threads > 1);
+    system.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    system.SetSolverType(ChSolver::Type::PSOR);
+    system.SetSolverMaxIterations(50);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    auto prev = ground;
+    for (int i = 0; i < num_links; i++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetPos(ChVector<>((i + 0.5) * length, 0, 0));
+        body->SetMass(1);
+        body->SetInertiaXX(ChVector<>(0.01, 0.1, 0.1));
+        system.AddBody(body);
+
+        auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+        joint->Initialize(body, prev, ChCoordsys<>(ChVector<>(i * length, 0, 0), Q_from_AngX(CH_C_PI_2)));
+        system.AddLink(joint);
+
+        // Spring-damper loading the residual entries of both connected bodies
+        auto spring = chrono_types::make_shared<ChLinkTSDA>();
+        spring->Initialize(body, prev, true, ChVector<>(0, 0, 0.1), ChVector<>(0, 0, 0.1), true);
+        spring->SetSpringCoefficient(100);
+        spring->SetDampingCoefficient(1);
+        system.AddLink(spring);
+
+        prev = body;
+    }
+
+    while (system.GetChTime() < 0.2) {
+        system.DoStepDynamics(1e-3);
+    }
+
+    std::vector<ChVector<>> positions;
+    for (const auto& body : system.Get_bodylist())
+        positions.push_back(body->GetPos());
+    return positions;
+}
+
+TEST(ChAssembly, threads) {
+    auto pos_serial = SimulateChain(1);
+    auto pos_parallel = SimulateChain(4);
+
+    ASSERT_EQ(pos_serial.size(), pos_parallel.size());
+    for (size_t i = 0; i < pos_serial.size(); i++) {
+        ASSERT_DOUBLE_EQ(pos_serial[i].x(), pos_parallel[i].x());
+        ASSERT_DOUBLE_EQ(pos_serial[i].y(), pos_parallel[i].y());
+        ASSERT_DOUBLE_EQ(pos_serial[i].z(), pos_parallel[i].z());
+    }
+}
+
+static std::vector<ChVector<>> SimulateMotors(int num_threads) {
+    int num_motors = 200;
+
+    ChSystemNSC system;
+    system.Set_G_acc(ChVector<>(0, 0, -9.81));
+    system.SetNumThreads(num_threads);
+    system.SetParallelAssembly(num_threads > 1);
+    system.SetSolverType(ChSolver::Type::PSOR);
+    system.SetSolverMaxIterations(50);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    // Speed profile shared by all motors (evaluated through the grid index, built at the first evaluation)
+    auto speed = chrono_types::make_shared<ChFunction_Recorder>();
+    for (int i = 0; i <= 1000; i++)
+        speed->AddPoint(i * 1e-3, std::sin(10.0 * i * 1e-3));
+    speed->EnableGridIndex(true);
+
+    for (int i = 0; i < num_motors; i++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetPos(ChVector<>(i * 1.0, 0, 0));
+        body->SetMass(1);
+        body->SetInertiaXX(ChVector<>(0.1, 0.1, 0.1));
+        system.AddBody(body);
+
+        auto motor = chrono_types::make_shared<ChLinkMotorRotationSpeed>();
+        motor->Initialize(body, ground, ChFrame<>(ChVector<>(i * 1.0, 0, 0.5), Q_from_AngX(CH_C_PI_2)));
+        motor->SetSpeedFunction(speed);
+        system.AddLink(motor);
+    }
+
+    while (system.GetChTime() < 0.2) {
+        system.DoStepDynamics(1e-3);
+    }
+
+    std::vector<ChVector<>> positions;
+    for (const auto& body : system.Get_bodylist())
+        positions.push_back(body->GetPos());
+    return positions;
+}
+
+TEST(ChAssembly, threads_shared_function) {
+    auto pos_serial = SimulateMotors(1);
+    auto pos_parallel = SimulateMotors(4);
+
+    ASSERT_EQ(pos_serial.size(), pos_parallel.size());
+    for (size_t i = 0; i < pos_serial.size(); i++) {
+        ASSERT_DOUBLE_EQ(pos_serial[i].x(), pos_parallel[i].x());
+        ASSERT_DOUBLE_EQ(pos_serial[i].y(), pos_parallel[i].y());
+        ASSERT_DOUBLE_EQ(pos_serial[i].z(), pos_parallel[i].z());
+    }
+}
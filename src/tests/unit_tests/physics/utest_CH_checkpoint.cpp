@@ -0,0 +1,196 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Unit test for the binary checkpoint (utils::ChCheckpoint).
+// A granular layer settling on a fixed box (surrounded by a cylindrical shell)
+// is simulated, a checkpoint is written to disk, and the system is restored
+// from the checkpoint into a new system. The restored state must match the
+// original one and the two systems must produce the same trajectories.
+// Checkpoint files with inconsistent section sizes must be rejected.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <tuple>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChCheckpoint.h"
+#include "chrono/utils/ChUtilsCreators.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+class CheckpointTest : public ::testing::TestWithParam<std::tuple<ChContactMethod, utils::ChCheckpoint::Compression>> {
+  protected:
+    CheckpointTest() : method(std::get<0>(GetParam())), compression(std::get<1>(GetParam())) {}
+
+    ChSystem* CreateSystem() const;
+    void CreateBodies(ChSystem* system) const;
+
+    ChContactMethod method;
+    utils::ChCheckpoint::Compression compression;
+};
+
+ChSystem* CheckpointTest::CreateSystem() const {
+    ChSystem* system;
+    if (method == ChContactMethod::NSC) {
+        system = new ChSystemNSC;
+    } else {
+        auto sys = new ChSystemSMC;
+        sys->SetContactForceModel(ChSystemSMC::Hertz);
+        sys->SetTangentialDisplacementModel(ChSystemSMC::OneStep);
+        system = sys;
+    }
+    system->Set_G_acc(ChVector<>(0, 0, -9.81));
+    return system;
+}
+
+void CheckpointTest::CreateBodies(ChSystem* system) const {
+    std::shared_ptr<ChMaterialSurface> material;
+    if (method == ChContactMethod::NSC) {
+        auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+        mat->SetFriction(0.4f);
+        material = mat;
+    } else {
+        auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+        mat->SetFriction(0.4f);
+        mat->SetYoungModulus(1e7f);
+        material = mat;
+    }
+
+    auto ground = std::shared_ptr<ChBody>(system->NewBody());
+    ground->SetIdentifier(-1);
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(ground.get(), material, ChVector<>(2, 2, 0.1), ChVector<>(0, 0, -0.1));
+    ground->GetCollisionModel()->AddCylindricalShell(material, 0.1, 0.2, ChVector<>(1.8, 1.8, 0.2),
+                                                     ChMatrix33<>(Q_from_AngX(CH_C_PI_2)));
+    ground->GetCollisionModel()->BuildModel();
+    system->AddBody(ground);
+
+    int id = 0;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            auto body = std::shared_ptr<ChBody>(system->NewBody());
+            body->SetIdentifier(id++);
+            body->SetMass(1);
+            body->SetInertiaXX(ChVector<>(0.004, 0.004, 0.004));
+            body->SetPos(ChVector<>(0.25 * i, 0.25 * j, 0.1 + 0.01 * (i + j)));
+            body->SetRot(Q_from_AngZ(0.1 * (i - j)));
+            body->SetCollide(true);
+            body->GetCollisionModel()->ClearModel();
+            if ((i + j) % 2 == 0)
+                utils::AddSphereGeometry(body.get(), material, 0.1);
+            else
+                utils::AddBoxGeometry(body.get(), material, ChVector<>(0.08, 0.06, 0.05));
+            body->GetCollisionModel()->BuildModel();
+            system->AddBody(body);
+        }
+    }
+}
+
+TEST_P(CheckpointTest, restart) {
+    double step = 1e-3;
+    std::string filename = "checkpoint_test.dat";
+
+    // Simulate the original system and write a checkpoint
+    ChSystem* system = CreateSystem();
+    CreateBodies(system);
+    for (int i = 0; i < 200; i++)
+        system->DoStepDynamics(step);
+
+    ASSERT_TRUE(utils::WriteCheckpointBinary(system, filename, compression));
+
+    // Restore the checkpoint in a new system
+    ChSystem* restored = CreateSystem();
+    ASSERT_TRUE(utils::ReadCheckpointBinary(restored, filename));
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(restored->Get_bodylist().size(), system->Get_bodylist().size());
+    ASSERT_EQ(restored->GetChTime(), system->GetChTime());
+    ASSERT_EQ(restored->GetStepcount(), system->GetStepcount());
+
+    for (size_t i = 0; i < system->Get_bodylist().size(); i++) {
+        auto b0 = system->Get_bodylist()[i];
+        auto b1 = restored->Get_bodylist()[i];
+        ASSERT_EQ(b1->GetIdentifier(), b0->GetIdentifier());
+        ASSERT_EQ(b1->GetBodyFixed(), b0->GetBodyFixed());
+        ASSERT_EQ(b1->GetMass(), b0->GetMass());
+        ASSERT_EQ(b1->GetCollisionModel()->GetNumShapes(), b0->GetCollisionModel()->GetNumShapes());
+        ASSERT_EQ(b1->GetPos(), b0->GetPos());
+        ASSERT_EQ(b1->GetRot(), b0->GetRot());
+        ASSERT_EQ(b1->GetPos_dt(), b0->GetPos_dt());
+        ASSERT_EQ(b1->GetWvel_loc(), b0->GetWvel_loc());
+    }
+
+    // Continue both simulations and compare the results
+    for (int i = 0; i < 100; i++) {
+        system->DoStepDynamics(step);
+        restored->DoStepDynamics(step);
+    }
+
+    for (size_t i = 0; i < system->Get_bodylist().size(); i++) {
+        auto b0 = system->Get_bodylist()[i];
+        auto b1 = restored->Get_bodylist()[i];
+        ASSERT_NEAR((b1->GetPos() - b0->GetPos()).Length(), 0.0, 1e-4);
+        ASSERT_NEAR((b1->GetPos_dt() - b0->GetPos_dt()).Length(), 0.0, 1e-3);
+    }
+
+    delete system;
+    delete restored;
+}
+
+// Overwrite a 64-bit field of the first section entry in a checkpoint file (entries follow the 64-byte file header;
+// the offset, size, and stored size of a section are at bytes 40, 48, and 56 of its 64-byte entry).
+static void CorruptFirstEntry(const std::string& filename, size_t field_offset, uint64_t value) {
+    std::ifstream in(filename, std::ios::binary);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    ASSERT_GT(bytes.size(), 128u);
+    std::memcpy(bytes.data() + 64 + field_offset, &value, sizeof(value));
+    std::ofstream out(filename, std::ios::binary);
+    out.write(bytes.data(), bytes.size());
+}
+
+TEST(CheckpointTest, corrupted_file) {
+    std::string filename = "checkpoint_corrupted.dat";
+    std::vector<double> data(100, 1.0);
+
+    for (size_t field : {40, 48, 56}) {
+        utils::ChCheckpoint checkpoint;
+        checkpoint.SetArray("data", data);
+        ASSERT_TRUE(checkpoint.Write(filename));
+        ASSERT_TRUE(checkpoint.Read(filename));
+
+        // Section extending past the end of the file, or larger than its stored data
+        CorruptFirstEntry(filename, field, (field == 40) ? 1ull << 62 : 1000 * sizeof(double));
+        ASSERT_FALSE(checkpoint.Read(filename));
+        ASSERT_FALSE(checkpoint.HasSection("data"));
+    }
+
+    std::remove(filename.c_str());
+}
+
+INSTANTIATE_TEST_CASE_P(Chrono,
+                       CheckpointTest,
+                       ::testing::Combine(::testing::Values(ChContactMethod::NSC, ChContactMethod::SMC),
+                                          ::testing::Values(utils::ChCheckpoint::Compression::NONE,
+                                                            utils::ChCheckpoint::Compression::ZLIB)));
@@ -0,0 +1,113 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Test for the ensemble runner.
+//
+// An ensemble of boxes sliding down an incline, with different friction
+// coefficients, is simulated concurrently. The results must match those of
+// simulations run sequentially, and the shared data must be loaded only once.
+//
+// =============================================================================
+
+#include <atomic>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/motion_functions/ChFunction_Recorder.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChEnsembleRunner.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+static const int num_members = 8;
+
+static std::shared_ptr<ChSystemNSC> CreateSystem(double friction, double slope) {
+    auto system = chrono_types::make_shared<ChSystemNSC>();
+    system->Set_G_acc(ChVector<>(-9.81 * std::sin(slope), 0, -9.81 * std::cos(slope)));
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction((float)friction);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 2, 0.2, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, 0, -0.1));
+    ground->SetBodyFixed(true);
+    system->AddBody(ground);
+
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.4, 0.2, 1000, false, true, mat);
+    box->SetPos(ChVector<>(0, 0, 0.1));
+    system->AddBody(box);
+
+    return system;
+}
+
+class TestScenario : public ChEnsembleRunner::Scenario {
+  public:
+    TestScenario() : runner(nullptr), num_loads(0), final_x(num_members, 0) {}
+
+    virtual std::shared_ptr<ChSystem> Create(int index) override {
+        // Table of friction coefficients, shared by all members
+        auto table = runner->GetSharedData<ChFunction_Recorder>("friction", [this]() {
+            num_loads++;
+            auto fun = chrono_types::make_shared<ChFunction_Recorder>();
+            fun->AddPoint(0, 0.1);
+            fun->AddPoint(num_members - 1, 0.8);
+            return fun;
+        });
+        return CreateSystem(table->Get_y(index), 0.5);
+    }
+
+    virtual void OnFinish(int index, ChSystem& system) override {
+        final_x[index] = system.Get_bodylist()[1]->GetPos().x();
+    }
+
+    ChEnsembleRunner* runner;
+    std::atomic<int> num_loads;
+    std::vector<double> final_x;
+};
+
+TEST(ChEnsembleRunner, run) {
+    auto scenario = chrono_types::make_shared<TestScenario>();
+    ChEnsembleRunner runner(scenario, num_members);
+    scenario->runner = &runner;
+    runner.SetNumThreads(4);
+    runner.SetStepSize(1e-3);
+    ASSERT_TRUE(runner.Run(0.5));
+    std::cout << "Wall time: " << runner.GetWallTime() << std::endl;
+
+    ASSERT_EQ(scenario->num_loads, 1);
+
+    for (int i = 0; i < num_members; i++) {
+        const auto& status = runner.GetStatus(i);
+        ASSERT_TRUE(status.completed);
+        ASSERT_NEAR(status.time, 0.5, 1e-10);
+        ASSERT_EQ(status.num_steps, 500);
+        ASSERT_TRUE(runner.GetSystem(i) == nullptr);
+
+        // Sequential simulation of the same member
+        auto system = CreateSystem(0.1 + 0.1 * i, 0.5);
+        system->SetNumThreads(1, 1, 1);
+        for (int k = 0; k < 500; k++)
+            system->DoStepDynamics(1e-3);
+        double x = system->Get_bodylist()[1]->GetPos().x();
+        std::cout << "Member " << i << "  x = " << scenario->final_x[i] << "  (sequential: " << x << ")" << std::endl;
+        ASSERT_NEAR(scenario->final_x[i], x, 1e-12);
+    }
+
+    // Boxes with friction coefficient below tan(slope) slide down the incline
+    ASSERT_LT(scenario->final_x[0], -0.1);
+    ASSERT_NEAR(scenario->final_x[num_members - 1], 0, 1e-3);
+}
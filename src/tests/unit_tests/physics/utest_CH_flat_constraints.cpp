@@ -0,0 +1,139 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Test for the flattened constraint storage used by the iterative VI solvers.
+//
+// A pile of spheres and boxes, with a body connected to ground through a
+// revolute joint, is simulated for a number of steps. For the problem loaded in
+// the system descriptor, the Schur complement product computed with the flat
+// constraint storage must match the one computed by the system descriptor, and
+// the VI solvers must produce the same solution with and without flat storage.
+//
+// =============================================================================
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChFlatConstraints.h"
+#include "chrono/solver/ChSolverAPGD.h"
+#include "chrono/solver/ChSolverBB.h"
+#include "chrono/solver/ChSolverPMINRES.h"
+#include "chrono/solver/ChSolverPSOR.h"
+
+using namespace chrono;
+
+class FlatConstraintsTest : public ::testing::Test {
+  protected:
+    FlatConstraintsTest() {
+        system.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+        auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+        mat->SetFriction(0.4f);
+
+        auto ground = chrono_types::make_shared<ChBodyEasyBox>(2, 2, 0.2, 1000, false, true, mat);
+        ground->SetPos(ChVector<>(0, 0, -0.1));
+        ground->SetBodyFixed(true);
+        system.AddBody(ground);
+
+        for (int i = 0; i < 4; i++) {
+            for (int j = 0; j < 4; j++) {
+                for (int k = 0; k < 2; k++) {
+                    ChVector<> pos(0.22 * (i - 1.5), 0.22 * (j - 1.5), 0.1 + 0.21 * k);
+                    std::shared_ptr<ChBody> body;
+                    if ((i + j + k) % 2 == 0)
+                        body = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, false, true, mat);
+                    else
+                        body = chrono_types::make_shared<ChBodyEasyBox>(0.18, 0.16, 0.16, 1000, false, true, mat);
+                    body->SetPos(pos + ChVector<>(0.01 * k, 0.005 * i, 0));
+                    system.AddBody(body);
+                }
+            }
+        }
+
+        auto pend = chrono_types::make_shared<ChBodyEasyBox>(0.6, 0.1, 0.1, 1000, false, true, mat);
+        pend->SetPos(ChVector<>(0.3, 0, 1.2));
+        system.AddBody(pend);
+
+        auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+        joint->Initialize(pend, ground, ChCoordsys<>(ChVector<>(0, 0, 1.2), Q_from_AngX(CH_C_PI_2)));
+        system.AddLink(joint);
+
+        for (int i = 0; i < 100; i++)
+            system.DoStepDynamics(1e-3);
+    }
+
+    ChSystemNSC system;
+};
+
+TEST_F(FlatConstraintsTest, product) {
+    ChSystemDescriptor& sysd = *system.GetSystemDescriptor();
+    for (auto c : sysd.GetConstraintsList())
+        c->Update_auxiliary();
+
+    ChFlatConstraints flat;
+    ASSERT_TRUE(flat.Update(sysd));
+
+    int n_c = sysd.CountActiveConstraints();
+    std::cout << "Contacts: " << system.GetNcontacts() << "  constraints: " << n_c << std::endl;
+    ASSERT_GT(system.GetNcontacts(), 20);
+    ASSERT_EQ(flat.GetNumConstraints(), n_c);
+    ASSERT_EQ(flat.GetNumCoordinates(), sysd.CountActiveVariables());
+
+    ChVectorDynamic<> l = ChVectorDynamic<>::Random(n_c);
+    ChVectorDynamic<> res_sysd;
+    ChVectorDynamic<> res_flat;
+
+    sysd.ShurComplementProduct(res_sysd, l);
+    flat.ShurComplementProduct(res_flat, l);
+    ASSERT_LT((res_flat - res_sysd).lpNorm<Eigen::Infinity>(), 1e-12 * res_sysd.lpNorm<Eigen::Infinity>());
+
+    std::vector<bool> enabled(n_c);
+    for (int i = 0; i < n_c; i++)
+        enabled[i] = (i % 3 != 1);
+    sysd.ShurComplementProduct(res_sysd, l, &enabled);
+    flat.ShurComplementProduct(res_flat, l, &enabled);
+    ASSERT_LT((res_flat - res_sysd).lpNorm<Eigen::Infinity>(), 1e-12 * res_sysd.lpNorm<Eigen::Infinity>());
+}
+
+TEST_F(FlatConstraintsTest, solvers) {
+    ChSystemDescriptor& sysd = *system.GetSystemDescriptor();
+
+    std::vector<std::shared_ptr<ChIterativeSolverVI>> solvers = {
+        chrono_types::make_shared<ChSolverPSOR>(), chrono_types::make_shared<ChSolverAPGD>(),
+        chrono_types::make_shared<ChSolverBB>(), chrono_types::make_shared<ChSolverPMINRES>()};
+    std::vector<std::string> names = {"PSOR", "APGD", "BB", "PMINRES"};
+
+    for (size_t i = 0; i < solvers.size(); i++) {
+        auto solver = solvers[i];
+        ChVectorDynamic<> l[2];
+        ChVectorDynamic<> v[2];
+        for (int k = 0; k < 2; k++) {
+            solver->EnableFlatConstraints(k == 1);
+            solver->Solve(sysd);
+            sysd.FromConstraintsToVector(l[k]);
+            sysd.FromVariablesToVector(v[k]);
+        }
+
+        double err_l = (l[1] - l[0]).lpNorm<Eigen::Infinity>() / l[0].lpNorm<Eigen::Infinity>();
+        double err_v = (v[1] - v[0]).lpNorm<Eigen::Infinity>() / v[0].lpNorm<Eigen::Infinity>();
+        std::cout << names[i] << "  lambda error: " << err_l << "  velocity error: " << err_v << std::endl;
+        ASSERT_LT(err_l, 1e-8);
+        ASSERT_LT(err_v, 1e-8);
+    }
+}
@@ -0,0 +1,130 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Test for the graph-colored parallel PSOR solver (ChSolverPSORcolored).
+//
+// A pile of spheres and boxes settling in a container, with a body connected
+// to ground through a revolute joint, is simulated with the colored PSOR solver
+// using one and multiple threads. Since constraints of the same color do not
+// share any active variables, the two simulations must produce identical
+// results. In addition, the number of iterations needed by the colored and the
+// sequential PSOR solvers to reach a given tolerance must be comparable.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/solver/ChSolverPSORcolored.h"
+
+using namespace chrono;
+
+static ChSystemNSC* CreateSystem(int num_threads) {
+    auto system = new ChSystemNSC;
+    system->Set_G_acc(ChVector<>(0, 0, -9.81));
+    system->SetNumThreads(num_threads, 1, 1);
+    system->SetSolverType(ChSolver::Type::PSOR_COLORED);
+    system->SetSolverMaxIterations(50);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 4, 0.2, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, 0, -0.1));
+    ground->SetBodyFixed(true);
+    system->AddBody(ground);
+
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 6; j++) {
+            for (int k = 0; k < 3; k++) {
+                ChVector<> pos(0.22 * (i - 2.5), 0.22 * (j - 2.5), 0.1 + 0.21 * k);
+                std::shared_ptr<ChBody> body;
+                if ((i + j + k) % 2 == 0)
+                    body = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, false, true, mat);
+                else
+                    body = chrono_types::make_shared<ChBodyEasyBox>(0.18, 0.16, 0.16, 1000, false, true, mat);
+                body->SetPos(pos + ChVector<>(0.01 * k, 0.005 * i, 0));
+                system->AddBody(body);
+            }
+        }
+    }
+
+    // A pendulum hanging over the pile (bilateral constraints mixed with the contacts)
+    auto pend = chrono_types::make_shared<ChBodyEasyBox>(0.6, 0.1, 0.1, 1000, false, true, mat);
+    pend->SetPos(ChVector<>(0.3, 0, 1.2));
+    system->AddBody(pend);
+
+    auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+    joint->Initialize(pend, ground, ChCoordsys<>(ChVector<>(0, 0, 1.2), Q_from_AngX(CH_C_PI_2)));
+    system->AddLink(joint);
+
+    return system;
+}
+
+TEST(ChSolverPSORcolored, threads) {
+    ChSystemNSC* system1 = CreateSystem(1);
+    ChSystemNSC* system4 = CreateSystem(4);
+
+    for (int i = 0; i < 200; i++) {
+        system1->DoStepDynamics(1e-3);
+        system4->DoStepDynamics(1e-3);
+    }
+
+    auto solver = std::static_pointer_cast<ChSolverPSORcolored>(system4->GetSolver());
+    std::cout << "Contacts: " << system4->GetNcontacts() << "  colors: " << solver->GetNumColors()
+              << "  uncolored: " << solver->GetNumUncolored() << std::endl;
+    ASSERT_GT(system4->GetNcontacts(), 100);
+    ASSERT_GT(solver->GetNumColors(), 1);
+
+    for (size_t i = 0; i < system1->Get_bodylist().size(); i++) {
+        auto b1 = system1->Get_bodylist()[i];
+        auto b4 = system4->Get_bodylist()[i];
+        ASSERT_EQ(b4->GetPos(), b1->GetPos());
+        ASSERT_EQ(b4->GetRot(), b1->GetRot());
+        ASSERT_EQ(b4->GetPos_dt(), b1->GetPos_dt());
+    }
+
+    delete system1;
+    delete system4;
+}
+
+TEST(ChSolverPSORcolored, convergence) {
+    ChSystemNSC* system = CreateSystem(4);
+    for (int i = 0; i < 200; i++)
+        system->DoStepDynamics(1e-3);
+
+    // Solve the problem currently loaded in the system descriptor with the sequential and the colored PSOR solvers
+    auto psor = chrono_types::make_shared<ChSolverPSOR>();
+    auto psor_colored = chrono_types::make_shared<ChSolverPSORcolored>();
+    for (auto solver : std::vector<std::shared_ptr<ChIterativeSolverVI>>{psor, psor_colored}) {
+        solver->SetMaxIterations(2000);
+        solver->SetTolerance(1e-6);
+        solver->Solve(*system->GetSystemDescriptor());
+    }
+
+    std::cout << "PSOR iterations: " << psor->GetIterations() << "  error: " << psor->GetError() << std::endl;
+    std::cout << "PSOR_COLORED iterations: " << psor_colored->GetIterations() << "  error: " << psor_colored->GetError()
+              << std::endl;
+
+    ASSERT_LT(psor->GetError(), 1e-6);
+    ASSERT_LT(psor_colored->GetError(), 1e-6);
+    ASSERT_LT(psor_colored->GetIterations(), 2 * psor->GetIterations());
+
+    delete system;
+}
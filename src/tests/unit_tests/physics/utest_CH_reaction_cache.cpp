@@ -0,0 +1,126 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Test for the caching of contact reactions in the NSC contact container.
+//
+// A pyramid of spheres resting in a box is simulated with the PSOR solver,
+// with and without warm starting from the cached contact reactions. All
+// contacts involve a sphere and have a single contact point, so that they all
+// persist once the pyramid has settled. All contacts must then be found in the
+// cache and warm starting must reduce the number of solver iterations.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+using namespace chrono;
+
+static ChSystemNSC* CreateSystem(bool warm_start) {
+    auto system = new ChSystemNSC;
+    system->Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->SetMaxIterations(1000);
+    solver->SetTolerance(1e-4);
+    solver->EnableWarmStart(warm_start);
+    system->SetSolver(solver);
+
+    auto container = std::static_pointer_cast<ChContactContainerNSC>(system->GetContactContainer());
+    container->EnableReactionCache(warm_start);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.5f);
+
+    // Box with a square floor holding 4x4 spheres
+    double radius = 0.1;
+    int n = 4;
+    double hsize = n * radius;
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(ground.get(), mat, ChVector<>(hsize + 0.1, hsize + 0.1, 0.1), ChVector<>(0, 0, -0.1));
+    utils::AddBoxGeometry(ground.get(), mat, ChVector<>(0.1, hsize, 0.4), ChVector<>(hsize + 0.1, 0, 0.4));
+    utils::AddBoxGeometry(ground.get(), mat, ChVector<>(0.1, hsize, 0.4), ChVector<>(-hsize - 0.1, 0, 0.4));
+    utils::AddBoxGeometry(ground.get(), mat, ChVector<>(hsize, 0.1, 0.4), ChVector<>(0, hsize + 0.1, 0.4));
+    utils::AddBoxGeometry(ground.get(), mat, ChVector<>(hsize, 0.1, 0.4), ChVector<>(0, -hsize - 0.1, 0.4));
+    ground->GetCollisionModel()->BuildModel();
+    system->AddBody(ground);
+
+    // Square pyramid of spheres, each layer resting in the pockets of the layer below
+    for (int layer = 0; layer < n; layer++) {
+        int m = n - layer;
+        double z = radius + layer * radius * std::sqrt(2.0);
+        for (int i = 0; i < m; i++) {
+            for (int j = 0; j < m; j++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, mat);
+                ball->SetPos(ChVector<>((2 * i - m + 1) * radius, (2 * j - m + 1) * radius, z));
+                system->AddBody(ball);
+            }
+        }
+    }
+
+    return system;
+}
+
+TEST(ChContactContainerNSC, reaction_cache) {
+    ChSystemNSC* system_ws = CreateSystem(true);
+    ChSystemNSC* system = CreateSystem(false);
+
+    auto solver_ws = std::static_pointer_cast<ChSolverPSOR>(system_ws->GetSolver());
+    auto solver = std::static_pointer_cast<ChSolverPSOR>(system->GetSolver());
+    auto container_ws = std::static_pointer_cast<ChContactContainerNSC>(system_ws->GetContactContainer());
+
+    // Let the pyramid settle
+    for (int i = 0; i < 200; i++) {
+        system_ws->DoStepDynamics(1e-3);
+        system->DoStepDynamics(1e-3);
+    }
+
+    // Collect solver statistics over a number of steps
+    int iterations_ws = 0;
+    int iterations = 0;
+    for (int i = 0; i < 50; i++) {
+        system_ws->DoStepDynamics(1e-3);
+        system->DoStepDynamics(1e-3);
+        iterations_ws += solver_ws->GetIterations();
+        iterations += solver->GetIterations();
+
+        ASSERT_GT(system_ws->GetNcontacts(), 0);
+        ASSERT_EQ(container_ws->GetNumCachedContacts(), system_ws->GetNcontacts());
+    }
+
+    std::cout << "Contacts: " << system_ws->GetNcontacts() << std::endl;
+    std::cout << "Average iterations with warm start:    " << iterations_ws / 50.0 << std::endl;
+    std::cout << "Average iterations without warm start: " << iterations / 50.0 << std::endl;
+    ASSERT_LT(2 * iterations_ws, iterations);
+
+    // Both simulations must lead to the same (settled) configuration
+    for (size_t i = 0; i < system->Get_bodylist().size(); i++) {
+        auto b_ws = system_ws->Get_bodylist()[i];
+        auto b = system->Get_bodylist()[i];
+        ASSERT_NEAR((b_ws->GetPos() - b->GetPos()).Length(), 0, 1e-3);
+    }
+
+    delete system_ws;
+    delete system;
+}
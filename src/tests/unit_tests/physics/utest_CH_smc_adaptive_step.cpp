@@ -0,0 +1,97 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Test for the adaptive step size control in ChSystemSMC.
+//
+// A sphere is dropped on the ground and bounces. The simulation with adaptive
+// step size control must reproduce the rebound height and the final position
+// obtained with a small fixed step size, while taking far fewer steps. Steps
+// which run into the impacts are rejected and repeated with a smaller step.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+using namespace chrono;
+
+static std::shared_ptr<ChSystemSMC> CreateSystem(bool adaptive) {
+    auto system = chrono_types::make_shared<ChSystemSMC>();
+    system->Set_G_acc(ChVector<>(0, 0, -9.81));
+    system->EnableAdaptiveStep(adaptive);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat->SetYoungModulus(1e7f);
+    mat->SetRestitution(0.8f);
+    mat->SetFriction(0.3f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(2, 2, 0.2, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, 0, -0.1));
+    ground->SetBodyFixed(true);
+    system->AddBody(ground);
+
+    auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, false, true, mat);
+    ball->SetPos(ChVector<>(0, 0, 0.5));
+    system->AddBody(ball);
+
+    return system;
+}
+
+// Simulate and return the largest height after the first impact
+static double Simulate(ChSystemSMC& system, double step, double frame, size_t& num_steps, int& num_rejections) {
+    auto ball = system.Get_bodylist()[1];
+    bool impact = false;
+    double height = 0;
+    num_rejections = 0;
+    while (system.GetChTime() < 0.8 - 1e-10) {
+        double frame_end = system.GetChTime() + frame;
+        while (system.GetChTime() < frame_end - 1e-10) {
+            system.DoStepDynamics(step);
+            num_rejections += system.GetNumAdaptiveRejections();
+        }
+        if (system.GetNcontacts() > 0)
+            impact = true;
+        if (impact)
+            height = std::max(height, ball->GetPos().z());
+    }
+    num_steps = system.GetStepcount();
+    return height;
+}
+
+TEST(ChSystemSMC, adaptive_step) {
+    auto system_fixed = CreateSystem(false);
+    auto system_adaptive = CreateSystem(true);
+
+    size_t steps_fixed;
+    size_t steps_adaptive;
+    int rejections_fixed;
+    int rejections_adaptive;
+    double h_fixed = Simulate(*system_fixed, 2e-5, 1e-3, steps_fixed, rejections_fixed);
+    double h_adaptive = Simulate(*system_adaptive, 1e-3, 1e-3, steps_adaptive, rejections_adaptive);
+
+    std::cout << "Fixed step:    rebound height " << h_fixed << "  steps " << steps_fixed << std::endl;
+    std::cout << "Adaptive step: rebound height " << h_adaptive << "  steps " << steps_adaptive
+              << "  rejected " << rejections_adaptive << std::endl;
+
+    ASSERT_GT(h_fixed, 0.2);
+    ASSERT_NEAR(h_adaptive, h_fixed, 0.02 * h_fixed);
+    ASSERT_LT(5 * steps_adaptive, steps_fixed);
+    ASSERT_EQ(rejections_fixed, 0);
+    ASSERT_GT(rejections_adaptive, 0);
+
+    // In free flight, only one step is needed per call
+    ASSERT_NEAR(system_adaptive->GetChTime(), system_fixed->GetChTime(), 1e-10);
+}
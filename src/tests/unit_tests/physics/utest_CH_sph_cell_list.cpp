@@ -0,0 +1,92 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Test for the cell-list neighbor search of ChMatterSPH.
+//
+// The SPH forces on a perturbed block of fluid nodes are evaluated using the
+// node pairs found by the collision system (through a ChProximityContainerSPH)
+// and using the internal cell list. Both must produce the same densities and
+// forces. The fluid is then simulated for a few steps with the cell list only.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChMatterSPH.h"
+#include "chrono/physics/ChProximityContainerSPH.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+TEST(ChMatterSPH, cell_list) {
+    ChSystemNSC system;
+    system.Set_G_acc(ChVector<>(0, 0, -9.81));
+    system.SetNumThreads(4, 1, 1);
+
+    auto edges = chrono_types::make_shared<ChProximityContainerSPH>();
+    system.Add(edges);
+
+    auto fluid = chrono_types::make_shared<ChMatterSPH>();
+    fluid->FillBox(ChVector<>(0.2, 0.2, 0.1), 0.02, 1000, ChCoordsys<>(ChVector<>(0, 0, 0.1)), true, 2.2, 0.3);
+    fluid->GetMaterial().Set_viscosity(0.5);
+    fluid->GetMaterial().Set_pressure_stiffness(50);
+    system.Add(fluid);
+    fluid->SetCollide(true);
+
+    unsigned int n = fluid->GetNnodes();
+    for (unsigned int i = 0; i < n; i++) {
+        auto node = std::dynamic_pointer_cast<ChNodeSPH>(fluid->GetNode(i));
+        node->SetPos_dt(ChVector<>(std::sin(i * 0.1), std::cos(i * 0.3), 0.1 * std::sin(i * 0.7)));
+    }
+
+    system.ComputeCollisions();
+    std::cout << "Nodes: " << n << "  proximities: " << edges->GetNproximities() << std::endl;
+    ASSERT_GT(edges->GetNproximities(), (int)n);
+
+    ChVectorDynamic<> R_prox = ChVectorDynamic<>::Zero(3 * n);
+    ChVectorDynamic<> R_cell = ChVectorDynamic<>::Zero(3 * n);
+    ChVectorDynamic<> density_prox(n);
+    ChVectorDynamic<> density_cell(n);
+
+    fluid->EnableCellList(false);
+    fluid->IntLoadResidual_F(0, R_prox, 1.0);
+    for (unsigned int i = 0; i < n; i++)
+        density_prox(i) = std::dynamic_pointer_cast<ChNodeSPH>(fluid->GetNode(i))->density;
+
+    fluid->EnableCellList(true);
+    fluid->IntLoadResidual_F(0, R_cell, 1.0);
+    for (unsigned int i = 0; i < n; i++)
+        density_cell(i) = std::dynamic_pointer_cast<ChNodeSPH>(fluid->GetNode(i))->density;
+
+    double err_density = (density_cell - density_prox).lpNorm<Eigen::Infinity>();
+    double err_force = (R_cell - R_prox).lpNorm<Eigen::Infinity>();
+    std::cout << "Density error: " << err_density << "  force error: " << err_force << std::endl;
+    ASSERT_GT(density_prox.minCoeff(), 0);
+    ASSERT_LT(err_density, 1e-9 * density_prox.lpNorm<Eigen::Infinity>());
+    ASSERT_LT(err_force, 1e-9 * R_prox.lpNorm<Eigen::Infinity>());
+
+    // Simulate using the cell list only
+    system.Remove(edges);
+    fluid->SetCollide(false);
+    for (int i = 0; i < 20; i++)
+        system.DoStepDynamics(1e-4);
+
+    for (unsigned int i = 0; i < n; i++) {
+        auto node = std::dynamic_pointer_cast<ChNodeSPH>(fluid->GetNode(i));
+        ASSERT_TRUE(std::isfinite(node->GetPos().Length()));
+        ASSERT_GT(node->density, 0);
+    }
+}
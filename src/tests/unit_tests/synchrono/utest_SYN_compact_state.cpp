@@ -0,0 +1,144 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Unit test for the compact (quantized and delta) encoding of the SynChrono
+// vehicle state messages
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono_synchrono/flatbuffer/SynFlatBuffersManager.h"
+#include "chrono_synchrono/flatbuffer/message/SynTrackedVehicleMessage.h"
+
+using namespace chrono;
+using namespace synchrono;
+
+const int num_shoes = 200;
+
+// Track shoe poses, with the shoes on a circle in the vertical plane of a vehicle at the given location
+std::vector<SynPose> TrackShoes(const ChFrame<>& chassis, double angle) {
+    std::vector<SynPose> shoes;
+    for (int i = 0; i < num_shoes; i++) {
+        double a = angle + CH_C_2PI * i / num_shoes;
+        ChVector<> loc(2.0 * std::cos(a), 1.2, 0.5 * std::sin(a));
+        shoes.emplace_back(chassis.TransformPointLocalToParent(loc), chassis.GetRot() * Q_from_AngY(-a));
+    }
+    return shoes;
+}
+
+// Serialize a state message and parse it back
+std::shared_ptr<SynTrackedVehicleStateMessage> SendReceive(std::shared_ptr<SynTrackedVehicleStateMessage> state,
+                                                           int& size) {
+    SynFlatBuffersManager manager;
+    manager.AddMessage(state);
+    manager.Finish();
+    size = manager.GetSize();
+
+    SynMessageList messages;
+    EXPECT_TRUE(manager.ProcessBuffer(manager.GetBufferPointer(), manager.GetSize(), messages));
+    EXPECT_EQ(messages.size(), 1);
+    return std::dynamic_pointer_cast<SynTrackedVehicleStateMessage>(messages[0]);
+}
+
+double MaxError(const std::vector<SynPose>& a, const std::vector<SynPose>& b, double& rot_error) {
+    double pos_error = 0;
+    rot_error = 0;
+    for (size_t i = 0; i < a.size(); i++) {
+        pos_error = std::max(pos_error, (a[i].GetFrame().GetPos() - b[i].GetFrame().GetPos()).Length());
+        auto q = a[i].GetFrame().GetRot() - b[i].GetFrame().GetRot();
+        auto q_neg = a[i].GetFrame().GetRot() + b[i].GetFrame().GetRot();
+        rot_error = std::max(rot_error, std::min(q.Length(), q_neg.Length()));
+    }
+    return pos_error;
+}
+
+TEST(SynChrono, SynCompactState) {
+    double resolution = 1e-3;
+    ChFrame<> chassis(ChVector<>(120.5, -43.2, 0.8), Q_from_AngZ(0.7));
+    auto shoes = TrackShoes(chassis, 0.1);
+    std::vector<SynPose> wheels;
+    wheels.emplace_back(chassis.TransformPointLocalToParent(ChVector<>(1, 1, 0)), chassis.GetRot());
+
+    auto state = chrono_types::make_shared<SynTrackedVehicleStateMessage>(1, 0);
+
+    // Full encoding
+    int size_full;
+    state->SetState(1.0, SynPose(chassis.GetPos(), chassis.GetRot()), shoes, wheels, wheels, wheels);
+    auto received = SendReceive(state, size_full);
+    ASSERT_FALSE(received->has_compact);
+    ASSERT_EQ(received->track_shoes.size(), num_shoes);
+
+    // Compact encoding: keyframe
+    int size_key;
+    state->EnableCompactEncoding(true, resolution, 10);
+    state->SetState(1.0, SynPose(chassis.GetPos(), chassis.GetRot()), shoes, wheels, wheels, wheels);
+    received = SendReceive(state, size_key);
+    ASSERT_TRUE(received->has_compact);
+    ASSERT_TRUE(received->compact.IsKeyframe());
+    ASSERT_TRUE(received->track_shoes.empty());
+
+    SynCompactPoses keyframe;
+    std::vector<SynPose> poses;
+    ASSERT_TRUE(received->compact.Decode(received->chassis.GetFrame(), keyframe, poses));
+    ASSERT_EQ(poses.size(), num_shoes + 3);
+
+    double rot_error;
+    double pos_error = MaxError(shoes, poses, rot_error);
+    ASSERT_LT(pos_error, resolution);
+    ASSERT_LT(rot_error, 1e-4);
+    ASSERT_LT(5 * size_key, size_full);
+
+    // Compact encoding: delta frame with a few changed shoes
+    int size_delta;
+    shoes[3] = SynPose(shoes[3].GetFrame().GetPos() + ChVector<>(0, 0, 0.01), shoes[3].GetFrame().GetRot());
+    shoes[70] = SynPose(shoes[70].GetFrame().GetPos() + ChVector<>(0.02, 0, 0), shoes[70].GetFrame().GetRot());
+    state->SetState(1.1, SynPose(chassis.GetPos(), chassis.GetRot()), shoes, wheels, wheels, wheels);
+    received = SendReceive(state, size_delta);
+    ASSERT_FALSE(received->compact.IsKeyframe());
+    ASSERT_EQ(received->compact.GetNumPoses(), 2);
+    ASSERT_LT(size_delta, size_key);
+
+    // A delta frame cannot be decoded without its keyframe
+    SynCompactPoses no_keyframe;
+    ASSERT_FALSE(received->compact.Decode(received->chassis.GetFrame(), no_keyframe, poses));
+
+    ASSERT_TRUE(received->compact.Decode(received->chassis.GetFrame(), keyframe, poses));
+    pos_error = MaxError(shoes, poses, rot_error);
+    ASSERT_LT(pos_error, resolution);
+    ASSERT_LT(rot_error, 1e-4);
+
+    // Moving the whole vehicle does not change the poses relative to the chassis
+    chassis = ChFrame<>(ChVector<>(125.0, -40.0, 0.9), Q_from_AngZ(0.9));
+    shoes = TrackShoes(chassis, 0.1);
+    wheels[0] = SynPose(chassis.TransformPointLocalToParent(ChVector<>(1, 1, 0)), chassis.GetRot());
+    state->SetState(1.2, SynPose(chassis.GetPos(), chassis.GetRot()), shoes, wheels, wheels, wheels);
+    received = SendReceive(state, size_delta);
+    ASSERT_FALSE(received->compact.IsKeyframe());
+    ASSERT_EQ(received->compact.GetNumPoses(), 0);
+    ASSERT_LT(size_delta, size_key);
+
+    ASSERT_TRUE(received->compact.Decode(received->chassis.GetFrame(), keyframe, poses));
+    pos_error = MaxError(shoes, poses, rot_error);
+    ASSERT_LT(pos_error, resolution);
+
+    // An invalid buffer is rejected
+    std::vector<uint8_t> garbage(64, 0xff);
+    SynFlatBuffersManager manager;
+    SynMessageList messages;
+    ASSERT_FALSE(manager.ProcessBuffer(garbage.data(), garbage.size(), messages));
+    ASSERT_TRUE(messages.empty());
+}
@@ -0,0 +1,100 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Unit test for the interest management of the SynChrono MPI communicator.
+// Must be run with at least 3 ranks (e.g. mpirun -np 4 utest_SYN_interest)
+//
+// =============================================================================
+
+#include <cstdlib>
+#include <set>
+
+#include "gtest/gtest.h"
+
+#include "chrono_synchrono/communication/mpi/SynMPICommunicator.h"
+#include "chrono_synchrono/flatbuffer/message/SynSimulationMessage.h"
+
+using namespace chrono;
+using namespace synchrono;
+
+std::shared_ptr<SynMPICommunicator> communicator;
+int rank;
+int num_ranks;
+
+// Define our own main here to handle the MPI setup
+int main(int argc, char* argv[]) {
+    // Let google strip their cli arguments
+    ::testing::InitGoogleTest(&argc, argv);
+
+    communicator = chrono_types::make_shared<SynMPICommunicator>(argc, argv);
+    rank = communicator->GetRank();
+    num_ranks = communicator->GetNumRanks();
+
+    ::testing::TestEventListeners& listeners = ::testing::UnitTest::GetInstance()->listeners();
+    if (rank != 0) {
+        delete listeners.Release(listeners.default_result_printer());
+    }
+
+    int result = RUN_ALL_TESTS();
+    communicator = nullptr;
+    return result;
+}
+
+// Exchange one message per rank and return the set of ranks that sent the received messages
+std::set<unsigned int> Exchange(bool interest) {
+    SynMessageList messages;
+    messages.push_back(chrono_types::make_shared<SynSimulationMessage>(rank, 0, false));
+    communicator->AddOutgoingMessages(messages);
+
+    // Ranks are placed along a line, 10 m apart, and are interested in their immediate neighbors.
+    // The last rank does not set a region of interest.
+    if (interest && rank != num_ranks - 1)
+        communicator->SetInterest({ChVector<>(10.0 * rank, 0, 0)}, 15);
+
+    communicator->Synchronize();
+
+    std::set<unsigned int> sources;
+    for (auto& message : communicator->GetMessages())
+        sources.insert(message->GetSourceID());
+
+    communicator->Reset();
+    communicator->Barrier();
+
+    return sources;
+}
+
+TEST(SynChrono, SynInterestManagement) {
+    ASSERT_GE(num_ranks, 3);
+
+    // Without interest management, all ranks receive all messages
+    auto sources = Exchange(false);
+    ASSERT_EQ(communicator->GetNumReceived(), num_ranks - 1);
+    ASSERT_EQ((int)sources.size(), num_ranks - 1);
+
+    // With interest management, ranks only receive from their neighbors and from the rank without region of interest
+    sources = Exchange(true);
+    std::set<unsigned int> expected;
+    for (int i = 0; i < num_ranks; i++) {
+        if (i == rank)
+            continue;
+        if (rank == num_ranks - 1 || i == num_ranks - 1 || std::abs(i - rank) == 1)
+            expected.insert(i);
+    }
+    ASSERT_EQ(communicator->GetNumReceived(), (int)expected.size());
+    ASSERT_EQ(sources, expected);
+
+    // The region of interest only applies to one synchronization
+    sources = Exchange(false);
+    ASSERT_EQ((int)sources.size(), num_ranks - 1);
+}
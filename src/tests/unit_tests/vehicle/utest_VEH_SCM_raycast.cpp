@@ -0,0 +1,136 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Jason Zhou
+// =============================================================================
+//
+// Test for the SCM analytic ray caster.
+//
+// A sphere, a rotated box, and a rotated cylinder are placed so that they
+// penetrate a flat SCM patch with a fine grid (1 cm spacing). A single step is
+// taken with ray casting performed in the collision system (RayHit) and with
+// the analytic ray caster, and the deformed grid nodes are compared.
+//
+// The collision system casts rays against shapes enlarged by the collision
+// envelope and margin, then moves the hit point back along the hit normal.
+// Rays grazing a steep face just outside a shape can therefore register deep
+// hits, and hits on the bottom faces are slightly lower. The two casters must
+// agree to within 2 cm: in the extent of the deformed area and in the node
+// levels away from its boundary.
+//
+// =============================================================================
+
+#include <cmath>
+#include <map>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/terrain/SCMDeformableTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+typedef std::map<std::pair<int, int>, double> NodeLevels;
+
+static NodeLevels CastRays(bool analytic, int& num_hits) {
+    ChSystemSMC system;
+    system.Set_G_acc(ChVector<>(0, 0, 0));
+
+    SCMDeformableTerrain terrain(&system, false);
+    terrain.SetSoilParameters(2e6, 0, 1.1, 0, 30, 0.01, 2e8, 3e4);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+
+    auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.3, 1000, false, true, mat);
+    sphere->SetPos(ChVector<>(-0.8, 0, 0.3 - 0.1));
+
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.3, 0.2, 1000, false, true, mat);
+    box->SetPos(ChVector<>(0, 0.1, 0));
+    box->SetRot(Q_from_AngZ(CH_C_PI / 6) * Q_from_AngX(CH_C_PI / 5));
+
+    auto cyl = chrono_types::make_shared<ChBodyEasyCylinder>(0.25, 0.3, 1000, false, true, mat);
+    cyl->SetPos(ChVector<>(0.8, -0.1, 0.25 - 0.12));
+    cyl->SetRot(Q_from_AngZ(CH_C_PI / 3) * Q_from_AngX(CH_C_PI / 7));
+
+    // Note: the bodies are not fixed, as loads cannot be applied to a system without degrees of freedom.
+    // Ray casting is performed with the initial body positions.
+    for (auto body : {std::shared_ptr<ChBody>(sphere), std::shared_ptr<ChBody>(box), std::shared_ptr<ChBody>(cyl)}) {
+        system.Add(body);
+        terrain.AddMovingPatch(body, ChVector<>(0, 0, 0), ChVector<>(1, 1, 1));
+    }
+
+    terrain.EnableAnalyticRayCasting(analytic);
+    terrain.Initialize(3.0, 1.5, 0.01);
+
+    system.DoStepDynamics(1e-3);
+    num_hits = terrain.GetNumRayHits();
+
+    NodeLevels levels;
+    for (const auto& node : terrain.GetModifiedNodes())
+        levels[std::make_pair(node.first.x(), node.first.y())] = node.second;
+    return levels;
+}
+
+// Check whether any (all) of the nodes within the given number of grid cells of a node are in the set.
+static bool AnyNear(const NodeLevels& levels, const std::pair<int, int>& node, int cells) {
+    for (int i = -cells; i <= cells; i++)
+        for (int j = -cells; j <= cells; j++)
+            if (levels.count(std::make_pair(node.first + i, node.second + j)))
+                return true;
+    return false;
+}
+
+static bool AllNear(const NodeLevels& levels, const std::pair<int, int>& node, int cells) {
+    for (int i = -cells; i <= cells; i++)
+        for (int j = -cells; j <= cells; j++)
+            if (!levels.count(std::make_pair(node.first + i, node.second + j)))
+                return false;
+    return true;
+}
+
+TEST(SCMDeformableTerrain, analytic_raycast) {
+    const double tolerance = 0.02;
+    const int cells = 2;  // tolerance in grid cells
+
+    int hits_collsys;
+    int hits_analytic;
+    auto levels_collsys = CastRays(false, hits_collsys);
+    auto levels_analytic = CastRays(true, hits_analytic);
+
+    std::cout << "ray hits: " << hits_collsys << " (collision system)  " << hits_analytic << " (analytic)"
+              << std::endl;
+    std::cout << "deformed nodes: " << levels_collsys.size() << " (collision system)  " << levels_analytic.size()
+              << " (analytic)" << std::endl;
+
+    ASSERT_GT(hits_analytic, 0);
+    ASSERT_FALSE(levels_analytic.empty());
+
+    // The collision system shapes are enlarged, so every node deformed by the analytic caster is also deformed by
+    // the collision system caster and the remaining nodes are along the boundary of the deformed area.
+    for (const auto& node : levels_analytic)
+        ASSERT_TRUE(levels_collsys.count(node.first));
+    for (const auto& node : levels_collsys)
+        ASSERT_TRUE(AnyNear(levels_analytic, node.first, cells));
+
+    // Node levels must match away from the boundary of the deformed area.
+    double max_diff = 0;
+    for (const auto& node : levels_analytic) {
+        if (!AllNear(levels_analytic, node.first, cells))
+            continue;
+        max_diff = std::max(max_diff, std::abs(node.second - levels_collsys[node.first]));
+    }
+
+    std::cout << "max node level difference: " << max_diff << std::endl;
+    ASSERT_LT(max_diff, tolerance);
+}